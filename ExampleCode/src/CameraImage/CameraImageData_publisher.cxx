@@ -10,10 +10,10 @@
  * times of each optimization mode.
  *
  * TO USE THE DIFFERENT OPTIMIZATION MODES(FlatData, ZeroCopy, or both)
- *  1. Uncomment the required #define DDS_LARGE_DATA_*
- *     (in this file (below) and in the complementary subscriber.cxx file)
- *  2. Uncomment the supporting lines in the automotive.idl file.
- *  3. Rebuild all.
+ *  set config.dataMode in camera_image.properties (and use the same mode
+ *  in the subscriber); see cameraMode.h.  No rebuild is needed.
+ *  The "frame" modes send variable-size frames of each camera's geometry
+ *  (see cameraStreams.h) instead of the whole MAX_IMAGE_SIZE array.
  *
  * (c) 2005-2019 Copyright, Real-Time Innovations, Inc.  All rights reserved.
  * RTI grants Licensee a license to use, modify, compile, and create derivative
@@ -26,9 +26,18 @@
  **/
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <vector>
 
 #include "dataObject.h"
 #include "Utils.h"
+#include "cameraMode.h"
+#include "cameraStreams.h"
+#include "cameraLfsr.h"
 
 #include "automotive.h"
 #include "automotiveSupport.h"
@@ -40,16 +49,6 @@
 #include <time.h>       // for timestamp/timing
 #endif  // def _WIN32
 
-/* uncomment one|other|both|neither of the following for
-   FLAT_DATA | ZERO_COPY | FLAT and ZERO | (standard DDS) speed optimizations */
-//#define DDS_LARGE_DATA_FLAT_DATA
-//#define DDS_LARGE_DATA_ZERO_COPY
-
-// seed for LFSR used for striping the data array
-#define LFSR_SEED   (0x55555555)
-uint32_t ddsId = 1;
-uint32_t lfsr = LFSR_SEED;
-uint32_t seqNum = 1;
 
 
 #ifdef _WIN32
@@ -111,32 +110,337 @@ static int publisher_shutdown(
     return status;
 }
 
-#ifdef DDS_LARGE_DATA_FLAT_DATA
+/** ----------------------------------------------------------------
+ * cameraStream
+ * a camera sent by this publisher: its configuration, where its LFSR
+ * sequence and seqnum are, and when its next frame is due.
+ **/
+typedef struct {
+    cameraStreamConfig  config;
+    uint32_t    lfsr;
+    uint32_t    seqNum;
+    uint64_t    tNext;          // UtcNowPrecise() time of the next frame
+    uint64_t    period;         // nSec between frames
+    int         count;          // frames sent
+} cameraStream;
+
+/** ----------------------------------------------------------------
+ * fill_lfsr_data()
+ * Fill 'size' bytes of an image data array with the camera's LFSR
+ * sequence, continuing from where its last frame left off.
+ **/
+static void fill_lfsr_data(cameraStream *cam, uint8_t *data, int size)
+{
+    int words = size / 4;
+    uint32_t lfsr = lfsrFill((uint32_t *)data, words, cam->lfsr);
+    if ((words * 4) < size) {
+        // the last bytes of a frame that is not a multiple of 4
+        memcpy(&data[words * 4], &lfsr, size - (words * 4));
+        lfsr = lfsrStep(lfsr);
+    }
+    cam->lfsr = lfsr;
+}
+
+/** ----------------------------------------------------------------
+ * fill_data_sample()
+ * Fill a plain (or Zero Copy) sample's data array with LFSR data, then
+ * add a current timestamp to measure the transfer time at the subscriber.
+ **/
+template <typename T>
+static void fill_data_sample(cameraStream *cam, T *instance)
+{
+    instance->id = cam->config.id;
+    fill_lfsr_data(cam, instance->data, cam->config.frameSize);
+    instance->seqnum = cam->seqNum++;
+    uint64_t tNow = UtcNowPrecise();
+    instance->sec_ = (tNow / 1000000000);
+    instance->nanosec_ = (tNow % 1000000000);
+}
+
+/** ----------------------------------------------------------------
+ * fill_data_sample() (variable-size frame)
+ * Set the frame's geometry and fill only its bytes of the data sequence.
+ **/
+static void fill_data_sample(cameraStream *cam, CameraImage_CameraImageFrame *instance)
+{
+    instance->id = cam->config.id;
+    instance->width = cam->config.width;
+    instance->height = cam->config.height;
+    instance->stride = cam->config.stride;
+    instance->format = (CameraImage_PixelFormatEnum)cam->config.format;
+    instance->data.ensure_length(cam->config.frameSize, MAX_IMAGE_SIZE);
+    fill_lfsr_data(cam, (uint8_t *)&instance->data[0], cam->config.frameSize);
+    instance->seqnum = cam->seqNum++;
+    uint64_t tNow = UtcNowPrecise();
+    instance->sec_ = (tNow / 1000000000);
+    instance->nanosec_ = (tNow % 1000000000);
+}
+
 /** ----------------------------------------------------------------
  * build_data_sample()
- * Fill the sample's data array with LFSR data, then add a current
+ * Fill the FlatData sample's data array with LFSR data, then add a current
  * timestamp to measure the transfer time at the subscriper.
  * This uses a plain_cast to speed the fill of the sample array.
  * returns true
  **/
-bool build_data_sample(CameraImage_CameraImageDataBuilder& builder)
+template <typename TBuilder>
+static bool build_data_sample(cameraStream *cam, TBuilder& builder)
 {
-    // Build the CameraImage_CameraImageData data sample
-    builder.add_id(ddsId);
-    builder.add_seqnum(seqNum++);
+    // Build the FlatData data sample
+    builder.add_id(cam->config.id);
+    builder.add_seqnum(cam->seqNum++);
     auto data_offset = builder.add_data();
     auto data_array = rti::flat::plain_cast(data_offset);
-    for (int i = 0; i < MAX_IMAGE_SIZE; i += 4) {
-        uint32_t *lfsrVal = (uint32_t *)&data_array[i];
-        *lfsrVal = lfsr;
-        lfsr = (lfsr >> 1) ^ (-(lfsr & 1u) & 0xD0000001u);
+    fill_lfsr_data(cam, (uint8_t *)&data_array[0], cam->config.frameSize);
+    uint64_t tNow = UtcNowPrecise();
+    builder.add_sec_(tNow / 1000000000);
+    builder.add_nanosec_(tNow % 1000000000);
+    return true;
+}
+
+/** ----------------------------------------------------------------
+ * build_frame_sample()
+ * Build a variable-size FlatData frame: its geometry, then a data
+ * sequence of only its bytes, filled in place with LFSR data.
+ * returns false if the sample could not be built
+ **/
+template <typename TBuilder>
+static bool build_frame_sample(cameraStream *cam, TBuilder& builder)
+{
+    builder.add_id(cam->config.id);
+    builder.add_seqnum(cam->seqNum++);
+    builder.add_width(cam->config.width);
+    builder.add_height(cam->config.height);
+    builder.add_stride(cam->config.stride);
+    builder.add_format((CameraImage_PixelFormatEnum)cam->config.format);
+
+    auto data_builder = builder.build_data();
+    data_builder.add_n(cam->config.frameSize);
+    auto data_offset = data_builder.finish();
+    if (builder.check_failure()) {
+        return false;
     }
+    auto data_array = rti::flat::plain_cast(data_offset);
+    fill_lfsr_data(cam, (uint8_t *)&data_array[0], cam->config.frameSize);
+
     uint64_t tNow = UtcNowPrecise();
     builder.add_sec_(tNow / 1000000000);
     builder.add_nanosec_(tNow % 1000000000);
     return true;
 }
-#endif 	// DDS_LARGE_DATA_FLAT_DATA
+
+static bool build_data_sample(cameraStream *cam, CameraImage_CameraImageFrameFlatBuilder& builder)
+{
+    return build_frame_sample(cam, builder);
+}
+
+static bool build_data_sample(cameraStream *cam, CameraImage_CameraImageFrameFlatZeroCopyBuilder& builder)
+{
+    return build_frame_sample(cam, builder);
+}
+
+/** ----------------------------------------------------------------
+ * run_cameras()
+ * Send 'sample_count' frames (0: forever) of every camera, each at its
+ * own interval, from 'threadCount' threads: camera N is sent by thread
+ * (N % threadCount), which sends whichever of its cameras is due next.
+ * send_frame(N) writes one frame of camera N and returns 0, or -1 to stop.
+ * returns 0, or -1 on error
+ **/
+static int run_cameras(std::vector<cameraStream> &cams, int threadCount,
+    int sample_count, const std::function<int(int)> &send_frame)
+{
+    std::atomic<bool> failed(false);
+    std::vector<std::thread> threads;
+
+    uint64_t tStart = UtcNowPrecise();
+    for (size_t c = 0; c < cams.size(); c++) {
+        cams[c].tNext = tStart;
+        cams[c].period = (uint64_t)cams[c].config.interval * 1000000;
+    }
+
+    for (int t = 0; t < threadCount; t++) {
+        threads.push_back(std::thread([&, t]() {
+            while (!failed) {
+                // the camera of this thread that is due next
+                int next = -1;
+                for (int c = t; c < (int)cams.size(); c += threadCount) {
+                    if ((sample_count != 0) && (cams[c].count >= sample_count)) {
+                        continue;
+                    }
+                    if ((next < 0) || (cams[c].tNext < cams[next].tNext)) {
+                        next = c;
+                    }
+                }
+                if (next < 0) {
+                    break;      // all of its cameras are done
+                }
+
+                cameraStream &cam = cams[next];
+                uint64_t tNow = UtcNowPrecise();
+                if (cam.tNext > tNow) {
+                    std::this_thread::sleep_for(std::chrono::nanoseconds(cam.tNext - tNow));
+                }
+                if (send_frame(next) != 0) {
+                    failed = true;
+                    break;
+                }
+                cam.count++;
+                // when late by more than a frame, don't try to catch up
+                cam.tNext += cam.period;
+                tNow = UtcNowPrecise();
+                if (cam.tNext + cam.period < tNow) {
+                    cam.tNext = tNow;
+                }
+            }
+        }));
+    }
+    for (size_t t = 0; t < threads.size(); t++) {
+        threads[t].join();
+    }
+    return (failed ? -1 : 0);
+}
+
+/** ----------------------------------------------------------------
+ * publish_plain()
+ * Send the camera frames of a plain type, using one sample per camera
+ * that is filled again for every write.
+ * returns 0, or -1 on error
+ **/
+template <typename T, typename TTypeSupport, typename TDataWriter>
+static int publish_plain(DDSDataWriter *writer, const char *type_name,
+    std::vector<cameraStream> &cams, int threadCount, int sample_count)
+{
+    DDS_ReturnCode_t retcode;
+    TDataWriter *typed_writer = TDataWriter::narrow(writer);
+    if (typed_writer == NULL) {
+        fprintf(stderr, "DataWriter narrow error(%s:%d)\n", __FILE__, __LINE__);
+        return -1;
+    }
+
+    /* Create a data sample for each camera */
+    std::vector<T *> instances(cams.size(), (T *)NULL);
+    std::vector<DDS_InstanceHandle_t> handles(cams.size(), DDS_HANDLE_NIL);
+    int status = 0;
+    for (size_t c = 0; c < cams.size(); c++) {
+        instances[c] = TTypeSupport::create_data();
+        if (instances[c] == NULL) {
+            fprintf(stderr, "%s create_data error(%s:%d)\n", type_name, __FILE__, __LINE__);
+            status = -1;
+            break;
+        }
+        // CameraImageData type uses a @key; init and register it here
+        instances[c]->id = cams[c].config.id;
+        handles[c] = typed_writer->register_instance(*instances[c]);
+    }
+
+    if (status == 0) {
+        status = run_cameras(cams, threadCount, sample_count, [&](int c) {
+            printf("Writing %s id %u, count %d\n", type_name, cams[c].config.id, cams[c].count);
+            fill_data_sample(&cams[c], instances[c]);
+            DDS_ReturnCode_t retcode = typed_writer->write(*instances[c], handles[c]);
+            if (retcode != DDS_RETCODE_OK) {
+                fprintf(stderr, "write error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
+            }
+            return 0;
+        });
+    }
+
+    /* Delete data samples */
+    for (size_t c = 0; c < cams.size(); c++) {
+        if (instances[c] == NULL) {
+            continue;
+        }
+        retcode = TTypeSupport::delete_data(instances[c]);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "%s delete_data error %d (%s:%d)\n", type_name, retcode, __FILE__, __LINE__);
+        }
+    }
+    return status;
+}
+
+/** ----------------------------------------------------------------
+ * publish_loaned()
+ * Send the camera frames of a Zero Copy type: each sample is loaned
+ * from shared memory, and goes back to the writer when it is written.
+ * returns 0, or -1 on error
+ **/
+template <typename T, typename TDataWriter>
+static int publish_loaned(DDSDataWriter *writer, const char *type_name,
+    std::vector<cameraStream> &cams, int threadCount, int sample_count)
+{
+    TDataWriter *typed_writer = TDataWriter::narrow(writer);
+    if (typed_writer == NULL) {
+        fprintf(stderr, "DataWriter narrow error(%s:%d)\n", __FILE__, __LINE__);
+        return -1;
+    }
+
+    return run_cameras(cams, threadCount, sample_count, [&](int c) {
+        /* Get a new sample before every write. This data sample can come from a
+        free sample or a previously written sample which is ready for reuse. */
+        T *instance = NULL;
+        DDS_ReturnCode_t retcode = typed_writer->get_loan(instance);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "%s get_loan error(%s:%d)\n", type_name, __FILE__, __LINE__);
+            return -1;
+        }
+        printf("Writing %s id %u, count %d\n", type_name, cams[c].config.id, cams[c].count);
+        fill_data_sample(&cams[c], instance);
+        retcode = typed_writer->write(*instance, DDS_HANDLE_NIL);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "write error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
+            typed_writer->discard_loan(*instance);
+        }
+        return 0;
+    });
+}
+
+/** ----------------------------------------------------------------
+ * publish_flat()
+ * Send the camera frames of a FlatData type (with or without Zero
+ * Copy): each sample is built in a buffer loaned from the writer, and
+ * goes back to it when it is written.
+ * returns 0, or -1 on error
+ **/
+template <typename T, typename TDataWriter>
+static int publish_flat(DDSDataWriter *writer, const char *type_name,
+    std::vector<cameraStream> &cams, int threadCount, int sample_count)
+{
+    TDataWriter *typed_writer = TDataWriter::narrow(writer);
+    if (typed_writer == NULL) {
+        fprintf(stderr, "DataWriter narrow error(%s:%d)\n", __FILE__, __LINE__);
+        return -1;
+    }
+
+    return run_cameras(cams, threadCount, sample_count, [&](int c) {
+        auto builder = rti::flat::build_data<T>(typed_writer);
+        if (builder.check_failure()) {
+            printf("builder creation error (%s:%d)\n", __FILE__, __LINE__);
+            return -1;
+        }
+
+        // Build the data sample using the builder
+        if (!build_data_sample(&cams[c], builder)) {
+            printf("error building the sample(%s:%d)\n", __FILE__, __LINE__);
+            return -1;
+        }
+
+        // Create the sample
+        T *instance = builder.finish_sample();
+        if (instance == NULL) {
+            printf("finish_sample() error(%s:%d)\n", __FILE__, __LINE__);
+            return -1;
+        }
+        printf("Writing %s id %u, count %d\n", type_name, cams[c].config.id, cams[c].count);
+
+        DDS_ReturnCode_t retcode = typed_writer->write(*instance, DDS_HANDLE_NIL);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "write error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
+            typed_writer->discard_loan(*instance);
+        }
+        return 0;
+    });
+}
 
 /** ----------------------------------------------------------------
  * publisher_main()
@@ -148,43 +452,51 @@ extern "C" int publisher_main(int sample_count)
     DDSPublisher *publisher = NULL;
     DDSTopic *topic = NULL;
     DDSDataWriter *writer = NULL;
-    CameraImage_CameraImageDataDataWriter * CameraImage_CameraImageData_writer = NULL;
-    CameraImage_CameraImageData *instance = NULL;
     DDS_ReturnCode_t retcode;
-    DDS_InstanceHandle_t instance_handle = DDS_HANDLE_NIL;
     const char *type_name = NULL;
     int domainId = 0;
-    int count = 0;
-    DDS_Duration_t send_period = {4,0};
+    int status = 0;
 
     /* Get the configurtion properties from the camera_image.properties file */
     PropertyUtil* prop = new PropertyUtil("camera_image.properties");
 
-    long time = prop->getLongProperty("config.pubInterval");
-    if (time) {
-        send_period.sec = time / 1000;
-        send_period.nanosec = (time % 1000) * 1000 * 1000;
+    domainId = prop->getLongProperty("config.domainId");
+
+    /* The cameras, each with its own id, frame size and interval, are sent
+    from config.pubThreads threads (0: one per camera, up to one per core) */
+    std::vector<cameraStreamConfig> streams;
+    cameraStreamsFromConfig(prop, streams);
+    std::vector<cameraStream> cams(streams.size());
+    for (size_t c = 0; c < streams.size(); c++) {
+        cams[c].config = streams[c];
+        cams[c].lfsr = LFSR_SEED;
+        cams[c].seqNum = 1;
+        cams[c].count = 0;
     }
+    int threadCount = (int)prop->getLongProperty("config.pubThreads");
+    if (threadCount <= 0) {
+        threadCount = (int)std::thread::hardware_concurrency();
+        if (threadCount <= 0) threadCount = 1;
+    }
+    if (threadCount > (int)cams.size()) threadCount = (int)cams.size();
 
-    domainId = prop->getLongProperty("config.domainId");
-    ddsId    = (uint32_t) prop->getLongProperty("config.ddsId");
-    if(ddsId == 0) ddsId = 404;
+    /* Large data mode: plain, flat, zerocopy or flatzerocopy */
+    cameraDataMode mode = cameraDataModeFromName(prop->getStringProperty("config.dataMode"));
+    const cameraModeInfo *modeInfo = cameraDataModeInfo(mode);
 
     std::string topicName = prop->getStringProperty("topic.Sensor");
     if (topicName == "") {
         printf("No topic name specified (%s:%d)\n", __FILE__, __LINE__);
         return -1;
     }
+    topicName += modeInfo->topicSuffix;
     std::string qosLibrary = prop->getStringProperty("qos.Library");
     if (qosLibrary == "") {
         printf("No QoS Library specified (%s:%d)\n", __FILE__, __LINE__);
         return -1;
     }
-#ifdef DDS_LARGE_DATA_FLAT_DATA
-    std::string qosProfile = prop->getStringProperty("qos.XCDR2Profile");
-#else
-    std::string qosProfile = prop->getStringProperty("qos.Profile");
-#endif
+    std::string qosProfile = prop->getStringProperty(
+        modeInfo->flatData ? "qos.XCDR2Profile" : "qos.Profile");
     if (qosProfile == "") {
         printf("No QoS Profile specified (%s:%d)\n", __FILE__, __LINE__);
         return -1;
@@ -210,10 +522,44 @@ extern "C" int publisher_main(int sample_count)
         return -1;
     }
 
-    // register and create topic
-    type_name = CameraImage_CameraImageDataTypeSupport::get_type_name();
-    retcode = CameraImage_CameraImageDataTypeSupport::register_type(
-        participant, type_name);
+    // register the type of the data mode and create topic
+    switch (mode) {
+    case CAMERA_DATA_FLAT:
+        type_name = CameraImage_CameraImageDataFlatTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataFlatTypeSupport::register_type(
+            participant, type_name);
+        break;
+    case CAMERA_DATA_ZERO_COPY:
+        type_name = CameraImage_CameraImageDataZeroCopyTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataZeroCopyTypeSupport::register_type(
+            participant, type_name);
+        break;
+    case CAMERA_DATA_FLAT_ZERO_COPY:
+        type_name = CameraImage_CameraImageDataFlatZeroCopyTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataFlatZeroCopyTypeSupport::register_type(
+            participant, type_name);
+        break;
+    case CAMERA_FRAME_PLAIN:
+        type_name = CameraImage_CameraImageFrameTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageFrameTypeSupport::register_type(
+            participant, type_name);
+        break;
+    case CAMERA_FRAME_FLAT:
+        type_name = CameraImage_CameraImageFrameFlatTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageFrameFlatTypeSupport::register_type(
+            participant, type_name);
+        break;
+    case CAMERA_FRAME_FLAT_ZERO_COPY:
+        type_name = CameraImage_CameraImageFrameFlatZeroCopyTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageFrameFlatZeroCopyTypeSupport::register_type(
+            participant, type_name);
+        break;
+    default:
+        type_name = CameraImage_CameraImageDataTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataTypeSupport::register_type(
+            participant, type_name);
+        break;
+    }
     if (retcode != DDS_RETCODE_OK) {
         fprintf(stderr, "register_type error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
         publisher_shutdown(participant);
@@ -239,115 +585,58 @@ extern "C" int publisher_main(int sample_count)
         publisher_shutdown(participant);
         return -1;
     }
-    CameraImage_CameraImageData_writer = CameraImage_CameraImageDataDataWriter::narrow(writer);
-    if (CameraImage_CameraImageData_writer == NULL) {
-        fprintf(stderr, "DataWriter narrow error(%s:%d)\n", __FILE__, __LINE__);
-        publisher_shutdown(participant);
-        return -1;
-    }
 
-#ifndef DDS_LARGE_DATA_FLAT_DATA
-#ifndef DDS_LARGE_DATA_ZERO_COPY
-    /* Create data sample for writing */
-    instance = CameraImage_CameraImageDataTypeSupport::create_data();
-    if (instance == NULL) {
-        fprintf(stderr, "CameraImage_CameraImageDataTypeSupport::create_data error(%s:%d)\n", __FILE__, __LINE__);
-        publisher_shutdown(participant);
-        return -1;
+    printf("start sending %s on %s (%s mode): %d cameras from %d threads\n",
+        type_name, topicName.c_str(), modeInfo->name, (int)cams.size(), threadCount);
+    for (size_t c = 0; c < cams.size(); c++) {
+        printf("  camera id %u: %dx%d (stride %d), %d bytes every %d mSec\n",
+            cams[c].config.id, cams[c].config.width, cams[c].config.height,
+            cams[c].config.stride, cams[c].config.frameSize, cams[c].config.interval);
     }
-
-    // CameraImageData type uses a @key; init and register it here
-    instance->id = ddsId;
-    instance_handle = CameraImage_CameraImageData_writer->register_instance(*instance);
-
-#endif	// ndef DDS_LARGE_DATA_ZERO_COPY
-#endif	// ndef DDS_LARGE_DATA_FLAT_DATA
-
-    printf("start sending\n");
     /* Main loop */
-    for (count=0; (sample_count == 0) || (count < sample_count); ++count) {
-#ifdef DDS_LARGE_DATA_FLAT_DATA
-        CameraImage_CameraImageDataBuilder builder = rti::flat::build_data<CameraImage_CameraImageData>(CameraImage_CameraImageData_writer);
-        if (builder.check_failure()) {
-            printf("builder creation error (%s:%d)\n", __FILE__, __LINE__);
-            publisher_shutdown(participant);
-            return -1;
-        }
-
-        // Build the CameraImage_CameraImageData data sample using the builder
-        if (!build_data_sample(builder)) {
-            printf("error building the sample(%s:%d)\n", __FILE__, __LINE__);
-            publisher_shutdown(participant);
-            return -1;
-        }
-
-        // Create the sample
-        CameraImage_CameraImageData *instance = builder.finish_sample();
-        if (instance == NULL) {
-            printf("finish_sample() error(%s:%d)\n", __FILE__, __LINE__);
-            publisher_shutdown(participant);
-            return -1;
-        }
-#endif 	// def DDS_LARGE_DATA_FLAT_DATA
-#ifdef DDS_LARGE_DATA_ZERO_COPY
-#ifndef DDS_LARGE_DATA_FLAT_DATA
-        /* Get a new sample before every write. This data sample can come from a
-        free sample or a previously written sample which is ready for reuse. */
-
-        retcode = CameraImage_CameraImageData_writer->get_loan(instance);
-        if (retcode != DDS_RETCODE_OK) {
-            fprintf(stderr, "CameraImage_CameraImageDataDataWriter_get_loan error(%s:%d)\n", __FILE__, __LINE__);
-            publisher_shutdown(participant);
-            return -1;
-        }
-#endif 	// ndef DDS_LARGE_DATA_FLAT_DATA
-#endif	//  def DDS_LARGE_DATA_ZERO_COPY
-        printf("Writing CameraImage_CameraImageData, count %d\n", count);
-
-#ifndef DDS_LARGE_DATA_FLAT_DATA
-        /* If not using Flat Data, Modify the data to be sent here */
-        for (int i = 0; i < MAX_IMAGE_SIZE; i+=4) {
-            uint32_t *lfsrVal = (uint32_t *)&instance->data[i];
-            *lfsrVal = lfsr;
-            lfsr = (lfsr >> 1) ^ (-(lfsr & 1u) & 0xD0000001u);
-        }
-        instance->seqnum = seqNum++;
-        uint64_t tNow = UtcNowPrecise();
-        instance->sec_ = (tNow / 1000000000);
-        instance->nanosec_ = (tNow % 1000000000);
-        //printf("tNow: %llu = %u.%u\n", tNow, instance->sec_, instance->nanosec_);
-
-
-#endif  // ndef DDS_LARGE_DATA_FLAT_DATA
-
-        retcode = CameraImage_CameraImageData_writer->write(*instance, instance_handle);
-        if (retcode != DDS_RETCODE_OK) {
-            fprintf(stderr, "write error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
-        }
-
-        NDDSUtility::sleep(send_period);
+    switch (mode) {
+    case CAMERA_DATA_FLAT:
+        status = publish_flat<CameraImage_CameraImageDataFlat,
+            CameraImage_CameraImageDataFlatDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
+    case CAMERA_DATA_ZERO_COPY:
+        status = publish_loaned<CameraImage_CameraImageDataZeroCopy,
+            CameraImage_CameraImageDataZeroCopyDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
+    case CAMERA_DATA_FLAT_ZERO_COPY:
+        status = publish_flat<CameraImage_CameraImageDataFlatZeroCopy,
+            CameraImage_CameraImageDataFlatZeroCopyDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
+    case CAMERA_FRAME_PLAIN:
+        status = publish_plain<CameraImage_CameraImageFrame,
+            CameraImage_CameraImageFrameTypeSupport, CameraImage_CameraImageFrameDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
+    case CAMERA_FRAME_FLAT:
+        status = publish_flat<CameraImage_CameraImageFrameFlat,
+            CameraImage_CameraImageFrameFlatDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
+    case CAMERA_FRAME_FLAT_ZERO_COPY:
+        status = publish_flat<CameraImage_CameraImageFrameFlatZeroCopy,
+            CameraImage_CameraImageFrameFlatZeroCopyDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
+    default:
+        status = publish_plain<CameraImage_CameraImageData,
+            CameraImage_CameraImageDataTypeSupport, CameraImage_CameraImageDataDataWriter>(
+            writer, type_name, cams, threadCount, sample_count);
+        break;
     }
 
-#ifndef DDS_LARGE_DATA_FLAT_DATA
-#ifndef DDS_LARGE_DATA_ZERO_COPY
-    /*
-    retcode = CameraImage_CameraImageData_writer->unregister_instance(
-        *instance, instance_handle);
-    if (retcode != DDS_RETCODE_OK) {
-        fprintf(stderr, "unregister instance error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
-    }
-    */
-
-    /* Delete data sample */
-    retcode = CameraImage_CameraImageDataTypeSupport::delete_data(instance);
-    if (retcode != DDS_RETCODE_OK) {
-        fprintf(stderr, "CameraImage_CameraImageDataTypeSupport::delete_data error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
-    }
-#endif // ndef DDS_LARGE_DATA_ZERO_COPY
-#endif // ndef DDS_LARGE_DATA_FLAT_DATA
-
     /* Delete all entities */
-    return publisher_shutdown(participant);
+    if (publisher_shutdown(participant) != 0) {
+        status = -1;
+    }
+    return status;
 }
 
 int main(int argc, char *argv[])
@@ -1,19 +1,23 @@
 /** ------------------------------------------------------------------------
  * CameraImageData_subscriber.cxx
  * Subscribes to fixed-frame data arrays of type "CameraImageData" defined in
- * automotive.idl file, with options for "Flat Data" optimizations to be
- * included (note: "Zero Copy" optimizations do not require changes in this file.
+ * automotive.idl file, or of its "Flat Data" / "Zero Copy" variants, or the
+ * variable-size "CameraImageFrame" types.
  *
  * The data is generated from an LFSR function in the publisher, and can optionally
  * be verified here in the subscriber.  Timestamps have also been included in the
  * published packets, these are used here in the subscriber to measure the transit
- * times of each optimization mode.
+ * times of each optimization mode: their percentiles are printed for each
+ * interval (config.statsInterval), and for the whole run on exit, when the
+ * histogram is also written to config.statsFile (.csv and .json).
+ * Each camera (instance id, see cameraStreams.h) has its own throughput,
+ * loss (from gaps in seqnum) and transit times, and the throughput of all
+ * of them is added up.  Stats and verification run in a worker thread,
+ * so the DDS receive thread only timestamps the frames and hands them over.
  *
  * TO USE THE DIFFERENT OPTIMIZATION MODES(FlatData, ZeroCopy, or both)
- *  1. Uncomment the required #define DDS_LARGE_DATA_*
- *     (in this file (below) and in the complementary publisher.cxx file)
- *  2. Uncomment the supporting lines in the automotive.idl file.
- *  3. Rebuild all.
+ *  Set config.dataMode in camera_image.properties to plain, flat, zerocopy
+ *  or flatzerocopy (the same as in the publisher); no rebuild is needed.
  *
  * (c) 2005-2019 Copyright, Real-Time Innovations, Inc.  All rights reserved.
  * RTI grants Licensee a license to use, modify, compile, and create derivative
@@ -26,8 +30,18 @@
  **/
 #include <stdio.h>
 #include <stdlib.h>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <thread>
+#include <vector>
 #include "dataObject.h"
 #include "Utils.h"
+#include "cameraMode.h"
+#include "latencyHistogram.h"
+#include "cameraStreams.h"
+#include "cameraLfsr.h"
+#include "spscQueue.h"
 #include "automotive.h"
 #include "automotiveSupport.h"
 #include "ndds/ndds_cpp.h"
@@ -36,9 +50,6 @@
 #include <Windows.h>
 #endif  // def _WIN32
 
-// uncomment if using FLAT_DATA
-//#define DDS_LARGE_DATA_FLAT_DATA
-
 #ifdef _WIN32
 // returns time in nanoSeconds
 uint64_t UtcNowPrecise()
@@ -63,8 +74,27 @@ uint64_t UtcNowPrecise()
 #endif  // def _WIN32
 
 
+template <typename T, typename TSeq, typename TDataReader>
+class CameraFrameCheckBatch;
+
+/** ----------------------------------------------------------------
+ * CameraImage_CameraImageDataListener
+ * Data listener of the CameraImageData type of the large data mode
+ * (T, its sequence TSeq and its reader TDataReader).
+ **/
+template <typename T, typename TSeq, typename TDataReader>
 class CameraImage_CameraImageDataListener : public DDSDataReaderListener {
+  private:
+    typedef CameraFrameCheckBatch<T, TSeq, TDataReader> checkBatch;
+    std::vector<checkBatch *> _batches;     // all of them, made up front
+    std::vector<checkBatch *> _free;        // to take() into
+    std::map<uint32_t, uint64_t> _frames;   // frames of each camera, to sample verification
+    std::map<uint32_t, uint32_t> _dropped;  // records of each camera dropped since its last one queued
+
   public:
+    CameraImage_CameraImageDataListener(int batches);
+    virtual ~CameraImage_CameraImageDataListener();
+
     virtual void on_requested_deadline_missed(
         DDSDataReader* /*reader*/,
         const DDS_RequestedDeadlineMissedStatus& /*status*/) {}
@@ -92,119 +122,612 @@ class CameraImage_CameraImageDataListener : public DDSDataReaderListener {
     virtual void on_data_available(DDSDataReader* reader);
 };
 
+/** ----------------------------------------------------------------
+ * streamStats
+ * what has been received of one camera (instance id): frames, bytes,
+ * frames lost (gaps in seqnum) and frames received but not counted (the
+ * record queue was full), and the transit time histograms, for the
+ * whole run and since the last interval snapshot.
+ **/
+typedef struct {
+    uint32_t            id;
+    bool                started;
+    uint32_t            lastSeq;
+    uint64_t            frames;
+    uint64_t            bytes;
+    uint64_t            lost;
+    uint64_t            dropped;
+    uint64_t            intervalFrames;
+    uint64_t            intervalBytes;
+    uint64_t            intervalLost;
+    uint64_t            intervalDropped;
+    LatencyHistogram    transitTotal;
+    LatencyHistogram    transitInterval;
+} streamStats;
+
+static std::map<uint32_t, streamStats> streams;
+static std::map<uint32_t, int> streamFrameSizes;    // from the configuration
+static LatencyHistogram transitTotal;               // all the cameras
+static uint64_t tIntervalStart = 0;
+static uint64_t tStatsInterval = 10000000000ull;    // ns, config.statsInterval
+static int verifyEvery = 1;                         // config.verifyEvery (0: never)
+
+#define FRAME_RECORDS_MAX   (4096)  // frames received, waiting for the stats
+
+/** ----------------------------------------------------------------
+ * frameSizeOf()
+ * the image bytes to verify of camera 'id': its configured frame size,
+ * or the full MAX_IMAGE_SIZE for cameras not in the configuration.
+ **/
+static int frameSizeOf(uint32_t id)
+{
+    std::map<uint32_t, int>::const_iterator size = streamFrameSizes.find(id);
+    return (size != streamFrameSizes.end()) ? size->second : MAX_IMAGE_SIZE;
+}
+
+/** ----------------------------------------------------------------
+ * streamOf()
+ * the stats of camera 'id', made on its first frame.
+ **/
+static streamStats *streamOf(uint32_t id)
+{
+    std::map<uint32_t, streamStats>::iterator it = streams.find(id);
+    if (it == streams.end()) {
+        streamStats &stats = streams[id];
+        stats.id = id;
+        stats.started = false;
+        stats.lastSeq = 0;
+        stats.frames = stats.bytes = stats.lost = stats.dropped = 0;
+        stats.intervalFrames = stats.intervalBytes = stats.intervalLost = stats.intervalDropped = 0;
+        return &stats;
+    }
+    return &it->second;
+}
+
+/** ----------------------------------------------------------------
+ * printStreams()
+ * print each camera's frames, throughput, loss, frames not counted and
+ * transit times, then
+ * the throughput of all the cameras together, over 'tSpan' nSec:
+ * of the last interval, or of the whole run ('total').
+ **/
+static void printStreams(uint64_t tSpan, bool total)
+{
+    double seconds = (double)tSpan / 1000000000;
+    uint64_t allFrames = 0;
+    uint64_t allBytes = 0;
+    uint64_t allLost = 0;
+    uint64_t allDropped = 0;
+    if (seconds <= 0) seconds = 1;
+
+    for (std::map<uint32_t, streamStats>::iterator it = streams.begin(); it != streams.end(); ++it) {
+        streamStats &stats = it->second;
+        uint64_t frames = total ? stats.frames : stats.intervalFrames;
+        uint64_t bytes = total ? stats.bytes : stats.intervalBytes;
+        uint64_t lost = total ? stats.lost : stats.intervalLost;
+        uint64_t dropped = total ? stats.dropped : stats.intervalDropped;
+        char label[160];
+        snprintf(label, sizeof(label), "%s id %u: %3.1f fps %3.3f MB/s lost %llu not counted %llu,",
+            total ? "total" : "interval", stats.id, frames / seconds,
+            ((double)bytes / seconds) / 1000000, (unsigned long long)lost,
+            (unsigned long long)dropped);
+        (total ? stats.transitTotal : stats.transitInterval).print(stdout, label);
+        allFrames += frames;
+        allBytes += bytes;
+        allLost += lost;
+        allDropped += dropped;
+    }
+    fprintf(stdout, "%s all %d cameras: %3.1f fps %3.3f MB/s lost %llu not counted %llu\n",
+        total ? "total" : "interval", (int)streams.size(), allFrames / seconds,
+        ((double)allBytes / seconds) / 1000000, (unsigned long long)allLost,
+        (unsigned long long)allDropped);
+}
+
 /** ----------------------------------------------------------------
  * calcAndPrintTransitTime()
- * given a send timestamp and a receive timestamp, calculate and print
- * the timing stats and sample counter.
+ * given a camera's frame (seqnum and size), the frames of that camera
+ * received just before it but not queued for the stats ('dropped'), its
+ * send timestamp and its receive timestamp, count it and add its transit
+ * time to the histograms,
+ * and print the stats of the last interval when it is over (every sample
+ * if config.statsInterval is 0).
  **/
-void calcAndPrintTransitTime(uint64_t tSend, uint64_t tReceive)
-{
-    static uint64_t tMin = (uint64_t)-1;
-    static uint64_t tMax = 0;
-    static uint64_t tSum = 0;
-    static uint32_t tSampleCount = 0;
-
-    uint32_t tDelta = tReceive - tSend;
-    if (tDelta < tMin)
-        tMin = tDelta;
-    if (tDelta > tMax)
-        tMax = tDelta;
-    tSum += tDelta;
-    tSampleCount++;
-    double tAvg = (((double)tSum / tSampleCount) / 1000000000);
-    fprintf(stdout, "tNow: %2.7f tMin: %2.7f tMax: %2.7f, tAvg: %2.7f N:%u size:%u (%3.3f MB/s avg)\n",
-        ((double)tDelta / 1000000000),
-        ((double)tMin / 1000000000),
-        ((double)tMax / 1000000000),
-        tAvg, tSampleCount, MAX_IMAGE_SIZE,
-        ((double)MAX_IMAGE_SIZE / tAvg) / 1000000);
+void calcAndPrintTransitTime(streamStats *stats, uint32_t seqnum, uint32_t dropped,
+    uint64_t bytes, uint64_t tSend, uint64_t tReceive)
+{
+    // frames lost: the gap in seqnum since the last one, less the frames
+    // received but dropped from the record queue (a smaller seqnum is a
+    // restarted publisher)
+    stats->dropped += dropped;
+    stats->intervalDropped += dropped;
+    if (stats->started && (seqnum > stats->lastSeq + 1 + dropped)) {
+        uint64_t lost = seqnum - stats->lastSeq - 1 - dropped;
+        stats->lost += lost;
+        stats->intervalLost += lost;
+    }
+    stats->started = true;
+    stats->lastSeq = seqnum;
+    stats->frames++;
+    stats->intervalFrames++;
+    stats->bytes += bytes;
+    stats->intervalBytes += bytes;
+
+    // kept in 64 bits: a 32-bit count of nanoseconds wraps at 4.29 s
+    uint64_t tDelta = (tReceive > tSend) ? (tReceive - tSend) : 0;
+    stats->transitTotal.record(tDelta);
+    stats->transitInterval.record(tDelta);
+    transitTotal.record(tDelta);
+
+    if (tIntervalStart == 0) {
+        tIntervalStart = tReceive;
+    }
+    if ((tReceive - tIntervalStart) >= tStatsInterval) {
+        printStreams(tReceive - tIntervalStart, false);
+        for (std::map<uint32_t, streamStats>::iterator it = streams.begin(); it != streams.end(); ++it) {
+            it->second.transitInterval.reset();
+            it->second.intervalFrames = it->second.intervalBytes = 0;
+            it->second.intervalLost = it->second.intervalDropped = 0;
+        }
+        tIntervalStart = tReceive;
+    }
     return;
 }
 
 /** ----------------------------------------------------------------
  * checkLfsrDataInArray()
  * Check the u32 data in array for correct LFSR sequence, based on
- * value in position [0].  Scan until MAX_IMAGE_SIZE
+ * value in position [0].  Scan the whole words of 'size' bytes
  * returns true if no error
  **/
-bool checkLfsrDataInArray(uint32_t *lfsrArray)
-{
-    uint32_t lfsr = *lfsrArray;
-    for (int j = 4; j < MAX_IMAGE_SIZE; j += 4) {
-        lfsrArray++;
-        lfsr = (lfsr >> 1) ^ (-(lfsr & 1u) & 0xD0000001u);
-        if (lfsr != *lfsrArray) {
-            fprintf(stderr, "Image data received != sent [%08x != %08x] at %s:%d\n", *lfsrArray, lfsr, __FILE__, __LINE__);
-            return false;
-        }
+bool checkLfsrDataInArray(uint32_t *lfsrArray, int size)
+{
+    int bad = lfsrCheck(lfsrArray, size / 4);
+    if (bad >= 0) {
+        fprintf(stderr, "Image data received != sent [%08x != %08x] at word %d, %s:%d\n",
+            lfsrArray[bad], lfsrJump(lfsrArray[0], bad), bad, __FILE__, __LINE__);
+        return false;
     }
     return true;
 }
 
+/** ----------------------------------------------------------------
+ * sampleId(), sampleSeqnum(), sampleSendTime(), sampleData(), sampleBytes(),
+ * sampleImageBytes()
+ * get the camera id, seqnum, send-timestamp (in nanoseconds), image data,
+ * bytes carried and bytes of image (to verify) of a received sample:
+ * plain and Zero Copy samples are read directly, FlatData samples through
+ * their root.  Fixed-size samples carry MAX_IMAGE_SIZE bytes, of which the
+ * camera's configured frame size is image; variable-size frames carry
+ * only their image.
+ **/
+template <typename T>
+static uint32_t sampleId(T &sample)
+{
+    return sample.id;
+}
+
+template <typename T>
+static uint32_t sampleSeqnum(T &sample)
+{
+    return sample.seqnum;
+}
+
+template <typename T>
+static uint64_t sampleSendTime(T &sample)
+{
+    return (((uint64_t)sample.sec_) * 1000000000) + sample.nanosec_;
+}
+
+template <typename T>
+static uint64_t sampleBytes(T & /*sample*/)
+{
+    return MAX_IMAGE_SIZE;
+}
+
+template <typename T>
+static int sampleImageBytes(T & /*sample*/, int frameSize)
+{
+    return frameSize;
+}
+
+template <typename T>
+static uint32_t *sampleData(T &sample)
+{
+    return (uint32_t *)&sample.data[0];
+}
+
+template <typename TOffset>
+static uint64_t flatSampleSendTime(TOffset sample_root)
+{
+    return (((uint64_t)sample_root.sec_()) * 1000000000) + sample_root.nanosec_();
+}
+
+template <typename TOffset>
+static uint32_t *flatSampleData(TOffset sample_root)
+{
+    auto data_array = rti::flat::plain_cast(sample_root.data());
+    return (uint32_t *)&data_array[0];
+}
+
+static uint32_t sampleId(CameraImage_CameraImageDataFlat &sample)
+{
+    return sample.root().id();
+}
+
+static uint32_t sampleSeqnum(CameraImage_CameraImageDataFlat &sample)
+{
+    return sample.root().seqnum();
+}
+
+static uint64_t sampleSendTime(CameraImage_CameraImageDataFlat &sample)
+{
+    return flatSampleSendTime(sample.root());
+}
+
+static uint32_t *sampleData(CameraImage_CameraImageDataFlat &sample)
+{
+    return flatSampleData(sample.root());
+}
+
+static uint32_t sampleId(CameraImage_CameraImageDataFlatZeroCopy &sample)
+{
+    return sample.root().id();
+}
+
+static uint32_t sampleSeqnum(CameraImage_CameraImageDataFlatZeroCopy &sample)
+{
+    return sample.root().seqnum();
+}
+
+static uint64_t sampleSendTime(CameraImage_CameraImageDataFlatZeroCopy &sample)
+{
+    return flatSampleSendTime(sample.root());
+}
+
+static uint32_t *sampleData(CameraImage_CameraImageDataFlatZeroCopy &sample)
+{
+    return flatSampleData(sample.root());
+}
+
+static uint64_t sampleBytes(CameraImage_CameraImageFrame &sample)
+{
+    return sample.data.length();
+}
+
+static int sampleImageBytes(CameraImage_CameraImageFrame &sample, int /*frameSize*/)
+{
+    return sample.data.length();
+}
+
+template <typename TOffset>
+static int flatFrameBytes(TOffset sample_root)
+{
+    return (int)sample_root.data().element_count();
+}
+
+static uint32_t sampleId(CameraImage_CameraImageFrameFlat &sample)
+{
+    return sample.root().id();
+}
+
+static uint32_t sampleSeqnum(CameraImage_CameraImageFrameFlat &sample)
+{
+    return sample.root().seqnum();
+}
+
+static uint64_t sampleSendTime(CameraImage_CameraImageFrameFlat &sample)
+{
+    return flatSampleSendTime(sample.root());
+}
+
+static uint32_t *sampleData(CameraImage_CameraImageFrameFlat &sample)
+{
+    return flatSampleData(sample.root());
+}
+
+static uint64_t sampleBytes(CameraImage_CameraImageFrameFlat &sample)
+{
+    return flatFrameBytes(sample.root());
+}
+
+static int sampleImageBytes(CameraImage_CameraImageFrameFlat &sample, int /*frameSize*/)
+{
+    return flatFrameBytes(sample.root());
+}
+
+static uint32_t sampleId(CameraImage_CameraImageFrameFlatZeroCopy &sample)
+{
+    return sample.root().id();
+}
+
+static uint32_t sampleSeqnum(CameraImage_CameraImageFrameFlatZeroCopy &sample)
+{
+    return sample.root().seqnum();
+}
+
+static uint64_t sampleSendTime(CameraImage_CameraImageFrameFlatZeroCopy &sample)
+{
+    return flatSampleSendTime(sample.root());
+}
+
+static uint32_t *sampleData(CameraImage_CameraImageFrameFlatZeroCopy &sample)
+{
+    return flatSampleData(sample.root());
+}
+
+static uint64_t sampleBytes(CameraImage_CameraImageFrameFlatZeroCopy &sample)
+{
+    return flatFrameBytes(sample.root());
+}
+
+static int sampleImageBytes(CameraImage_CameraImageFrameFlatZeroCopy &sample, int /*frameSize*/)
+{
+    return flatFrameBytes(sample.root());
+}
+
+/** ----------------------------------------------------------------
+ * sampleIsConsistent()
+ * Zero Copy samples are read in the publisher's shared memory: check
+ * that it has not reused the sample while it was being read here.
+ * Other samples are always consistent.
+ **/
+template <typename T, typename TDataReader>
+static bool sampleIsConsistent(TDataReader * /*reader*/, T & /*sample*/, const DDS_SampleInfo & /*info*/)
+{
+    return true;
+}
+
+template <typename T, typename TDataReader>
+static bool zeroCopySampleIsConsistent(TDataReader *reader, T &sample, const DDS_SampleInfo &info)
+{
+    DDS_Boolean is_consistent = DDS_BOOLEAN_FALSE;
+    DDS_ReturnCode_t retcode = reader->is_data_consistent(is_consistent, &sample, &info);
+    return ((retcode == DDS_RETCODE_OK) && is_consistent);
+}
+
+static bool sampleIsConsistent(CameraImage_CameraImageDataZeroCopyDataReader *reader,
+    CameraImage_CameraImageDataZeroCopy &sample, const DDS_SampleInfo &info)
+{
+    return zeroCopySampleIsConsistent(reader, sample, info);
+}
+
+static bool sampleIsConsistent(CameraImage_CameraImageDataFlatZeroCopyDataReader *reader,
+    CameraImage_CameraImageDataFlatZeroCopy &sample, const DDS_SampleInfo &info)
+{
+    return zeroCopySampleIsConsistent(reader, sample, info);
+}
+
+static bool sampleIsConsistent(CameraImage_CameraImageFrameFlatZeroCopyDataReader *reader,
+    CameraImage_CameraImageFrameFlatZeroCopy &sample, const DDS_SampleInfo &info)
+{
+    return zeroCopySampleIsConsistent(reader, sample, info);
+}
+
+/** ----------------------------------------------------------------
+ * frameRecord
+ * what the listener keeps of each received frame for the stats worker
+ **/
+typedef struct {
+    uint32_t    id;
+    uint32_t    seqnum;
+    uint32_t    dropped;    // records of this camera dropped just before this one
+    uint64_t    bytes;
+    uint64_t    tSend;
+    uint64_t    tReceive;
+} frameRecord;
+
+/** ----------------------------------------------------------------
+ * FrameCheckBatch
+ * the frames of one take() to verify, with their loan: the worker
+ * checks them, returns the loan, and hands the batch back to the
+ * listener for another take().
+ **/
+class FrameCheckBatch {
+public:
+    virtual ~FrameCheckBatch() {}
+    virtual void check(void) = 0;
+};
+
+// listener -> worker handoff
+static SpscQueue<frameRecord> *frameRecords = NULL;
+static SpscQueue<FrameCheckBatch *> *frameChecks = NULL;
+// worker -> listener: the batches checked, to reuse
+static SpscQueue<FrameCheckBatch *> *frameChecksDone = NULL;
+static std::atomic<uint64_t> recordsDropped(0);     // record queue full: not in the stats
+static std::atomic<uint64_t> checksSkipped(0);      // check queue full: not verified
+// worker only
+static uint64_t framesChecked = 0;
+static uint64_t framesBad = 0;
+static uint64_t framesInconsistent = 0;
+
+template <typename T, typename TSeq, typename TDataReader>
+class CameraFrameCheckBatch : public FrameCheckBatch {
+public:
+    TDataReader         *reader;
+    TSeq                data_seq;
+    DDS_SampleInfoSeq   info_seq;
+    bool                loaned;
+    std::vector<std::pair<int, int> > frames;   // sample index, image bytes
+
+    CameraFrameCheckBatch() : reader(NULL), loaned(false) {}
+    virtual ~CameraFrameCheckBatch() { returnLoan(); }
+
+    void returnLoan(void)
+    {
+        if (loaned) {
+            DDS_ReturnCode_t retcode = reader->return_loan(data_seq, info_seq);
+            if (retcode != DDS_RETCODE_OK) {
+                fprintf(stderr, "return loan error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
+            }
+            loaned = false;
+        }
+        frames.clear();
+    }
+
+    virtual void check(void)
+    {
+        for (size_t f = 0; f < frames.size(); f++) {
+            T &sample = data_seq[frames[f].first];
+            if (!checkLfsrDataInArray(sampleData(sample), frames[f].second)) {
+                framesBad++;
+            }
+            if (!sampleIsConsistent(reader, sample, info_seq[frames[f].first])) {
+                fprintf(stderr, "sample was reused by the writer while being read (%s:%d)\n", __FILE__, __LINE__);
+                framesInconsistent++;
+            }
+            framesChecked++;
+        }
+        returnLoan();
+    }
+};
+
+/** ----------------------------------------------------------------
+ * statsWorker()
+ * the stats and verification of the received frames, off the DDS
+ * receive thread.  Runs until 'stop' is set and both queues are empty.
+ **/
+static void statsWorker(std::atomic<bool> *stop)
+{
+    for (;;) {
+        bool idle = true;
+        frameRecord record;
+        while (frameRecords->pop(record)) {
+            idle = false;
+            calcAndPrintTransitTime(streamOf(record.id), record.seqnum, record.dropped,
+                record.bytes, record.tSend, record.tReceive);
+        }
+        FrameCheckBatch *batch = NULL;
+        if (frameChecks->pop(batch)) {
+            idle = false;
+            batch->check();
+            frameChecksDone->push(batch);   // holds every batch: never full
+        }
+        if (idle) {
+            if (*stop) {
+                break;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+/** ----------------------------------------------------------------
+ * CameraImage_CameraImageDataListener()
+ * 'batches' check batches go round between the listener and the stats
+ * worker, so the receive thread does not allocate them per take().
+ **/
+template <typename T, typename TSeq, typename TDataReader>
+CameraImage_CameraImageDataListener<T, TSeq, TDataReader>::CameraImage_CameraImageDataListener(int batches)
+{
+    _batches.reserve(batches);
+    _free.reserve(batches);
+    for (int b = 0; b < batches; b++) {
+        _batches.push_back(new checkBatch());
+        _free.push_back(_batches.back());
+    }
+}
+
+template <typename T, typename TSeq, typename TDataReader>
+CameraImage_CameraImageDataListener<T, TSeq, TDataReader>::~CameraImage_CameraImageDataListener()
+{
+    for (size_t b = 0; b < _batches.size(); b++) {
+        delete _batches[b];
+    }
+}
+
 /** ----------------------------------------------------------------
  * on_data_available()
  * Data listener -- called when new data has been received.
+ * Only timestamps the frames and hands them to the stats worker: the
+ * frames to verify go with their loan, which the worker returns.
  **/
-void CameraImage_CameraImageDataListener::on_data_available(DDSDataReader* reader)
+template <typename T, typename TSeq, typename TDataReader>
+void CameraImage_CameraImageDataListener<T, TSeq, TDataReader>::on_data_available(DDSDataReader* reader)
 {
-    CameraImage_CameraImageDataDataReader *CameraImage_CameraImageData_reader = NULL;
-    CameraImage_CameraImageDataSeq data_seq;
-    DDS_SampleInfoSeq info_seq;
+    TDataReader *CameraImage_CameraImageData_reader = NULL;
     DDS_ReturnCode_t retcode;
     int i;
 
-    CameraImage_CameraImageData_reader = CameraImage_CameraImageDataDataReader::narrow(reader);
+    CameraImage_CameraImageData_reader = TDataReader::narrow(reader);
     if (CameraImage_CameraImageData_reader == NULL) {
         fprintf(stderr, "DataReader narrow error(%s:%d)\n", __FILE__, __LINE__);
         return;
     }
 
+    // take into a check batch, so the frames to verify can keep their loan;
+    // the worker hands the batches back once they are checked
+    FrameCheckBatch *done = NULL;
+    while (frameChecksDone->pop(done)) {
+        _free.push_back(static_cast<checkBatch *>(done));
+    }
+    if (_free.empty()) {
+        // there is one batch more than the check queue and the worker hold
+        fprintf(stderr, "no free check batch (%s:%d)\n", __FILE__, __LINE__);
+        return;
+    }
+    checkBatch *batch = _free.back();
+    _free.pop_back();
+    batch->reader = CameraImage_CameraImageData_reader;
+    TSeq &data_seq = batch->data_seq;
+    DDS_SampleInfoSeq &info_seq = batch->info_seq;
+
     retcode = CameraImage_CameraImageData_reader->take(
         data_seq, info_seq, DDS_LENGTH_UNLIMITED,
         DDS_ANY_SAMPLE_STATE, DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE);
 
     if (retcode == DDS_RETCODE_NO_DATA) {
+        _free.push_back(batch);
         return;
     } else if (retcode != DDS_RETCODE_OK) {
         fprintf(stderr, "take error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
+        _free.push_back(batch);
         return;
     }
+    batch->loaned = true;
 
     for (i = 0; i < data_seq.length(); ++i) {
         if (info_seq[i].valid_data) {
             // get the current time value
             uint64_t tReceive = UtcNowPrecise();
 
-#ifdef DDS_LARGE_DATA_FLAT_DATA
-            // get the root to the Flat Data sample
-            CameraImage_CameraImageDataOffset sample_root = data_seq[i].root();
-
-            // get the send-timestamp value from the received packet
-            uint64_t tSend = (((uint64_t)sample_root.sec_()) * 1000000000) + sample_root.nanosec_();
-
-            // verify the contents of the received data (optional)
-            auto data_array = rti::flat::plain_cast(sample_root.data());
-            uint32_t *rcvBuffer = (uint32_t *)&data_array[0];
-            checkLfsrDataInArray(rcvBuffer);
-
-#else  // ndef DDS_LARGE_DATA_FLAT_DATA
-            // get the send-timestamp value from the received packet
-            uint64_t tSend = (((uint64_t)data_seq[i].sec_) * 1000000000) + data_seq[i].nanosec_;
-
-            // verify the contents of the received data (optional)
-            uint32_t *rcvBuffer = (uint32_t *) &data_seq[i].data[0];
-            checkLfsrDataInArray(rcvBuffer);
-
-#endif  // ndef DDS_LARGE_DATA_FLAT_DATA
-            // print the transit timing
-            calcAndPrintTransitTime(tSend, tReceive);
+            // the camera, seqnum, size and send-timestamp, for the stats
+            frameRecord record;
+            record.id = sampleId(data_seq[i]);
+            record.seqnum = sampleSeqnum(data_seq[i]);
+            record.bytes = sampleBytes(data_seq[i]);
+            record.tSend = sampleSendTime(data_seq[i]);
+            record.tReceive = tReceive;
+            // a record dropped (queue full) goes with the camera's next one,
+            // so that its seqnum is not counted as lost
+            uint32_t &dropped = _dropped[record.id];
+            record.dropped = dropped;
+            if (frameRecords->push(record)) {
+                dropped = 0;
+            } else {
+                dropped++;
+                recordsDropped++;
+            }
+
+            // verify the contents of the received data (optional: one frame
+            // in config.verifyEvery of each camera)
+            if ((verifyEvery > 0) && ((_frames[record.id]++ % verifyEvery) == 0)) {
+                int imageBytes = sampleImageBytes(data_seq[i], frameSizeOf(record.id));
+                if (imageBytes >= 4) {
+                    batch->frames.push_back(std::make_pair(i, imageBytes));
+                }
+            }
         }
     }
 
-    retcode = CameraImage_CameraImageData_reader->return_loan(data_seq, info_seq);
-    if (retcode != DDS_RETCODE_OK) {
-        fprintf(stderr, "return loan error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
+    // the worker verifies the frames, then returns the loan
+    if (!batch->frames.empty()) {
+        if (frameChecks->push(batch)) {
+            return;
+        }
+        checksSkipped += batch->frames.size();
     }
+    batch->returnLoan();
+    _free.push_back(batch);
 }
 
 /* Delete all entities */
@@ -251,7 +774,7 @@ static int subscriber_shutdown(
     DDSDomainParticipant *participant = NULL;
     DDSSubscriber *subscriber = NULL;
     DDSTopic *topic = NULL;
-    CameraImage_CameraImageDataListener *reader_listener = NULL;
+    DDSDataReaderListener *reader_listener = NULL;
     DDSDataReader *reader = NULL;
     DDS_ReturnCode_t retcode;
     const char *type_name = NULL;
@@ -271,21 +794,55 @@ static int subscriber_shutdown(
 
     domainId = prop->getLongProperty("config.domainId");
 
+    /* Transit time snapshots every config.statsInterval mSec, and the
+    histogram of the run written to <config.statsFile>_<mode>.csv/.json */
+    std::string statsInterval = prop->getStringProperty("config.statsInterval");
+    if (statsInterval != "") {
+        tStatsInterval = (uint64_t)prop->getLongProperty("config.statsInterval") * 1000000;
+    }
+    std::string statsFile = prop->getStringProperty("config.statsFile");
+
+    /* Verify one frame in config.verifyEvery of each camera (0: none) */
+    if (prop->getStringProperty("config.verifyEvery") != "") {
+        verifyEvery = (int)prop->getLongProperty("config.verifyEvery");
+    }
+
+    /* Listener to worker queues: config.verifyQueue takes (with their loans)
+    waiting to be verified; when it is full, frames are not verified.
+    The check batches are made once: as many as the queue holds, one for
+    the worker and one for the listener, and go back to the listener
+    once checked */
+    int verifyQueue = (int)prop->getLongProperty("config.verifyQueue");
+    if (verifyQueue <= 0) verifyQueue = 8;
+    frameChecks = new SpscQueue<FrameCheckBatch *>(verifyQueue);
+    int checkBatches = (int)frameChecks->capacity() + 2;
+    frameChecksDone = new SpscQueue<FrameCheckBatch *>(checkBatches);
+    frameRecords = new SpscQueue<frameRecord>(FRAME_RECORDS_MAX);
+
+    /* The frame size of each camera, to verify its frames */
+    std::vector<cameraStreamConfig> streamConfigs;
+    cameraStreamsFromConfig(prop, streamConfigs);
+    for (size_t c = 0; c < streamConfigs.size(); c++) {
+        streamFrameSizes[streamConfigs[c].id] = streamConfigs[c].frameSize;
+    }
+
+    /* Large data mode: plain, flat, zerocopy or flatzerocopy */
+    cameraDataMode mode = cameraDataModeFromName(prop->getStringProperty("config.dataMode"));
+    const cameraModeInfo *modeInfo = cameraDataModeInfo(mode);
+
     std::string topicName = prop->getStringProperty("topic.Sensor");
     if (topicName == "") {
         printf("No topic name specified (%s:%d)\n", __FILE__, __LINE__);
         return -1;
     }
+    topicName += modeInfo->topicSuffix;
     std::string qosLibrary = prop->getStringProperty("qos.Library");
     if (qosLibrary == "") {
         printf("No QoS Library specified (%s:%d)\n", __FILE__, __LINE__);
         return -1;
     }
-#ifdef DDS_LARGE_DATA_FLAT_DATA
-    std::string qosProfile = prop->getStringProperty("qos.XCDR2Profile");
-#else
-    std::string qosProfile = prop->getStringProperty("qos.Profile");
-#endif  // def DDS_LARGE_DATA_FLAT_DATA
+    std::string qosProfile = prop->getStringProperty(
+        modeInfo->flatData ? "qos.XCDR2Profile" : "qos.Profile");
     if (qosProfile == "") {
         printf("No QoS Profile specified (%s:%d)\n", __FILE__, __LINE__);
         return -1;
@@ -313,15 +870,65 @@ static int subscriber_shutdown(
         return -1;
     }
 
-    // register the type and create the topic
-    type_name = CameraImage_CameraImageDataTypeSupport::get_type_name();
-    retcode = CameraImage_CameraImageDataTypeSupport::register_type(
-        participant, type_name);
+    // register the type of the data mode, and make its listener
+    switch (mode) {
+    case CAMERA_DATA_FLAT:
+        type_name = CameraImage_CameraImageDataFlatTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataFlatTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageDataFlat,
+            CameraImage_CameraImageDataFlatSeq, CameraImage_CameraImageDataFlatDataReader>(checkBatches);
+        break;
+    case CAMERA_DATA_ZERO_COPY:
+        type_name = CameraImage_CameraImageDataZeroCopyTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataZeroCopyTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageDataZeroCopy,
+            CameraImage_CameraImageDataZeroCopySeq, CameraImage_CameraImageDataZeroCopyDataReader>(checkBatches);
+        break;
+    case CAMERA_DATA_FLAT_ZERO_COPY:
+        type_name = CameraImage_CameraImageDataFlatZeroCopyTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataFlatZeroCopyTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageDataFlatZeroCopy,
+            CameraImage_CameraImageDataFlatZeroCopySeq, CameraImage_CameraImageDataFlatZeroCopyDataReader>(checkBatches);
+        break;
+    case CAMERA_FRAME_PLAIN:
+        type_name = CameraImage_CameraImageFrameTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageFrameTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageFrame,
+            CameraImage_CameraImageFrameSeq, CameraImage_CameraImageFrameDataReader>(checkBatches);
+        break;
+    case CAMERA_FRAME_FLAT:
+        type_name = CameraImage_CameraImageFrameFlatTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageFrameFlatTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageFrameFlat,
+            CameraImage_CameraImageFrameFlatSeq, CameraImage_CameraImageFrameFlatDataReader>(checkBatches);
+        break;
+    case CAMERA_FRAME_FLAT_ZERO_COPY:
+        type_name = CameraImage_CameraImageFrameFlatZeroCopyTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageFrameFlatZeroCopyTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageFrameFlatZeroCopy,
+            CameraImage_CameraImageFrameFlatZeroCopySeq, CameraImage_CameraImageFrameFlatZeroCopyDataReader>(checkBatches);
+        break;
+    default:
+        type_name = CameraImage_CameraImageDataTypeSupport::get_type_name();
+        retcode = CameraImage_CameraImageDataTypeSupport::register_type(
+            participant, type_name);
+        reader_listener = new CameraImage_CameraImageDataListener<CameraImage_CameraImageData,
+            CameraImage_CameraImageDataSeq, CameraImage_CameraImageDataDataReader>(checkBatches);
+        break;
+    }
     if (retcode != DDS_RETCODE_OK) {
         fprintf(stderr, "register_type error %d (%s:%d)\n", retcode, __FILE__, __LINE__);
         subscriber_shutdown(participant);
+        delete reader_listener;
         return -1;
     }
+    // create the topic
     topic = participant->create_topic_with_profile(
         topicName.c_str(),
         type_name, qosLibrary.c_str(), qosProfile.c_str(), NULL /* listener */,
@@ -329,11 +936,11 @@ static int subscriber_shutdown(
     if (topic == NULL) {
         fprintf(stderr, "create_topic error(%s:%d)\n", __FILE__, __LINE__);
         subscriber_shutdown(participant);
+        delete reader_listener;
         return -1;
     }
 
-    // create a data reader listener and datareader
-    reader_listener = new CameraImage_CameraImageDataListener();
+    // create the datareader
     reader = subscriber->create_datareader_with_profile(
         topic, qosLibrary.c_str(), qosProfile.c_str(), reader_listener,
         DDS_STATUS_MASK_ALL & ~~DDS_DATA_AVAILABLE_STATUS);
@@ -344,16 +951,43 @@ static int subscriber_shutdown(
         return -1;
     }
 
-    printf("Start Receiving\n");
+    /* Stats and verification run in their own thread: the listener only
+    timestamps the frames and hands them over */
+    std::atomic<bool> workerStop(false);
+    std::thread worker(statsWorker, &workerStop);
+
+    printf("Start Receiving %s on %s (%s mode)\n", type_name, topicName.c_str(), modeInfo->name);
     /* Main loop */
+    uint64_t tRunStart = UtcNowPrecise();
     for (count=0; (sample_count == 0) || (count < sample_count); ++count) {
         NDDSUtility::sleep(receive_period);
     }
+    uint64_t tRunEnd = UtcNowPrecise();
+
+    /* Stop the listener, then let the worker finish (and return all loans)
+    before the reader is deleted */
+    reader->set_listener(NULL, DDS_STATUS_MASK_NONE);
+    workerStop = true;
+    worker.join();
+    statsWorker(&workerStop);
 
     /* Delete all entities */
     status = subscriber_shutdown(participant);
     delete reader_listener;
 
+    /* Throughput, loss and transit times of the whole run */
+    printStreams(tRunEnd - tRunStart, true);
+    transitTotal.print(stdout, "total all cameras:");
+    printf("verified %llu frames: %llu bad, %llu inconsistent, %llu not verified and %llu not counted (queue full)\n",
+        (unsigned long long)framesChecked, (unsigned long long)framesBad,
+        (unsigned long long)framesInconsistent, (unsigned long long)checksSkipped.load(),
+        (unsigned long long)recordsDropped.load());
+    if (statsFile != "") {
+        std::string fileName = statsFile + "_" + modeInfo->name;
+        transitTotal.dumpCsv((fileName + ".csv").c_str());
+        transitTotal.dumpJson((fileName + ".json").c_str(), modeInfo->name);
+    }
+
     return status;
 }
 
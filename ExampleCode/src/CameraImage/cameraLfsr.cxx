@@ -0,0 +1,148 @@
+/** ------------------------------------------------------------------------
+ * cameraLfsr.cxx
+ * LFSR fill and verify of the CameraImageData frames, in jumped-ahead lanes.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <string.h>
+#include "cameraLfsr.h"
+
+// a 32x32 bit matrix over GF(2): column b is the image of bit b
+typedef struct {
+    uint32_t    col[32];
+} lfsrMatrix;
+
+static uint32_t matrixApply(const lfsrMatrix *m, uint32_t v)
+{
+    uint32_t r = 0;
+    for (int b = 0; v != 0; b++, v >>= 1) {
+        r ^= (-(v & 1u)) & m->col[b];
+    }
+    return r;
+}
+
+// r = a * b (apply b, then a)
+static void matrixMultiply(lfsrMatrix *r, const lfsrMatrix *a, const lfsrMatrix *b)
+{
+    lfsrMatrix t;
+    for (int c = 0; c < 32; c++) {
+        t.col[c] = matrixApply(a, b->col[c]);
+    }
+    *r = t;
+}
+
+// the matrix of 'steps' steps: M^steps, by squaring
+static void matrixOfSteps(lfsrMatrix *r, uint64_t steps)
+{
+    lfsrMatrix power;
+    for (int b = 0; b < 32; b++) {
+        power.col[b] = lfsrStep(1u << b);
+        r->col[b] = (1u << b);
+    }
+    for (; steps != 0; steps >>= 1) {
+        if (steps & 1) {
+            matrixMultiply(r, &power, r);
+        }
+        if (steps > 1) {
+            matrixMultiply(&power, &power, &power);
+        }
+    }
+}
+
+uint32_t lfsrJump(uint32_t lfsr, uint64_t steps)
+{
+    lfsrMatrix m;
+    matrixOfSteps(&m, steps);
+    return matrixApply(&m, lfsr);
+}
+
+/** --------------------------------------------------------
+ * laneStarts()
+ * the start states of the LFSR_LANES segments of 'segWords' words from
+ * 'lfsr'.  The jump matrix of the last segment size is kept (per thread),
+ * as frames mostly keep their size.
+ **/
+static void laneStarts(uint32_t *lanes, uint32_t lfsr, int segWords)
+{
+    static thread_local int matrixWords = -1;
+    static thread_local lfsrMatrix jump;
+    if (matrixWords != segWords) {
+        matrixOfSteps(&jump, (uint64_t)segWords);
+        matrixWords = segWords;
+    }
+    lanes[0] = lfsr;
+    for (int l = 1; l < LFSR_LANES; l++) {
+        lanes[l] = matrixApply(&jump, lanes[l - 1]);
+    }
+}
+
+uint32_t lfsrFill(uint32_t *out, int words, uint32_t lfsr)
+{
+    int segWords = words / LFSR_LANES;
+    int i = 0;
+    if (segWords > 0) {
+        uint32_t lanes[LFSR_LANES];
+        laneStarts(lanes, lfsr, segWords);
+        for (i = 0; i < segWords; i++) {
+            for (int l = 0; l < LFSR_LANES; l++) {
+                out[(l * segWords) + i] = lanes[l];
+                lanes[l] = lfsrStep(lanes[l]);
+            }
+        }
+        // the last lane ends where the rest begins
+        lfsr = lanes[LFSR_LANES - 1];
+        i = segWords * LFSR_LANES;
+    }
+    for (; i < words; i++) {
+        out[i] = lfsr;
+        lfsr = lfsrStep(lfsr);
+    }
+    return lfsr;
+}
+
+int lfsrCheck(const uint32_t *in, int words)
+{
+    if (words <= 0) {
+        return -1;
+    }
+    int segWords = words / LFSR_LANES;
+    uint32_t lfsr = in[0];
+    uint32_t diff = 0;
+    int i = 0;
+    if (segWords > 0) {
+        uint32_t lanes[LFSR_LANES];
+        laneStarts(lanes, lfsr, segWords);
+        for (i = 0; i < segWords; i++) {
+            for (int l = 0; l < LFSR_LANES; l++) {
+                diff |= in[(l * segWords) + i] ^ lanes[l];
+                lanes[l] = lfsrStep(lanes[l]);
+            }
+        }
+        lfsr = lanes[LFSR_LANES - 1];
+        i = segWords * LFSR_LANES;
+    }
+    for (; i < words; i++) {
+        diff |= in[i] ^ lfsr;
+        lfsr = lfsrStep(lfsr);
+    }
+    if (diff == 0) {
+        return -1;
+    }
+
+    // something is wrong: find the first wrong word, serially
+    lfsr = in[0];
+    for (i = 0; i < words; i++) {
+        if (in[i] != lfsr) {
+            return i;
+        }
+        lfsr = lfsrStep(lfsr);
+    }
+    return -1;
+}
@@ -0,0 +1,56 @@
+/** ------------------------------------------------------------------------
+ * cameraLfsr.h
+ * The LFSR sequence that fills (publisher) and verifies (subscriber) the
+ * CameraImageData frames: a 32-bit Galois LFSR, one word per step.
+ * Stepping is a strictly serial chain, so a frame is split in
+ * LFSR_LANES segments whose start states are found by jumping ahead
+ * (the LFSR is linear over GF(2): n steps are a 32x32 bit matrix, M^n);
+ * the segments are then stepped together, which the compiler can keep
+ * in SIMD registers, and which keeps the CPU busy on independent chains.
+ * The words are the same as with the serial LFSR.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef cameraLfsr_h
+#define cameraLfsr_h
+
+#include <stdint.h>
+
+#define LFSR_SEED   (0x55555555)
+#define LFSR_TAPS   (0xD0000001u)
+#define LFSR_LANES  (8)             // segments stepped together
+
+// one step of the LFSR
+static inline uint32_t lfsrStep(uint32_t lfsr)
+{
+    return (lfsr >> 1) ^ (-(lfsr & 1u) & LFSR_TAPS);
+}
+
+/** --------------------------------------------------------
+ * lfsrJump()
+ * the LFSR state 'steps' steps after 'lfsr'
+ **/
+uint32_t lfsrJump(uint32_t lfsr, uint64_t steps);
+
+/** --------------------------------------------------------
+ * lfsrFill()
+ * write 'words' words of the sequence, starting with 'lfsr'.
+ * Returns the state after the last word (the first of the next frame).
+ **/
+uint32_t lfsrFill(uint32_t *out, int words, uint32_t lfsr);
+
+/** --------------------------------------------------------
+ * lfsrCheck()
+ * check that 'words' words are the sequence that starts with in[0].
+ * Returns the index of the first wrong word, or -1 if they are right.
+ **/
+int lfsrCheck(const uint32_t *in, int words);
+
+#endif  // ndef cameraLfsr_h
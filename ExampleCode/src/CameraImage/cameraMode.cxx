@@ -0,0 +1,39 @@
+/** ------------------------------------------------------------------------
+ * cameraMode.cxx
+ * Large data modes of the CameraImageData publisher and subscriber.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include "cameraMode.h"
+
+static const cameraModeInfo modes[] = {
+    { "plain",             "",                  false, false, false },
+    { "flat",              "Flat",              true,  false, false },
+    { "zerocopy",          "ZeroCopy",          false, true,  false },
+    { "flatzerocopy",      "FlatZeroCopy",      true,  true,  false },
+    { "frame",             "Frame",             false, false, true  },
+    { "flatframe",         "FrameFlat",         true,  false, true  },
+    { "flatzerocopyframe", "FrameFlatZeroCopy", true,  true,  true  }
+};
+
+cameraDataMode cameraDataModeFromName(const std::string &name)
+{
+    for (int i = 0; i < (int)(sizeof(modes) / sizeof(modes[0])); i++) {
+        if (name == modes[i].name) {
+            return (cameraDataMode)i;
+        }
+    }
+    return CAMERA_DATA_PLAIN;
+}
+
+const cameraModeInfo *cameraDataModeInfo(cameraDataMode mode)
+{
+    return &modes[mode];
+}
@@ -0,0 +1,63 @@
+/** ------------------------------------------------------------------------
+ * cameraMode.h
+ * Large data modes of the CameraImageData publisher and subscriber.
+ * Each mode has its own type in automotive.idl (all generated side by
+ * side), and its own topic, so the mode is chosen at launch with
+ * config.dataMode in camera_image.properties:
+ *   plain         CameraImageData              serialized and copied
+ *   flat          CameraImageDataFlat          FlatData (XCDR2)
+ *   zerocopy      CameraImageDataZeroCopy      Zero Copy (SHMEM_REF)
+ *   flatzerocopy  CameraImageDataFlatZeroCopy  FlatData and Zero Copy
+ * or, with variable-size frames (only the bytes of the image are sent):
+ *   frame              CameraImageFrame              serialized and copied
+ *   flatframe          CameraImageFrameFlat          FlatData (XCDR2)
+ *   flatzerocopyframe  CameraImageFrameFlatZeroCopy  FlatData and Zero Copy
+ * The topic is topic.Sensor with the mode suffix (e.g. CameraImageDataFlat),
+ * so a publisher and subscriber in different modes do not match.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef cameraMode_h
+#define cameraMode_h
+
+#include <string>
+
+typedef enum {
+    CAMERA_DATA_PLAIN = 0,
+    CAMERA_DATA_FLAT,
+    CAMERA_DATA_ZERO_COPY,
+    CAMERA_DATA_FLAT_ZERO_COPY,
+    CAMERA_FRAME_PLAIN,
+    CAMERA_FRAME_FLAT,
+    CAMERA_FRAME_FLAT_ZERO_COPY
+} cameraDataMode;
+
+typedef struct {
+    const char  *name;          // config.dataMode value
+    const char  *topicSuffix;   // added to topic.Sensor
+    bool        flatData;       // FlatData type: needs the XCDR2 QoS profile
+    bool        zeroCopy;       // sent by reference through shared memory
+    bool        frame;          // variable-size CameraImageFrame type
+} cameraModeInfo;
+
+/** --------------------------------------------------------
+ * cameraDataModeFromName()
+ * "plain", "flat", "zerocopy", "flatzerocopy", "frame", "flatframe" or
+ * "flatzerocopyframe"; empty or unknown names select plain.
+ **/
+cameraDataMode cameraDataModeFromName(const std::string &name);
+
+/** --------------------------------------------------------
+ * cameraDataModeInfo()
+ * name, topic suffix and options of a mode
+ **/
+const cameraModeInfo *cameraDataModeInfo(cameraDataMode mode);
+
+#endif  // ndef cameraMode_h
@@ -0,0 +1,111 @@
+/** ------------------------------------------------------------------------
+ * cameraStreams.cxx
+ * The camera streams of the CameraImageData publisher and subscriber.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <stdio.h>
+#include "Utils.h"
+#include "automotive.h"
+#include "cameraStreams.h"
+
+static const struct {
+    const char  *name;
+    int         format;
+    int         rowBytes;       // per pixel of a row
+} pixelFormats[] = {
+    { "mono8", PIXEL_MONO8, 1 },
+    { "rgb8",  PIXEL_RGB8,  3 },
+    { "rgba8", PIXEL_RGBA8, 4 },
+    { "yuyv",  PIXEL_YUYV,  2 },
+    { "nv12",  PIXEL_NV12,  1 }
+};
+#define PIXEL_FORMAT_RGBA8_INDEX    (2)
+
+/** --------------------------------------------------------
+ * frameFromGeometry()
+ * set the frame size of a camera from its width, height, format and
+ * stride; frames that don't fit in MAX_IMAGE_SIZE lose their last rows.
+ **/
+static void frameFromGeometry(cameraStreamConfig *stream, const std::string &formatName)
+{
+    int f = PIXEL_FORMAT_RGBA8_INDEX;
+    for (int i = 0; i < (int)(sizeof(pixelFormats) / sizeof(pixelFormats[0])); i++) {
+        if (formatName == pixelFormats[i].name) {
+            f = i;
+        }
+    }
+    stream->format = pixelFormats[f].format;
+    if (stream->stride < (stream->width * pixelFormats[f].rowBytes)) {
+        stream->stride = stream->width * pixelFormats[f].rowBytes;
+    }
+
+    // NV12 has a half-height UV plane after the Y plane
+    int rows = (stream->format == PIXEL_NV12) ? (stream->height + ((stream->height + 1) / 2)) : stream->height;
+    if (((int64_t)rows * stream->stride) > MAX_IMAGE_SIZE) {
+        int maxRows = MAX_IMAGE_SIZE / stream->stride;
+        int height = (stream->format == PIXEL_NV12) ? ((maxRows * 2) / 3) : maxRows;
+        printf("camera id %u: %dx%d %s frames are bigger than MAX_IMAGE_SIZE, sending %d rows\n",
+            stream->id, stream->width, stream->height, pixelFormats[f].name, height);
+        stream->height = height;
+        rows = (stream->format == PIXEL_NV12) ? (stream->height + ((stream->height + 1) / 2)) : stream->height;
+    }
+    stream->frameSize = rows * stream->stride;
+}
+
+void cameraStreamsFromConfig(PropertyUtil *prop, std::vector<cameraStreamConfig> &streams)
+{
+    int count = (int)prop->getLongProperty("config.cameraCount");
+    if (count < 1) count = 1;
+
+    uint32_t ddsId = (uint32_t)prop->getLongProperty("config.ddsId");
+    if (ddsId == 0) ddsId = 404;
+    int interval = (int)prop->getLongProperty("config.pubInterval");
+    if (interval <= 0) interval = 4000;
+
+    streams.clear();
+    for (int i = 0; i < count; i++) {
+        char key[64];
+        cameraStreamConfig stream;
+
+        snprintf(key, sizeof(key), "camera%d.ddsId", i);
+        stream.id = (uint32_t)prop->getLongProperty(key);
+        if (stream.id == 0) stream.id = ddsId + i;
+
+        snprintf(key, sizeof(key), "camera%d.width", i);
+        stream.width = (int)prop->getLongProperty(key);
+        snprintf(key, sizeof(key), "camera%d.height", i);
+        stream.height = (int)prop->getLongProperty(key);
+        snprintf(key, sizeof(key), "camera%d.stride", i);
+        stream.stride = (int)prop->getLongProperty(key);
+        if ((stream.width > 0) && (stream.height > 0)) {
+            snprintf(key, sizeof(key), "camera%d.format", i);
+            frameFromGeometry(&stream, prop->getStringProperty(key));
+        }
+        else {
+            // no geometry: one row of RGBA pixels
+            snprintf(key, sizeof(key), "camera%d.frameSize", i);
+            stream.frameSize = (int)prop->getLongProperty(key) & ~3;
+            if ((stream.frameSize <= 0) || (stream.frameSize > MAX_IMAGE_SIZE)) {
+                stream.frameSize = MAX_IMAGE_SIZE;
+            }
+            stream.format = PIXEL_RGBA8;
+            stream.width = stream.frameSize / 4;
+            stream.height = 1;
+            stream.stride = stream.frameSize;
+        }
+
+        snprintf(key, sizeof(key), "camera%d.pubInterval", i);
+        stream.interval = (int)prop->getLongProperty(key);
+        if (stream.interval <= 0) stream.interval = interval;
+
+        streams.push_back(stream);
+    }
+}
@@ -0,0 +1,51 @@
+/** ------------------------------------------------------------------------
+ * cameraStreams.h
+ * The camera streams (keyed instances of CameraImageData) sent by the
+ * CameraImageData publisher and checked by the subscriber, as set in
+ * camera_image.properties:
+ *   config.cameraCount     number of cameras (default 1)
+ *   camera<N>.ddsId        id (key) of camera N, counted from 0
+ *                          (default config.ddsId + N)
+ *   camera<N>.frameSize    bytes of image data (default MAX_IMAGE_SIZE)
+ *   camera<N>.pubInterval  mSec between frames (default config.pubInterval)
+ *   camera<N>.width        pixels per row and
+ *   camera<N>.height       rows: when set, the frame size is computed from
+ *   camera<N>.format       mono8, rgb8, rgba8 (default), yuyv or nv12
+ *   camera<N>.stride       bytes per row (default: width * bytes per pixel)
+ * The variable-size frame modes send only frameSize bytes; the fixed-size
+ * modes fill and verify that much of their MAX_IMAGE_SIZE array.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef cameraStreams_h
+#define cameraStreams_h
+
+#include <stdint.h>
+#include <vector>
+
+class PropertyUtil;
+
+typedef struct {
+    uint32_t    id;             // instance key
+    int         frameSize;      // bytes of image data
+    int         interval;       // mSec between frames
+    int         width;          // pixels per row
+    int         height;         // rows (of the Y plane for NV12)
+    int         stride;         // bytes per row
+    int         format;         // CameraImage_PixelFormatEnum
+} cameraStreamConfig;
+
+/** --------------------------------------------------------
+ * cameraStreamsFromConfig()
+ * the camera streams set in the properties (see above)
+ **/
+void cameraStreamsFromConfig(PropertyUtil *prop, std::vector<cameraStreamConfig> &streams);
+
+#endif  // ndef cameraStreams_h
@@ -1,15504 +0,0 @@
-
-/*
-WARNING: THIS FILE IS AUTO-GENERATED. DO NOT MODIFY.
-
-This file was generated from automotive.idl using "rtiddsgen".
-The rtiddsgen tool is part of the RTI Connext distribution.
-For more information, type 'rtiddsgen -help' at a command shell
-or consult the RTI Connext manual.
-*/
-
-#include <string.h>
-
-#ifndef ndds_cpp_h
-#include "ndds/ndds_cpp.h"
-#endif
-
-#ifndef osapi_type_h
-#include "osapi/osapi_type.h"
-#endif
-#ifndef osapi_heap_h
-#include "osapi/osapi_heap.h"
-#endif
-
-#ifndef osapi_utility_h
-#include "osapi/osapi_utility.h"
-#endif
-
-#ifndef cdr_type_h
-#include "cdr/cdr_type.h"
-#endif
-
-#ifndef cdr_type_object_h
-#include "cdr/cdr_typeObject.h"
-#endif
-
-#ifndef cdr_encapsulation_h
-#include "cdr/cdr_encapsulation.h"
-#endif
-
-#ifndef cdr_stream_h
-#include "cdr/cdr_stream.h"
-#endif
-
-#include "xcdr/xcdr_interpreter.h"
-#include "xcdr/xcdr_stream.h"
-
-#ifndef cdr_log_h
-#include "cdr/cdr_log.h"
-#endif
-
-#ifndef pres_typePlugin_h
-#include "pres/pres_typePlugin.h"
-#endif
-
-#include "dds_c/dds_c_typecode_impl.h"
-
-#define RTI_CDR_CURRENT_SUBMODULE RTI_CDR_SUBMODULE_MASK_STREAM
-
-#include <new>
-
-#include "automotivePlugin.h"
-
-/* ----------------------------------------------------------------------------
-*  Type POSIXTimestamp
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-POSIXTimestamp*
-POSIXTimestampPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    POSIXTimestamp *sample = NULL;
-
-    sample = new (std::nothrow) POSIXTimestamp ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!POSIXTimestamp_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-POSIXTimestamp *
-POSIXTimestampPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    POSIXTimestamp *sample = NULL;
-
-    sample = new (std::nothrow) POSIXTimestamp ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!POSIXTimestamp_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-POSIXTimestamp *
-POSIXTimestampPluginSupport_create_data(void)
-{
-    return POSIXTimestampPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-POSIXTimestampPluginSupport_destroy_data_w_params(
-    POSIXTimestamp *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    POSIXTimestamp_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-POSIXTimestampPluginSupport_destroy_data_ex(
-    POSIXTimestamp *sample,RTIBool deallocate_pointers) {
-    POSIXTimestamp_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-POSIXTimestampPluginSupport_destroy_data(
-    POSIXTimestamp *sample) {
-
-    POSIXTimestampPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-POSIXTimestampPluginSupport_copy_data(
-    POSIXTimestamp *dst,
-    const POSIXTimestamp *src)
-{
-    return POSIXTimestamp_copy(dst,(const POSIXTimestamp*) src);
-}
-
-void 
-POSIXTimestampPluginSupport_print_data(
-    const POSIXTimestamp *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printLong(
-        &sample->s, "s", indent_level + 1);    
-
-    RTICdrType_printLong(
-        &sample->ns, "ns", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-POSIXTimestampPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        POSIXTimestamp_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-POSIXTimestampPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-POSIXTimestampPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        POSIXTimestampPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        POSIXTimestampPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = POSIXTimestampPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            POSIXTimestampPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-POSIXTimestampPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-POSIXTimestampPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    POSIXTimestamp *sample,
-    void *handle)
-{
-    POSIXTimestamp_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-POSIXTimestampPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    POSIXTimestamp *dst,
-    const POSIXTimestamp *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return POSIXTimestampPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-POSIXTimestampPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-POSIXTimestampPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const POSIXTimestamp *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    POSIXTimestamp_get_typecode();
-    pd.programs = POSIXTimestampPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    POSIXTimestampPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-POSIXTimestampPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const POSIXTimestamp *sample)
-{
-    return POSIXTimestampPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-POSIXTimestampPlugin_deserialize_from_cdr_buffer(
-    POSIXTimestamp *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    POSIXTimestamp_get_typecode();
-    pd.programs = POSIXTimestampPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    POSIXTimestamp_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-POSIXTimestampPlugin_data_to_string(
-    const POSIXTimestamp *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!POSIXTimestampPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!POSIXTimestampPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        POSIXTimestamp_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-POSIXTimestampPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-POSIXTimestampPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool POSIXTimestampPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    POSIXTimestamp **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-POSIXTimestampPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-POSIXTimestampPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *POSIXTimestampPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    POSIXTimestamp, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *POSIXTimestampPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    POSIXTimestampPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    POSIXTimestampPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    POSIXTimestampPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    POSIXTimestampPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    POSIXTimestampPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    POSIXTimestampPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    POSIXTimestampPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    POSIXTimestamp_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    POSIXTimestampPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    POSIXTimestampPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    POSIXTimestampPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    POSIXTimestampPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)POSIXTimestamp_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    POSIXTimestampPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    POSIXTimestampPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = POSIXTimestampTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-POSIXTimestampPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-
-unsigned int 
-IndicatorStatusEnumPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int initial_alignment = current_alignment;
-
-    current_alignment += PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,
-        NULL,
-        include_encapsulation,
-        encapsulation_id, current_alignment);
-
-    return current_alignment - initial_alignment;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-/* ----------------------------------------------------------------------------
-Support functions:
-* ---------------------------------------------------------------------------- */
-
-void IndicatorStatusEnumPluginSupport_print_data(
-    const IndicatorStatusEnum *sample,
-    const char *description, int indent_level)
-{
-    if (description != NULL) {
-        RTICdrType_printIndent(indent_level);
-        RTILog_debug("%s:\n", description);
-    }
-
-    if (sample == NULL) {
-        RTICdrType_printIndent(indent_level+1);
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printEnum((RTICdrEnum *)sample, "IndicatorStatusEnum", indent_level + 1);
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-
-unsigned int 
-ClassificationEnumPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int initial_alignment = current_alignment;
-
-    current_alignment += PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,
-        NULL,
-        include_encapsulation,
-        encapsulation_id, current_alignment);
-
-    return current_alignment - initial_alignment;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-/* ----------------------------------------------------------------------------
-Support functions:
-* ---------------------------------------------------------------------------- */
-
-void ClassificationEnumPluginSupport_print_data(
-    const ClassificationEnum *sample,
-    const char *description, int indent_level)
-{
-    if (description != NULL) {
-        RTICdrType_printIndent(indent_level);
-        RTILog_debug("%s:\n", description);
-    }
-
-    if (sample == NULL) {
-        RTICdrType_printIndent(indent_level+1);
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printEnum((RTICdrEnum *)sample, "ClassificationEnum", indent_level + 1);
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-
-/* ----------------------------------------------------------------------------
-*  Type Alerts_DriverAlerts
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Alerts_DriverAlerts*
-Alerts_DriverAlertsPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Alerts_DriverAlerts *sample = NULL;
-
-    sample = new (std::nothrow) Alerts_DriverAlerts ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Alerts_DriverAlerts_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Alerts_DriverAlerts *
-Alerts_DriverAlertsPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Alerts_DriverAlerts *sample = NULL;
-
-    sample = new (std::nothrow) Alerts_DriverAlerts ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Alerts_DriverAlerts_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Alerts_DriverAlerts *
-Alerts_DriverAlertsPluginSupport_create_data(void)
-{
-    return Alerts_DriverAlertsPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Alerts_DriverAlertsPluginSupport_destroy_data_w_params(
-    Alerts_DriverAlerts *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Alerts_DriverAlerts_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Alerts_DriverAlertsPluginSupport_destroy_data_ex(
-    Alerts_DriverAlerts *sample,RTIBool deallocate_pointers) {
-    Alerts_DriverAlerts_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Alerts_DriverAlertsPluginSupport_destroy_data(
-    Alerts_DriverAlerts *sample) {
-
-    Alerts_DriverAlertsPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Alerts_DriverAlertsPluginSupport_copy_data(
-    Alerts_DriverAlerts *dst,
-    const Alerts_DriverAlerts *src)
-{
-    return Alerts_DriverAlerts_copy(dst,(const Alerts_DriverAlerts*) src);
-}
-
-void 
-Alerts_DriverAlertsPluginSupport_print_data(
-    const Alerts_DriverAlerts *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printBoolean(
-        &sample->blindSpotDriver, "blindSpotDriver", indent_level + 1);    
-
-    RTICdrType_printBoolean(
-        &sample->blindSpotPassenger, "blindSpotPassenger", indent_level + 1);    
-
-    RTICdrType_printBoolean(
-        &sample->frontCollision, "frontCollision", indent_level + 1);    
-
-    RTICdrType_printBoolean(
-        &sample->backCollision, "backCollision", indent_level + 1);    
-
-    RTICdrType_printBoolean(
-        &sample->parkingCollision, "parkingCollision", indent_level + 1);    
-
-    RTICdrType_printBoolean(
-        &sample->driverAttention, "driverAttention", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Alerts_DriverAlertsPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Alerts_DriverAlerts_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Alerts_DriverAlertsPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Alerts_DriverAlertsPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Alerts_DriverAlertsPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Alerts_DriverAlertsPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Alerts_DriverAlertsPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Alerts_DriverAlertsPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Alerts_DriverAlertsPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Alerts_DriverAlertsPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Alerts_DriverAlerts *sample,
-    void *handle)
-{
-    Alerts_DriverAlerts_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Alerts_DriverAlertsPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Alerts_DriverAlerts *dst,
-    const Alerts_DriverAlerts *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Alerts_DriverAlertsPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Alerts_DriverAlertsPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Alerts_DriverAlertsPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Alerts_DriverAlerts *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Alerts_DriverAlerts_get_typecode();
-    pd.programs = Alerts_DriverAlertsPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Alerts_DriverAlertsPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Alerts_DriverAlertsPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Alerts_DriverAlerts *sample)
-{
-    return Alerts_DriverAlertsPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Alerts_DriverAlertsPlugin_deserialize_from_cdr_buffer(
-    Alerts_DriverAlerts *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Alerts_DriverAlerts_get_typecode();
-    pd.programs = Alerts_DriverAlertsPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Alerts_DriverAlerts_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Alerts_DriverAlertsPlugin_data_to_string(
-    const Alerts_DriverAlerts *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Alerts_DriverAlertsPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Alerts_DriverAlertsPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Alerts_DriverAlerts_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Alerts_DriverAlertsPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Alerts_DriverAlertsPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Alerts_DriverAlertsPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Alerts_DriverAlerts **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Alerts_DriverAlertsPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Alerts_DriverAlertsPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Alerts_DriverAlertsPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Alerts_DriverAlerts, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Alerts_DriverAlertsPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Alerts_DriverAlertsPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Alerts_DriverAlertsPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Alerts_DriverAlertsPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Alerts_DriverAlertsPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Alerts_DriverAlertsPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Alerts_DriverAlertsPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Alerts_DriverAlertsPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Alerts_DriverAlerts_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Alerts_DriverAlertsPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Alerts_DriverAlertsPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Alerts_DriverAlertsPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Alerts_DriverAlertsPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Alerts_DriverAlerts_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Alerts_DriverAlertsPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Alerts_DriverAlertsPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Alerts_DriverAlertsTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Alerts_DriverAlertsPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-
-unsigned int 
-Lane_ConfidenceEnumPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int initial_alignment = current_alignment;
-
-    current_alignment += PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,
-        NULL,
-        include_encapsulation,
-        encapsulation_id, current_alignment);
-
-    return current_alignment - initial_alignment;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-/* ----------------------------------------------------------------------------
-Support functions:
-* ---------------------------------------------------------------------------- */
-
-void Lane_ConfidenceEnumPluginSupport_print_data(
-    const Lane_ConfidenceEnum *sample,
-    const char *description, int indent_level)
-{
-    if (description != NULL) {
-        RTICdrType_printIndent(indent_level);
-        RTILog_debug("%s:\n", description);
-    }
-
-    if (sample == NULL) {
-        RTICdrType_printIndent(indent_level+1);
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printEnum((RTICdrEnum *)sample, "Lane_ConfidenceEnum", indent_level + 1);
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-
-unsigned int 
-Lane_LaneBoundaryEnumPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int initial_alignment = current_alignment;
-
-    current_alignment += PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,
-        NULL,
-        include_encapsulation,
-        encapsulation_id, current_alignment);
-
-    return current_alignment - initial_alignment;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-/* ----------------------------------------------------------------------------
-Support functions:
-* ---------------------------------------------------------------------------- */
-
-void Lane_LaneBoundaryEnumPluginSupport_print_data(
-    const Lane_LaneBoundaryEnum *sample,
-    const char *description, int indent_level)
-{
-    if (description != NULL) {
-        RTICdrType_printIndent(indent_level);
-        RTILog_debug("%s:\n", description);
-    }
-
-    if (sample == NULL) {
-        RTICdrType_printIndent(indent_level+1);
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printEnum((RTICdrEnum *)sample, "Lane_LaneBoundaryEnum", indent_level + 1);
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-
-/* ----------------------------------------------------------------------------
-*  Type Lane_LaneObject
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Lane_LaneObject*
-Lane_LaneObjectPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Lane_LaneObject *sample = NULL;
-
-    sample = new (std::nothrow) Lane_LaneObject ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lane_LaneObject_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Lane_LaneObject *
-Lane_LaneObjectPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Lane_LaneObject *sample = NULL;
-
-    sample = new (std::nothrow) Lane_LaneObject ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lane_LaneObject_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Lane_LaneObject *
-Lane_LaneObjectPluginSupport_create_data(void)
-{
-    return Lane_LaneObjectPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Lane_LaneObjectPluginSupport_destroy_data_w_params(
-    Lane_LaneObject *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Lane_LaneObject_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lane_LaneObjectPluginSupport_destroy_data_ex(
-    Lane_LaneObject *sample,RTIBool deallocate_pointers) {
-    Lane_LaneObject_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lane_LaneObjectPluginSupport_destroy_data(
-    Lane_LaneObject *sample) {
-
-    Lane_LaneObjectPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Lane_LaneObjectPluginSupport_copy_data(
-    Lane_LaneObject *dst,
-    const Lane_LaneObject *src)
-{
-    return Lane_LaneObject_copy(dst,(const Lane_LaneObject*) src);
-}
-
-void 
-Lane_LaneObjectPluginSupport_print_data(
-    const Lane_LaneObject *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printBoolean(
-        &sample->isValid, "isValid", indent_level + 1);    
-
-    Lane_ConfidenceEnumPluginSupport_print_data(
-        (const Lane_ConfidenceEnum*) &sample->confidence, "confidence", indent_level + 1);
-
-    Lane_LaneBoundaryEnumPluginSupport_print_data(
-        (const Lane_LaneBoundaryEnum*) &sample->boundaryType, "boundaryType", indent_level + 1);
-
-    RTICdrType_printFloat(
-        &sample->offset, "offset", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->headingAngle, "headingAngle", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->curvature, "curvature", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Lane_LaneObjectPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Lane_LaneObject_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Lane_LaneObjectPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Lane_LaneObjectPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Lane_LaneObjectPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Lane_LaneObjectPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Lane_LaneObjectPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Lane_LaneObjectPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Lane_LaneObjectPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Lane_LaneObjectPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lane_LaneObject *sample,
-    void *handle)
-{
-    Lane_LaneObject_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Lane_LaneObjectPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lane_LaneObject *dst,
-    const Lane_LaneObject *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Lane_LaneObjectPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Lane_LaneObjectPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Lane_LaneObjectPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Lane_LaneObject *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lane_LaneObject_get_typecode();
-    pd.programs = Lane_LaneObjectPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Lane_LaneObjectPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Lane_LaneObjectPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Lane_LaneObject *sample)
-{
-    return Lane_LaneObjectPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Lane_LaneObjectPlugin_deserialize_from_cdr_buffer(
-    Lane_LaneObject *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lane_LaneObject_get_typecode();
-    pd.programs = Lane_LaneObjectPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Lane_LaneObject_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Lane_LaneObjectPlugin_data_to_string(
-    const Lane_LaneObject *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Lane_LaneObjectPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Lane_LaneObjectPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Lane_LaneObject_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Lane_LaneObjectPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Lane_LaneObjectPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Lane_LaneObjectPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Lane_LaneObject **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Lane_LaneObjectPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Lane_LaneObjectPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Lane_LaneObjectPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Lane_LaneObject, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Lane_LaneObjectPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Lane_LaneObjectPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Lane_LaneObjectPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Lane_LaneObjectPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Lane_LaneObjectPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Lane_LaneObjectPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Lane_LaneObjectPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Lane_LaneObjectPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Lane_LaneObject_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Lane_LaneObjectPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Lane_LaneObjectPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Lane_LaneObjectPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Lane_LaneObjectPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Lane_LaneObject_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Lane_LaneObjectPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Lane_LaneObjectPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Lane_LaneObjectTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Lane_LaneObjectPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Lane_LaneSensor
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Lane_LaneSensor*
-Lane_LaneSensorPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Lane_LaneSensor *sample = NULL;
-
-    sample = new (std::nothrow) Lane_LaneSensor ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lane_LaneSensor_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Lane_LaneSensor *
-Lane_LaneSensorPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Lane_LaneSensor *sample = NULL;
-
-    sample = new (std::nothrow) Lane_LaneSensor ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lane_LaneSensor_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Lane_LaneSensor *
-Lane_LaneSensorPluginSupport_create_data(void)
-{
-    return Lane_LaneSensorPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Lane_LaneSensorPluginSupport_destroy_data_w_params(
-    Lane_LaneSensor *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Lane_LaneSensor_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lane_LaneSensorPluginSupport_destroy_data_ex(
-    Lane_LaneSensor *sample,RTIBool deallocate_pointers) {
-    Lane_LaneSensor_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lane_LaneSensorPluginSupport_destroy_data(
-    Lane_LaneSensor *sample) {
-
-    Lane_LaneSensorPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Lane_LaneSensorPluginSupport_copy_data(
-    Lane_LaneSensor *dst,
-    const Lane_LaneSensor *src)
-{
-    return Lane_LaneSensor_copy(dst,(const Lane_LaneSensor*) src);
-}
-
-void 
-Lane_LaneSensorPluginSupport_print_data(
-    const Lane_LaneSensor *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    Lane_LaneObjectPluginSupport_print_data(
-        (const Lane_LaneObject*) &sample->left, "left", indent_level + 1);
-
-    Lane_LaneObjectPluginSupport_print_data(
-        (const Lane_LaneObject*) &sample->right, "right", indent_level + 1);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Lane_LaneSensorPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Lane_LaneSensor_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Lane_LaneSensorPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Lane_LaneSensorPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Lane_LaneSensorPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Lane_LaneSensorPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Lane_LaneSensorPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Lane_LaneSensorPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Lane_LaneSensorPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Lane_LaneSensorPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lane_LaneSensor *sample,
-    void *handle)
-{
-    Lane_LaneSensor_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Lane_LaneSensorPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lane_LaneSensor *dst,
-    const Lane_LaneSensor *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Lane_LaneSensorPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Lane_LaneSensorPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Lane_LaneSensorPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Lane_LaneSensor *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lane_LaneSensor_get_typecode();
-    pd.programs = Lane_LaneSensorPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Lane_LaneSensorPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Lane_LaneSensorPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Lane_LaneSensor *sample)
-{
-    return Lane_LaneSensorPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Lane_LaneSensorPlugin_deserialize_from_cdr_buffer(
-    Lane_LaneSensor *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lane_LaneSensor_get_typecode();
-    pd.programs = Lane_LaneSensorPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Lane_LaneSensor_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Lane_LaneSensorPlugin_data_to_string(
-    const Lane_LaneSensor *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Lane_LaneSensorPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Lane_LaneSensorPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Lane_LaneSensor_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Lane_LaneSensorPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Lane_LaneSensorPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Lane_LaneSensorPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Lane_LaneSensor **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Lane_LaneSensorPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Lane_LaneSensorPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Lane_LaneSensorPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Lane_LaneSensor, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Lane_LaneSensorPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Lane_LaneSensorPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Lane_LaneSensorPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Lane_LaneSensorPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Lane_LaneSensorPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Lane_LaneSensorPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Lane_LaneSensorPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Lane_LaneSensorPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Lane_LaneSensor_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Lane_LaneSensorPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Lane_LaneSensorPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Lane_LaneSensorPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Lane_LaneSensorPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Lane_LaneSensor_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Lane_LaneSensorPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Lane_LaneSensorPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Lane_LaneSensorTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Lane_LaneSensorPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Lidar_Point
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Lidar_Point*
-Lidar_PointPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Lidar_Point *sample = NULL;
-
-    sample = new (std::nothrow) Lidar_Point ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lidar_Point_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Lidar_Point *
-Lidar_PointPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Lidar_Point *sample = NULL;
-
-    sample = new (std::nothrow) Lidar_Point ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lidar_Point_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Lidar_Point *
-Lidar_PointPluginSupport_create_data(void)
-{
-    return Lidar_PointPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Lidar_PointPluginSupport_destroy_data_w_params(
-    Lidar_Point *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Lidar_Point_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lidar_PointPluginSupport_destroy_data_ex(
-    Lidar_Point *sample,RTIBool deallocate_pointers) {
-    Lidar_Point_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lidar_PointPluginSupport_destroy_data(
-    Lidar_Point *sample) {
-
-    Lidar_PointPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Lidar_PointPluginSupport_copy_data(
-    Lidar_Point *dst,
-    const Lidar_Point *src)
-{
-    return Lidar_Point_copy(dst,(const Lidar_Point*) src);
-}
-
-void 
-Lidar_PointPluginSupport_print_data(
-    const Lidar_Point *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printArray(
-        sample->point, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "point", indent_level + 1);        
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Lidar_PointPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Lidar_Point_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Lidar_PointPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Lidar_PointPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Lidar_PointPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Lidar_PointPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Lidar_PointPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Lidar_PointPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Lidar_PointPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Lidar_PointPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_Point *sample,
-    void *handle)
-{
-    Lidar_Point_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Lidar_PointPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_Point *dst,
-    const Lidar_Point *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Lidar_PointPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Lidar_PointPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Lidar_PointPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Lidar_Point *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lidar_Point_get_typecode();
-    pd.programs = Lidar_PointPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Lidar_PointPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Lidar_PointPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Lidar_Point *sample)
-{
-    return Lidar_PointPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Lidar_PointPlugin_deserialize_from_cdr_buffer(
-    Lidar_Point *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lidar_Point_get_typecode();
-    pd.programs = Lidar_PointPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Lidar_Point_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Lidar_PointPlugin_data_to_string(
-    const Lidar_Point *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Lidar_PointPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Lidar_PointPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Lidar_Point_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Lidar_PointPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Lidar_PointPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Lidar_PointPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_Point **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Lidar_PointPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Lidar_PointPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Lidar_PointPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Lidar_Point, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Lidar_PointPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Lidar_PointPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Lidar_PointPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Lidar_PointPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Lidar_PointPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Lidar_PointPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Lidar_PointPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Lidar_PointPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Lidar_Point_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Lidar_PointPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Lidar_PointPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Lidar_PointPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Lidar_PointPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Lidar_Point_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Lidar_PointPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Lidar_PointPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Lidar_PointTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Lidar_PointPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Lidar_PCloud
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Lidar_PCloud*
-Lidar_PCloudPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Lidar_PCloud *sample = NULL;
-
-    sample = new (std::nothrow) Lidar_PCloud ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lidar_PCloud_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Lidar_PCloud *
-Lidar_PCloudPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Lidar_PCloud *sample = NULL;
-
-    sample = new (std::nothrow) Lidar_PCloud ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lidar_PCloud_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Lidar_PCloud *
-Lidar_PCloudPluginSupport_create_data(void)
-{
-    return Lidar_PCloudPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Lidar_PCloudPluginSupport_destroy_data_w_params(
-    Lidar_PCloud *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Lidar_PCloud_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lidar_PCloudPluginSupport_destroy_data_ex(
-    Lidar_PCloud *sample,RTIBool deallocate_pointers) {
-    Lidar_PCloud_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lidar_PCloudPluginSupport_destroy_data(
-    Lidar_PCloud *sample) {
-
-    Lidar_PCloudPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Lidar_PCloudPluginSupport_copy_data(
-    Lidar_PCloud *dst,
-    const Lidar_PCloud *src)
-{
-    return Lidar_PCloud_copy(dst,(const Lidar_PCloud*) src);
-}
-
-void 
-Lidar_PCloudPluginSupport_print_data(
-    const Lidar_PCloud *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    if (Lidar_PointSeq_get_contiguous_bufferI(&sample->Location) != NULL) {
-        RTICdrType_printArray(
-            Lidar_PointSeq_get_contiguous_bufferI(&sample->Location), 
-            Lidar_PointSeq_get_length(&sample->Location),
-            sizeof(Lidar_Point),
-            (RTICdrTypePrintFunction)Lidar_PointPluginSupport_print_data,
-            "Location", indent_level + 1);
-    } else {
-        RTICdrType_printPointerArray(
-            Lidar_PointSeq_get_discontiguous_bufferI(&sample->Location), 
-            Lidar_PointSeq_get_length(&sample->Location),
-            (RTICdrTypePrintFunction)Lidar_PointPluginSupport_print_data,
-            "Location", indent_level + 1);
-    }
-
-    RTICdrType_printOctet(
-        &sample->color, "color", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->normal, "normal", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->intensity, "intensity", indent_level + 1);    
-
-    RTICdrType_printLong(
-        &sample->count, "count", indent_level + 1);    
-
-    RTICdrType_printArray(
-        sample->xLimits, (2), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "xLimits", indent_level + 1);        
-
-    RTICdrType_printArray(
-        sample->yLimits, (2), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "yLimits", indent_level + 1);        
-
-    RTICdrType_printArray(
-        sample->zLimits, (2), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "zLimits", indent_level + 1);        
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Lidar_PCloudPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Lidar_PCloud_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Lidar_PCloudPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Lidar_PCloudPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Lidar_PCloudPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Lidar_PCloudPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Lidar_PCloudPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Lidar_PCloudPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Lidar_PCloudPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Lidar_PCloudPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_PCloud *sample,
-    void *handle)
-{
-    Lidar_PCloud_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Lidar_PCloudPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_PCloud *dst,
-    const Lidar_PCloud *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Lidar_PCloudPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Lidar_PCloudPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Lidar_PCloudPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Lidar_PCloud *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lidar_PCloud_get_typecode();
-    pd.programs = Lidar_PCloudPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Lidar_PCloudPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Lidar_PCloudPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Lidar_PCloud *sample)
-{
-    return Lidar_PCloudPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Lidar_PCloudPlugin_deserialize_from_cdr_buffer(
-    Lidar_PCloud *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lidar_PCloud_get_typecode();
-    pd.programs = Lidar_PCloudPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Lidar_PCloud_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Lidar_PCloudPlugin_data_to_string(
-    const Lidar_PCloud *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Lidar_PCloudPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Lidar_PCloudPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Lidar_PCloud_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Lidar_PCloudPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Lidar_PCloudPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Lidar_PCloudPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_PCloud **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Lidar_PCloudPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Lidar_PCloudPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Lidar_PCloudPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Lidar_PCloud, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Lidar_PCloudPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Lidar_PCloudPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Lidar_PCloudPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Lidar_PCloudPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Lidar_PCloudPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Lidar_PCloudPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Lidar_PCloudPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Lidar_PCloudPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Lidar_PCloud_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Lidar_PCloudPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Lidar_PCloudPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Lidar_PCloudPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Lidar_PCloudPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Lidar_PCloud_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Lidar_PCloudPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Lidar_PCloudPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Lidar_PCloudTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Lidar_PCloudPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Lidar_LidarSensor
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Lidar_LidarSensor*
-Lidar_LidarSensorPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Lidar_LidarSensor *sample = NULL;
-
-    sample = new (std::nothrow) Lidar_LidarSensor ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lidar_LidarSensor_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Lidar_LidarSensor *
-Lidar_LidarSensorPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Lidar_LidarSensor *sample = NULL;
-
-    sample = new (std::nothrow) Lidar_LidarSensor ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Lidar_LidarSensor_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Lidar_LidarSensor *
-Lidar_LidarSensorPluginSupport_create_data(void)
-{
-    return Lidar_LidarSensorPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Lidar_LidarSensorPluginSupport_destroy_data_w_params(
-    Lidar_LidarSensor *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Lidar_LidarSensor_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lidar_LidarSensorPluginSupport_destroy_data_ex(
-    Lidar_LidarSensor *sample,RTIBool deallocate_pointers) {
-    Lidar_LidarSensor_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Lidar_LidarSensorPluginSupport_destroy_data(
-    Lidar_LidarSensor *sample) {
-
-    Lidar_LidarSensorPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Lidar_LidarSensorPluginSupport_copy_data(
-    Lidar_LidarSensor *dst,
-    const Lidar_LidarSensor *src)
-{
-    return Lidar_LidarSensor_copy(dst,(const Lidar_LidarSensor*) src);
-}
-
-void 
-Lidar_LidarSensorPluginSupport_print_data(
-    const Lidar_LidarSensor *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    POSIXTimestampPluginSupport_print_data(
-        (const POSIXTimestamp*) &sample->timestamp, "timestamp", indent_level + 1);
-
-    Lidar_PCloudPluginSupport_print_data(
-        (const Lidar_PCloud*) &sample->ptCloud, "ptCloud", indent_level + 1);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Lidar_LidarSensorPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Lidar_LidarSensor_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Lidar_LidarSensorPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Lidar_LidarSensorPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Lidar_LidarSensorPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Lidar_LidarSensorPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Lidar_LidarSensorPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Lidar_LidarSensorPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Lidar_LidarSensorPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Lidar_LidarSensorPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_LidarSensor *sample,
-    void *handle)
-{
-    Lidar_LidarSensor_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Lidar_LidarSensorPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_LidarSensor *dst,
-    const Lidar_LidarSensor *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Lidar_LidarSensorPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Lidar_LidarSensorPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Lidar_LidarSensorPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Lidar_LidarSensor *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lidar_LidarSensor_get_typecode();
-    pd.programs = Lidar_LidarSensorPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Lidar_LidarSensorPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Lidar_LidarSensorPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Lidar_LidarSensor *sample)
-{
-    return Lidar_LidarSensorPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Lidar_LidarSensorPlugin_deserialize_from_cdr_buffer(
-    Lidar_LidarSensor *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Lidar_LidarSensor_get_typecode();
-    pd.programs = Lidar_LidarSensorPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Lidar_LidarSensor_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Lidar_LidarSensorPlugin_data_to_string(
-    const Lidar_LidarSensor *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Lidar_LidarSensorPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Lidar_LidarSensorPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Lidar_LidarSensor_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Lidar_LidarSensorPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Lidar_LidarSensorPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Lidar_LidarSensorPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Lidar_LidarSensor **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Lidar_LidarSensorPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Lidar_LidarSensorPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Lidar_LidarSensorPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Lidar_LidarSensor, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Lidar_LidarSensorPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Lidar_LidarSensorPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Lidar_LidarSensorPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Lidar_LidarSensorPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Lidar_LidarSensorPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Lidar_LidarSensorPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Lidar_LidarSensorPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Lidar_LidarSensorPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Lidar_LidarSensor_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Lidar_LidarSensorPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Lidar_LidarSensorPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Lidar_LidarSensorPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Lidar_LidarSensorPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Lidar_LidarSensor_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Lidar_LidarSensorPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Lidar_LidarSensorPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Lidar_LidarSensorTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Lidar_LidarSensorPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Platform_PlatformControl
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Platform_PlatformControl*
-Platform_PlatformControlPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Platform_PlatformControl *sample = NULL;
-
-    sample = new (std::nothrow) Platform_PlatformControl ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Platform_PlatformControl_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Platform_PlatformControl *
-Platform_PlatformControlPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Platform_PlatformControl *sample = NULL;
-
-    sample = new (std::nothrow) Platform_PlatformControl ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Platform_PlatformControl_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Platform_PlatformControl *
-Platform_PlatformControlPluginSupport_create_data(void)
-{
-    return Platform_PlatformControlPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Platform_PlatformControlPluginSupport_destroy_data_w_params(
-    Platform_PlatformControl *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Platform_PlatformControl_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Platform_PlatformControlPluginSupport_destroy_data_ex(
-    Platform_PlatformControl *sample,RTIBool deallocate_pointers) {
-    Platform_PlatformControl_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Platform_PlatformControlPluginSupport_destroy_data(
-    Platform_PlatformControl *sample) {
-
-    Platform_PlatformControlPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Platform_PlatformControlPluginSupport_copy_data(
-    Platform_PlatformControl *dst,
-    const Platform_PlatformControl *src)
-{
-    return Platform_PlatformControl_copy(dst,(const Platform_PlatformControl*) src);
-}
-
-void 
-Platform_PlatformControlPluginSupport_print_data(
-    const Platform_PlatformControl *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printLong(
-        &sample->sample_id, "sample_id", indent_level + 1);    
-
-    POSIXTimestampPluginSupport_print_data(
-        (const POSIXTimestamp*) &sample->timestamp, "timestamp", indent_level + 1);
-
-    RTICdrType_printFloat(
-        &sample->vehicleSteerAngle, "vehicleSteerAngle", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->speed, "speed", indent_level + 1);    
-
-    IndicatorStatusEnumPluginSupport_print_data(
-        (const IndicatorStatusEnum*) &sample->blinkerStatus, "blinkerStatus", indent_level + 1);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Platform_PlatformControlPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Platform_PlatformControl_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Platform_PlatformControlPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Platform_PlatformControlPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Platform_PlatformControlPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Platform_PlatformControlPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Platform_PlatformControlPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Platform_PlatformControlPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Platform_PlatformControlPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Platform_PlatformControlPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Platform_PlatformControl *sample,
-    void *handle)
-{
-    Platform_PlatformControl_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Platform_PlatformControlPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Platform_PlatformControl *dst,
-    const Platform_PlatformControl *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Platform_PlatformControlPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Platform_PlatformControlPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Platform_PlatformControlPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Platform_PlatformControl *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Platform_PlatformControl_get_typecode();
-    pd.programs = Platform_PlatformControlPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Platform_PlatformControlPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Platform_PlatformControlPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Platform_PlatformControl *sample)
-{
-    return Platform_PlatformControlPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Platform_PlatformControlPlugin_deserialize_from_cdr_buffer(
-    Platform_PlatformControl *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Platform_PlatformControl_get_typecode();
-    pd.programs = Platform_PlatformControlPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Platform_PlatformControl_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Platform_PlatformControlPlugin_data_to_string(
-    const Platform_PlatformControl *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Platform_PlatformControlPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Platform_PlatformControlPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Platform_PlatformControl_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Platform_PlatformControlPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Platform_PlatformControlPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Platform_PlatformControlPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Platform_PlatformControl **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Platform_PlatformControlPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Platform_PlatformControlPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Platform_PlatformControlPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Platform_PlatformControl, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Platform_PlatformControlPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Platform_PlatformControlPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Platform_PlatformControlPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Platform_PlatformControlPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Platform_PlatformControlPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Platform_PlatformControlPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Platform_PlatformControlPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Platform_PlatformControlPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Platform_PlatformControl_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Platform_PlatformControlPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Platform_PlatformControlPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Platform_PlatformControlPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Platform_PlatformControlPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Platform_PlatformControl_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Platform_PlatformControlPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Platform_PlatformControlPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Platform_PlatformControlTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Platform_PlatformControlPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Platform_PlatformStatus
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Platform_PlatformStatus*
-Platform_PlatformStatusPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Platform_PlatformStatus *sample = NULL;
-
-    sample = new (std::nothrow) Platform_PlatformStatus ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Platform_PlatformStatus_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Platform_PlatformStatus *
-Platform_PlatformStatusPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Platform_PlatformStatus *sample = NULL;
-
-    sample = new (std::nothrow) Platform_PlatformStatus ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Platform_PlatformStatus_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Platform_PlatformStatus *
-Platform_PlatformStatusPluginSupport_create_data(void)
-{
-    return Platform_PlatformStatusPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Platform_PlatformStatusPluginSupport_destroy_data_w_params(
-    Platform_PlatformStatus *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Platform_PlatformStatus_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Platform_PlatformStatusPluginSupport_destroy_data_ex(
-    Platform_PlatformStatus *sample,RTIBool deallocate_pointers) {
-    Platform_PlatformStatus_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Platform_PlatformStatusPluginSupport_destroy_data(
-    Platform_PlatformStatus *sample) {
-
-    Platform_PlatformStatusPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Platform_PlatformStatusPluginSupport_copy_data(
-    Platform_PlatformStatus *dst,
-    const Platform_PlatformStatus *src)
-{
-    return Platform_PlatformStatus_copy(dst,(const Platform_PlatformStatus*) src);
-}
-
-void 
-Platform_PlatformStatusPluginSupport_print_data(
-    const Platform_PlatformStatus *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    POSIXTimestampPluginSupport_print_data(
-        (const POSIXTimestamp*) &sample->timestamp, "timestamp", indent_level + 1);
-
-    RTICdrType_printFloat(
-        &sample->vehSpd, "vehSpd", indent_level + 1);    
-
-    IndicatorStatusEnumPluginSupport_print_data(
-        (const IndicatorStatusEnum*) &sample->blinkerStatus, "blinkerStatus", indent_level + 1);
-
-    RTICdrType_printFloat(
-        &sample->posGasPedal, "posGasPedal", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->velocity, "velocity", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->yawRate, "yawRate", indent_level + 1);    
-
-    RTICdrType_printFloat(
-        &sample->vehicleSteerAngle, "vehicleSteerAngle", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Platform_PlatformStatusPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Platform_PlatformStatus_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Platform_PlatformStatusPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Platform_PlatformStatusPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Platform_PlatformStatusPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Platform_PlatformStatusPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Platform_PlatformStatusPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Platform_PlatformStatusPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Platform_PlatformStatusPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Platform_PlatformStatusPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Platform_PlatformStatus *sample,
-    void *handle)
-{
-    Platform_PlatformStatus_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Platform_PlatformStatusPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Platform_PlatformStatus *dst,
-    const Platform_PlatformStatus *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Platform_PlatformStatusPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Platform_PlatformStatusPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Platform_PlatformStatusPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Platform_PlatformStatus *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Platform_PlatformStatus_get_typecode();
-    pd.programs = Platform_PlatformStatusPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Platform_PlatformStatusPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Platform_PlatformStatusPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Platform_PlatformStatus *sample)
-{
-    return Platform_PlatformStatusPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Platform_PlatformStatusPlugin_deserialize_from_cdr_buffer(
-    Platform_PlatformStatus *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Platform_PlatformStatus_get_typecode();
-    pd.programs = Platform_PlatformStatusPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Platform_PlatformStatus_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Platform_PlatformStatusPlugin_data_to_string(
-    const Platform_PlatformStatus *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Platform_PlatformStatusPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Platform_PlatformStatusPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Platform_PlatformStatus_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Platform_PlatformStatusPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Platform_PlatformStatusPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Platform_PlatformStatusPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Platform_PlatformStatus **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Platform_PlatformStatusPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Platform_PlatformStatusPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Platform_PlatformStatusPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Platform_PlatformStatus, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Platform_PlatformStatusPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Platform_PlatformStatusPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Platform_PlatformStatusPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Platform_PlatformStatusPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Platform_PlatformStatusPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Platform_PlatformStatusPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Platform_PlatformStatusPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Platform_PlatformStatusPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Platform_PlatformStatus_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Platform_PlatformStatusPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Platform_PlatformStatusPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Platform_PlatformStatusPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Platform_PlatformStatusPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Platform_PlatformStatus_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Platform_PlatformStatusPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Platform_PlatformStatusPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Platform_PlatformStatusTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Platform_PlatformStatusPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-
-unsigned int 
-Sensor_RangeModeEnumPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int initial_alignment = current_alignment;
-
-    current_alignment += PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,
-        NULL,
-        include_encapsulation,
-        encapsulation_id, current_alignment);
-
-    return current_alignment - initial_alignment;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-/* ----------------------------------------------------------------------------
-Support functions:
-* ---------------------------------------------------------------------------- */
-
-void Sensor_RangeModeEnumPluginSupport_print_data(
-    const Sensor_RangeModeEnum *sample,
-    const char *description, int indent_level)
-{
-    if (description != NULL) {
-        RTICdrType_printIndent(indent_level);
-        RTILog_debug("%s:\n", description);
-    }
-
-    if (sample == NULL) {
-        RTICdrType_printIndent(indent_level+1);
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printEnum((RTICdrEnum *)sample, "Sensor_RangeModeEnum", indent_level + 1);
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-
-/* ----------------------------------------------------------------------------
-*  Type Sensor_SensorObject
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Sensor_SensorObject*
-Sensor_SensorObjectPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Sensor_SensorObject *sample = NULL;
-
-    sample = new (std::nothrow) Sensor_SensorObject ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Sensor_SensorObject_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Sensor_SensorObject *
-Sensor_SensorObjectPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Sensor_SensorObject *sample = NULL;
-
-    sample = new (std::nothrow) Sensor_SensorObject ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Sensor_SensorObject_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Sensor_SensorObject *
-Sensor_SensorObjectPluginSupport_create_data(void)
-{
-    return Sensor_SensorObjectPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Sensor_SensorObjectPluginSupport_destroy_data_w_params(
-    Sensor_SensorObject *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Sensor_SensorObject_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Sensor_SensorObjectPluginSupport_destroy_data_ex(
-    Sensor_SensorObject *sample,RTIBool deallocate_pointers) {
-    Sensor_SensorObject_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Sensor_SensorObjectPluginSupport_destroy_data(
-    Sensor_SensorObject *sample) {
-
-    Sensor_SensorObjectPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Sensor_SensorObjectPluginSupport_copy_data(
-    Sensor_SensorObject *dst,
-    const Sensor_SensorObject *src)
-{
-    return Sensor_SensorObject_copy(dst,(const Sensor_SensorObject*) src);
-}
-
-void 
-Sensor_SensorObjectPluginSupport_print_data(
-    const Sensor_SensorObject *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    ClassificationEnumPluginSupport_print_data(
-        (const ClassificationEnum*) &sample->classification, "classification", indent_level + 1);
-
-    RTICdrType_printArray(
-        sample->position, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "position", indent_level + 1);        
-
-    RTICdrType_printArray(
-        sample->velocity, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "velocity", indent_level + 1);        
-
-    RTICdrType_printArray(
-        sample->size, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "size", indent_level + 1);        
-
-    RTICdrType_printFloat(
-        &sample->amplitude, "amplitude", indent_level + 1);    
-
-    Sensor_RangeModeEnumPluginSupport_print_data(
-        (const Sensor_RangeModeEnum*) &sample->rangeMode, "rangeMode", indent_level + 1);
-
-    RTICdrType_printFloat(
-        &sample->rangeRate, "rangeRate", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Sensor_SensorObjectPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Sensor_SensorObject_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Sensor_SensorObjectPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Sensor_SensorObjectPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Sensor_SensorObjectPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Sensor_SensorObjectPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Sensor_SensorObjectPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Sensor_SensorObjectPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Sensor_SensorObjectPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Sensor_SensorObjectPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Sensor_SensorObject *sample,
-    void *handle)
-{
-    Sensor_SensorObject_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Sensor_SensorObjectPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Sensor_SensorObject *dst,
-    const Sensor_SensorObject *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Sensor_SensorObjectPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Sensor_SensorObjectPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Sensor_SensorObjectPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Sensor_SensorObject *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Sensor_SensorObject_get_typecode();
-    pd.programs = Sensor_SensorObjectPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Sensor_SensorObjectPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Sensor_SensorObjectPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Sensor_SensorObject *sample)
-{
-    return Sensor_SensorObjectPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Sensor_SensorObjectPlugin_deserialize_from_cdr_buffer(
-    Sensor_SensorObject *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Sensor_SensorObject_get_typecode();
-    pd.programs = Sensor_SensorObjectPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Sensor_SensorObject_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Sensor_SensorObjectPlugin_data_to_string(
-    const Sensor_SensorObject *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Sensor_SensorObjectPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Sensor_SensorObjectPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Sensor_SensorObject_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Sensor_SensorObjectPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Sensor_SensorObjectPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Sensor_SensorObjectPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Sensor_SensorObject **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Sensor_SensorObjectPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Sensor_SensorObjectPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Sensor_SensorObjectPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Sensor_SensorObject, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Sensor_SensorObjectPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Sensor_SensorObjectPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Sensor_SensorObjectPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Sensor_SensorObjectPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Sensor_SensorObjectPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Sensor_SensorObjectPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Sensor_SensorObjectPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Sensor_SensorObjectPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Sensor_SensorObject_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Sensor_SensorObjectPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Sensor_SensorObjectPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Sensor_SensorObjectPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Sensor_SensorObjectPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Sensor_SensorObject_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Sensor_SensorObjectPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Sensor_SensorObjectPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Sensor_SensorObjectTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Sensor_SensorObjectPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Sensor_SensorObjectList
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Sensor_SensorObjectList*
-Sensor_SensorObjectListPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Sensor_SensorObjectList *sample = NULL;
-
-    sample = new (std::nothrow) Sensor_SensorObjectList ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Sensor_SensorObjectList_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Sensor_SensorObjectList *
-Sensor_SensorObjectListPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Sensor_SensorObjectList *sample = NULL;
-
-    sample = new (std::nothrow) Sensor_SensorObjectList ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Sensor_SensorObjectList_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Sensor_SensorObjectList *
-Sensor_SensorObjectListPluginSupport_create_data(void)
-{
-    return Sensor_SensorObjectListPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Sensor_SensorObjectListPluginSupport_destroy_data_w_params(
-    Sensor_SensorObjectList *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Sensor_SensorObjectList_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Sensor_SensorObjectListPluginSupport_destroy_data_ex(
-    Sensor_SensorObjectList *sample,RTIBool deallocate_pointers) {
-    Sensor_SensorObjectList_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Sensor_SensorObjectListPluginSupport_destroy_data(
-    Sensor_SensorObjectList *sample) {
-
-    Sensor_SensorObjectListPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Sensor_SensorObjectListPluginSupport_copy_data(
-    Sensor_SensorObjectList *dst,
-    const Sensor_SensorObjectList *src)
-{
-    return Sensor_SensorObjectList_copy(dst,(const Sensor_SensorObjectList*) src);
-}
-
-void 
-Sensor_SensorObjectListPluginSupport_print_data(
-    const Sensor_SensorObjectList *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    POSIXTimestampPluginSupport_print_data(
-        (const POSIXTimestamp*) &sample->timestamp, "timestamp", indent_level + 1);
-
-    if (Sensor_SensorObjectSeq_get_contiguous_bufferI(&sample->objects) != NULL) {
-        RTICdrType_printArray(
-            Sensor_SensorObjectSeq_get_contiguous_bufferI(&sample->objects), 
-            Sensor_SensorObjectSeq_get_length(&sample->objects),
-            sizeof(Sensor_SensorObject),
-            (RTICdrTypePrintFunction)Sensor_SensorObjectPluginSupport_print_data,
-            "objects", indent_level + 1);
-    } else {
-        RTICdrType_printPointerArray(
-            Sensor_SensorObjectSeq_get_discontiguous_bufferI(&sample->objects), 
-            Sensor_SensorObjectSeq_get_length(&sample->objects),
-            (RTICdrTypePrintFunction)Sensor_SensorObjectPluginSupport_print_data,
-            "objects", indent_level + 1);
-    }
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Sensor_SensorObjectListPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Sensor_SensorObjectList_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Sensor_SensorObjectListPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Sensor_SensorObjectListPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Sensor_SensorObjectListPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Sensor_SensorObjectListPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Sensor_SensorObjectListPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Sensor_SensorObjectListPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Sensor_SensorObjectListPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Sensor_SensorObjectListPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Sensor_SensorObjectList *sample,
-    void *handle)
-{
-    Sensor_SensorObjectList_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Sensor_SensorObjectListPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Sensor_SensorObjectList *dst,
-    const Sensor_SensorObjectList *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Sensor_SensorObjectListPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Sensor_SensorObjectListPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Sensor_SensorObjectListPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Sensor_SensorObjectList *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Sensor_SensorObjectList_get_typecode();
-    pd.programs = Sensor_SensorObjectListPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Sensor_SensorObjectListPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Sensor_SensorObjectListPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Sensor_SensorObjectList *sample)
-{
-    return Sensor_SensorObjectListPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Sensor_SensorObjectListPlugin_deserialize_from_cdr_buffer(
-    Sensor_SensorObjectList *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Sensor_SensorObjectList_get_typecode();
-    pd.programs = Sensor_SensorObjectListPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Sensor_SensorObjectList_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Sensor_SensorObjectListPlugin_data_to_string(
-    const Sensor_SensorObjectList *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Sensor_SensorObjectListPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Sensor_SensorObjectListPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Sensor_SensorObjectList_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Sensor_SensorObjectListPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Sensor_SensorObjectListPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Sensor_SensorObjectListPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Sensor_SensorObjectList **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Sensor_SensorObjectListPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Sensor_SensorObjectListPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Sensor_SensorObjectListPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Sensor_SensorObjectList, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Sensor_SensorObjectListPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Sensor_SensorObjectListPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Sensor_SensorObjectListPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Sensor_SensorObjectListPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Sensor_SensorObjectListPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Sensor_SensorObjectListPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Sensor_SensorObjectListPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Sensor_SensorObjectListPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Sensor_SensorObjectList_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Sensor_SensorObjectListPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Sensor_SensorObjectListPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Sensor_SensorObjectListPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Sensor_SensorObjectListPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Sensor_SensorObjectList_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Sensor_SensorObjectListPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Sensor_SensorObjectListPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Sensor_SensorObjectListTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Sensor_SensorObjectListPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Vision_VisionObject
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Vision_VisionObject*
-Vision_VisionObjectPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Vision_VisionObject *sample = NULL;
-
-    sample = new (std::nothrow) Vision_VisionObject ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Vision_VisionObject_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Vision_VisionObject *
-Vision_VisionObjectPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Vision_VisionObject *sample = NULL;
-
-    sample = new (std::nothrow) Vision_VisionObject ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Vision_VisionObject_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Vision_VisionObject *
-Vision_VisionObjectPluginSupport_create_data(void)
-{
-    return Vision_VisionObjectPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Vision_VisionObjectPluginSupport_destroy_data_w_params(
-    Vision_VisionObject *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Vision_VisionObject_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Vision_VisionObjectPluginSupport_destroy_data_ex(
-    Vision_VisionObject *sample,RTIBool deallocate_pointers) {
-    Vision_VisionObject_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Vision_VisionObjectPluginSupport_destroy_data(
-    Vision_VisionObject *sample) {
-
-    Vision_VisionObjectPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Vision_VisionObjectPluginSupport_copy_data(
-    Vision_VisionObject *dst,
-    const Vision_VisionObject *src)
-{
-    return Vision_VisionObject_copy(dst,(const Vision_VisionObject*) src);
-}
-
-void 
-Vision_VisionObjectPluginSupport_print_data(
-    const Vision_VisionObject *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    ClassificationEnumPluginSupport_print_data(
-        (const ClassificationEnum*) &sample->classification, "classification", indent_level + 1);
-
-    RTICdrType_printArray(
-        sample->position, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "position", indent_level + 1);        
-
-    RTICdrType_printArray(
-        sample->velocity, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "velocity", indent_level + 1);        
-
-    RTICdrType_printArray(
-        sample->size, (3), RTI_CDR_FLOAT_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printFloat, 
-        "size", indent_level + 1);        
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Vision_VisionObjectPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Vision_VisionObject_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Vision_VisionObjectPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Vision_VisionObjectPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Vision_VisionObjectPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Vision_VisionObjectPluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Vision_VisionObjectPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Vision_VisionObjectPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Vision_VisionObjectPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Vision_VisionObjectPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionObject *sample,
-    void *handle)
-{
-    Vision_VisionObject_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Vision_VisionObjectPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionObject *dst,
-    const Vision_VisionObject *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Vision_VisionObjectPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Vision_VisionObjectPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Vision_VisionObjectPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Vision_VisionObject *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Vision_VisionObject_get_typecode();
-    pd.programs = Vision_VisionObjectPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Vision_VisionObjectPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Vision_VisionObjectPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Vision_VisionObject *sample)
-{
-    return Vision_VisionObjectPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Vision_VisionObjectPlugin_deserialize_from_cdr_buffer(
-    Vision_VisionObject *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Vision_VisionObject_get_typecode();
-    pd.programs = Vision_VisionObjectPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Vision_VisionObject_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Vision_VisionObjectPlugin_data_to_string(
-    const Vision_VisionObject *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Vision_VisionObjectPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Vision_VisionObjectPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Vision_VisionObject_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Vision_VisionObjectPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Vision_VisionObjectPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool Vision_VisionObjectPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionObject **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Vision_VisionObjectPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Vision_VisionObjectPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *Vision_VisionObjectPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Vision_VisionObject, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Vision_VisionObjectPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Vision_VisionObjectPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Vision_VisionObjectPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Vision_VisionObjectPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Vision_VisionObjectPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Vision_VisionObjectPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Vision_VisionObjectPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Vision_VisionObjectPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Vision_VisionObject_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Vision_VisionObjectPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Vision_VisionObjectPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Vision_VisionObjectPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Vision_VisionObjectPlugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Vision_VisionObject_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Vision_VisionObjectPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Vision_VisionObjectPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Vision_VisionObjectTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Vision_VisionObjectPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type Vision_VisionSensor
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-Vision_VisionSensor*
-Vision_VisionSensorPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    Vision_VisionSensor *sample = NULL;
-
-    sample = new (std::nothrow) Vision_VisionSensor ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!Vision_VisionSensor_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-Vision_VisionSensor *
-Vision_VisionSensorPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    Vision_VisionSensor *sample = NULL;
-
-    sample = new (std::nothrow) Vision_VisionSensor ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!Vision_VisionSensor_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-Vision_VisionSensor *
-Vision_VisionSensorPluginSupport_create_data(void)
-{
-    return Vision_VisionSensorPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-Vision_VisionSensorPluginSupport_destroy_data_w_params(
-    Vision_VisionSensor *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    Vision_VisionSensor_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Vision_VisionSensorPluginSupport_destroy_data_ex(
-    Vision_VisionSensor *sample,RTIBool deallocate_pointers) {
-    Vision_VisionSensor_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-Vision_VisionSensorPluginSupport_destroy_data(
-    Vision_VisionSensor *sample) {
-
-    Vision_VisionSensorPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-Vision_VisionSensorPluginSupport_copy_data(
-    Vision_VisionSensor *dst,
-    const Vision_VisionSensor *src)
-{
-    return Vision_VisionSensor_copy(dst,(const Vision_VisionSensor*) src);
-}
-
-void 
-Vision_VisionSensorPluginSupport_print_data(
-    const Vision_VisionSensor *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printLong(
-        &sample->id, "id", indent_level + 1);    
-
-    POSIXTimestampPluginSupport_print_data(
-        (const POSIXTimestamp*) &sample->timestamp, "timestamp", indent_level + 1);
-
-    if (Vision_VisionObjectSeq_get_contiguous_bufferI(&sample->objects) != NULL) {
-        RTICdrType_printArray(
-            Vision_VisionObjectSeq_get_contiguous_bufferI(&sample->objects), 
-            Vision_VisionObjectSeq_get_length(&sample->objects),
-            sizeof(Vision_VisionObject),
-            (RTICdrTypePrintFunction)Vision_VisionObjectPluginSupport_print_data,
-            "objects", indent_level + 1);
-    } else {
-        RTICdrType_printPointerArray(
-            Vision_VisionObjectSeq_get_discontiguous_bufferI(&sample->objects), 
-            Vision_VisionObjectSeq_get_length(&sample->objects),
-            (RTICdrTypePrintFunction)Vision_VisionObjectPluginSupport_print_data,
-            "objects", indent_level + 1);
-    }
-
-}
-
-Vision_VisionSensor *
-Vision_VisionSensorPluginSupport_create_key_ex(RTIBool allocate_pointers){
-    Vision_VisionSensor *key = NULL;
-
-    key = new (std::nothrow) Vision_VisionSensorKeyHolder ;
-
-    Vision_VisionSensor_initialize_ex(key,allocate_pointers, RTI_TRUE);
-
-    return key;
-}
-
-Vision_VisionSensor *
-Vision_VisionSensorPluginSupport_create_key(void)
-{
-    return  Vision_VisionSensorPluginSupport_create_key_ex(RTI_TRUE);
-}
-
-void 
-Vision_VisionSensorPluginSupport_destroy_key_ex(
-    Vision_VisionSensorKeyHolder *key,RTIBool deallocate_pointers)
-{
-    Vision_VisionSensor_finalize_ex(key,deallocate_pointers);
-
-    delete  key;
-    key=NULL;
-}
-
-void 
-Vision_VisionSensorPluginSupport_destroy_key(
-    Vision_VisionSensorKeyHolder *key) {
-
-    Vision_VisionSensorPluginSupport_destroy_key_ex(key,RTI_TRUE);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-Vision_VisionSensorPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        Vision_VisionSensor_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-Vision_VisionSensorPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-Vision_VisionSensorPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    unsigned int serializedKeyMaxSize = 0;
-    unsigned int serializedKeyMaxSizeV2 = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        Vision_VisionSensorPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        Vision_VisionSensorPluginSupport_destroy_data,
-        (PRESTypePluginDefaultEndpointDataCreateKeyFunction)
-        Vision_VisionSensorPluginSupport_create_key ,            (PRESTypePluginDefaultEndpointDataDestroyKeyFunction)
-        Vision_VisionSensorPluginSupport_destroy_key);
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    serializedKeyMaxSize =  Vision_VisionSensorPlugin_get_serialized_key_max_size(
-        epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-    serializedKeyMaxSizeV2 =  Vision_VisionSensorPlugin_get_serialized_key_max_size_for_keyhash(
-        epd,
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE,
-        0);
-
-    if(!PRESTypePluginDefaultEndpointData_createMD5StreamWithInfo(
-        epd,
-        endpoint_info,
-        serializedKeyMaxSize,
-        serializedKeyMaxSizeV2))  
-    {
-        PRESTypePluginDefaultEndpointData_delete(epd);
-        return NULL;
-    }
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = Vision_VisionSensorPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            Vision_VisionSensorPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-Vision_VisionSensorPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-Vision_VisionSensorPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionSensor *sample,
-    void *handle)
-{
-    Vision_VisionSensor_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-Vision_VisionSensorPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionSensor *dst,
-    const Vision_VisionSensor *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return Vision_VisionSensorPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-Vision_VisionSensorPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-Vision_VisionSensorPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const Vision_VisionSensor *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Vision_VisionSensor_get_typecode();
-    pd.programs = Vision_VisionSensorPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    Vision_VisionSensorPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-Vision_VisionSensorPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const Vision_VisionSensor *sample)
-{
-    return Vision_VisionSensorPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-Vision_VisionSensorPlugin_deserialize_from_cdr_buffer(
-    Vision_VisionSensor *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    Vision_VisionSensor_get_typecode();
-    pd.programs = Vision_VisionSensorPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    Vision_VisionSensor_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-Vision_VisionSensorPlugin_data_to_string(
-    const Vision_VisionSensor *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!Vision_VisionSensorPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!Vision_VisionSensorPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        Vision_VisionSensor_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-Vision_VisionSensorPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-Vision_VisionSensorPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_USER_KEY;
-}
-
-RTIBool Vision_VisionSensorPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionSensor **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-Vision_VisionSensorPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-Vision_VisionSensorPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-RTIBool 
-Vision_VisionSensorPlugin_instance_to_key(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionSensorKeyHolder *dst, 
-    const Vision_VisionSensor *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */   
-
-    if (!RTICdrType_copyLong (
-        &dst->id, &src->id)) { 
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-Vision_VisionSensorPlugin_key_to_instance(
-    PRESTypePluginEndpointData endpoint_data,
-    Vision_VisionSensor *dst, const
-    Vision_VisionSensorKeyHolder *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */   
-    if (!RTICdrType_copyLong (
-        &dst->id, &src->id)) { 
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-Vision_VisionSensorPlugin_instance_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    DDS_KeyHash_t *keyhash,
-    const Vision_VisionSensor *instance,
-    RTIEncapsulationId encapsulationId)
-{
-    struct RTICdrStream * md5Stream = NULL;
-    struct RTICdrStreamState cdrState;
-    char * buffer = NULL;
-    RTIXCdrBoolean iCdrv2;
-
-    iCdrv2 = RTIXCdrEncapsulationId_isCdrV2(encapsulationId);
-    RTICdrStreamState_init(&cdrState);
-    md5Stream = PRESTypePluginDefaultEndpointData_getMD5Stream(endpoint_data);
-
-    if (md5Stream == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTICdrStream_resetPosition(md5Stream);
-    RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-
-    if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-        endpoint_data,
-        instance,
-        md5Stream,
-        iCdrv2?
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-        RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-        NULL)) 
-    {
-        int size;
-
-        RTICdrStream_pushState(md5Stream, &cdrState, -1);
-
-        size = (int)PRESTypePlugin_interpretedGetSerializedSampleSize(
-            endpoint_data,
-            RTI_FALSE,
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            0,
-            instance);
-
-        if (size <= RTICdrStream_getBufferLength(md5Stream)) {
-            RTICdrStream_popState(md5Stream, &cdrState);        
-            return RTI_FALSE;
-        }   
-
-        RTIOsapiHeap_allocateBuffer(&buffer,size,0);
-
-        if (buffer == NULL) {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            return RTI_FALSE;
-        }
-
-        RTICdrStream_set(md5Stream, buffer, size);
-        RTIOsapiMemory_zero(
-            RTICdrStream_getBuffer(md5Stream),
-            RTICdrStream_getBufferLength(md5Stream));
-        RTICdrStream_resetPosition(md5Stream);
-        RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-        if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-            endpoint_data,
-            instance,
-            md5Stream, 
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            NULL)) 
-        {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            RTIOsapiHeap_freeBuffer(buffer);
-            return RTI_FALSE;
-        }        
-    }   
-
-    if (PRESTypePluginDefaultEndpointData_getMaxSizeSerializedKey(endpoint_data, iCdrv2) > 
-    (unsigned int)(MIG_RTPS_KEY_HASH_MAX_LENGTH) ||
-    PRESTypePluginDefaultEndpointData_forceMD5KeyHash(endpoint_data)) {
-        RTICdrStream_computeMD5(md5Stream, keyhash->value);
-    } else {
-        RTIOsapiMemory_zero(keyhash->value,MIG_RTPS_KEY_HASH_MAX_LENGTH);
-        RTIOsapiMemory_copy(
-            keyhash->value, 
-            RTICdrStream_getBuffer(md5Stream), 
-            RTICdrStream_getCurrentPositionOffset(md5Stream));
-    }
-
-    keyhash->length = MIG_RTPS_KEY_HASH_MAX_LENGTH;
-
-    if (buffer != NULL) {
-        RTICdrStream_popState(md5Stream, &cdrState);
-        RTIOsapiHeap_freeBuffer(buffer);
-    }
-
-    return RTI_TRUE;
-}
-
-RTIBool 
-Vision_VisionSensorPlugin_serialized_sample_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    struct RTICdrStream *stream, 
-    DDS_KeyHash_t *keyhash,
-    RTIBool deserialize_encapsulation,
-    void *endpoint_plugin_qos) 
-{   
-    Vision_VisionSensor * sample = NULL;
-    sample = (Vision_VisionSensor *)
-    PRESTypePluginDefaultEndpointData_getTempSample(endpoint_data);
-    if (sample == NULL) {
-        return RTI_FALSE;
-    }
-
-    if (!PRESTypePlugin_interpretedSerializedSampleToKey(
-        endpoint_data,
-        sample,
-        stream, 
-        deserialize_encapsulation, 
-        RTI_TRUE,
-        endpoint_plugin_qos)) {
-        return RTI_FALSE;
-    }
-    if (!Vision_VisionSensorPlugin_instance_to_keyhash(
-        endpoint_data, 
-        keyhash, 
-        sample,
-        RTICdrStream_getEncapsulationKind(stream))) {
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-struct RTIXCdrInterpreterPrograms *Vision_VisionSensorPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    Vision_VisionSensor, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *Vision_VisionSensorPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    Vision_VisionSensorPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    Vision_VisionSensorPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    Vision_VisionSensorPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    Vision_VisionSensorPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    Vision_VisionSensorPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    Vision_VisionSensorPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    Vision_VisionSensorPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    Vision_VisionSensor_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    Vision_VisionSensorPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    Vision_VisionSensorPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    Vision_VisionSensorPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    Vision_VisionSensorPlugin_get_key_kind;
-
-    plugin->getSerializedKeyMaxSizeFnc =   
-    (PRESTypePluginGetSerializedKeyMaxSizeFunction)
-    Vision_VisionSensorPlugin_get_serialized_key_max_size;
-    plugin->serializeKeyFnc =
-    (PRESTypePluginSerializeKeyFunction)
-    PRESTypePlugin_interpretedSerializeKey;
-    plugin->deserializeKeyFnc =
-    (PRESTypePluginDeserializeKeyFunction)
-    Vision_VisionSensorPlugin_deserialize_key;
-    plugin->deserializeKeySampleFnc =
-    (PRESTypePluginDeserializeKeySampleFunction)
-    PRESTypePlugin_interpretedDeserializeKey;
-
-    plugin-> instanceToKeyHashFnc = 
-    (PRESTypePluginInstanceToKeyHashFunction)
-    Vision_VisionSensorPlugin_instance_to_keyhash;
-    plugin->serializedSampleToKeyHashFnc = 
-    (PRESTypePluginSerializedSampleToKeyHashFunction)
-    Vision_VisionSensorPlugin_serialized_sample_to_keyhash;
-
-    plugin->getKeyFnc =
-    (PRESTypePluginGetKeyFunction)
-    Vision_VisionSensorPlugin_get_key;
-    plugin->returnKeyFnc =
-    (PRESTypePluginReturnKeyFunction)
-    Vision_VisionSensorPlugin_return_key;
-
-    plugin->instanceToKeyFnc =
-    (PRESTypePluginInstanceToKeyFunction)
-    Vision_VisionSensorPlugin_instance_to_key;
-    plugin->keyToInstanceFnc =
-    (PRESTypePluginKeyToInstanceFunction)
-    Vision_VisionSensorPlugin_key_to_instance;
-    plugin->serializedKeyToKeyHashFnc = NULL; /* Not supported yet */
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)Vision_VisionSensor_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    Vision_VisionSensorPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    Vision_VisionSensorPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = Vision_VisionSensorTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-Vision_VisionSensorPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type builtin_interfaces_msg_dds__Time_
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-builtin_interfaces_msg_dds__Time_*
-builtin_interfaces_msg_dds__Time_PluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    builtin_interfaces_msg_dds__Time_ *sample = NULL;
-
-    sample = new (std::nothrow) builtin_interfaces_msg_dds__Time_ ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!builtin_interfaces_msg_dds__Time__initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-builtin_interfaces_msg_dds__Time_ *
-builtin_interfaces_msg_dds__Time_PluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    builtin_interfaces_msg_dds__Time_ *sample = NULL;
-
-    sample = new (std::nothrow) builtin_interfaces_msg_dds__Time_ ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!builtin_interfaces_msg_dds__Time__initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-builtin_interfaces_msg_dds__Time_ *
-builtin_interfaces_msg_dds__Time_PluginSupport_create_data(void)
-{
-    return builtin_interfaces_msg_dds__Time_PluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-builtin_interfaces_msg_dds__Time_PluginSupport_destroy_data_w_params(
-    builtin_interfaces_msg_dds__Time_ *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    builtin_interfaces_msg_dds__Time__finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-builtin_interfaces_msg_dds__Time_PluginSupport_destroy_data_ex(
-    builtin_interfaces_msg_dds__Time_ *sample,RTIBool deallocate_pointers) {
-    builtin_interfaces_msg_dds__Time__finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-builtin_interfaces_msg_dds__Time_PluginSupport_destroy_data(
-    builtin_interfaces_msg_dds__Time_ *sample) {
-
-    builtin_interfaces_msg_dds__Time_PluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-builtin_interfaces_msg_dds__Time_PluginSupport_copy_data(
-    builtin_interfaces_msg_dds__Time_ *dst,
-    const builtin_interfaces_msg_dds__Time_ *src)
-{
-    return builtin_interfaces_msg_dds__Time__copy(dst,(const builtin_interfaces_msg_dds__Time_*) src);
-}
-
-void 
-builtin_interfaces_msg_dds__Time_PluginSupport_print_data(
-    const builtin_interfaces_msg_dds__Time_ *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printLong(
-        &sample->sec_, "sec_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->nanosec_, "nanosec_", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-builtin_interfaces_msg_dds__Time_Plugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        builtin_interfaces_msg_dds__Time__get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-builtin_interfaces_msg_dds__Time_Plugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-builtin_interfaces_msg_dds__Time_Plugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        builtin_interfaces_msg_dds__Time_PluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        builtin_interfaces_msg_dds__Time_PluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = builtin_interfaces_msg_dds__Time_Plugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            builtin_interfaces_msg_dds__Time_Plugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-builtin_interfaces_msg_dds__Time_Plugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-builtin_interfaces_msg_dds__Time_Plugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    builtin_interfaces_msg_dds__Time_ *sample,
-    void *handle)
-{
-    builtin_interfaces_msg_dds__Time__finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-builtin_interfaces_msg_dds__Time_Plugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    builtin_interfaces_msg_dds__Time_ *dst,
-    const builtin_interfaces_msg_dds__Time_ *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return builtin_interfaces_msg_dds__Time_PluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-builtin_interfaces_msg_dds__Time_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-builtin_interfaces_msg_dds__Time_Plugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const builtin_interfaces_msg_dds__Time_ *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    builtin_interfaces_msg_dds__Time__get_typecode();
-    pd.programs = builtin_interfaces_msg_dds__Time_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    builtin_interfaces_msg_dds__Time_Plugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-builtin_interfaces_msg_dds__Time_Plugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const builtin_interfaces_msg_dds__Time_ *sample)
-{
-    return builtin_interfaces_msg_dds__Time_Plugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-builtin_interfaces_msg_dds__Time_Plugin_deserialize_from_cdr_buffer(
-    builtin_interfaces_msg_dds__Time_ *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    builtin_interfaces_msg_dds__Time__get_typecode();
-    pd.programs = builtin_interfaces_msg_dds__Time_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    builtin_interfaces_msg_dds__Time__finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-builtin_interfaces_msg_dds__Time_Plugin_data_to_string(
-    const builtin_interfaces_msg_dds__Time_ *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!builtin_interfaces_msg_dds__Time_Plugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!builtin_interfaces_msg_dds__Time_Plugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        builtin_interfaces_msg_dds__Time__get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-builtin_interfaces_msg_dds__Time_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-builtin_interfaces_msg_dds__Time_Plugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool builtin_interfaces_msg_dds__Time_Plugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    builtin_interfaces_msg_dds__Time_ **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-builtin_interfaces_msg_dds__Time_Plugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-builtin_interfaces_msg_dds__Time_Plugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *builtin_interfaces_msg_dds__Time_Plugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    builtin_interfaces_msg_dds__Time_, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *builtin_interfaces_msg_dds__Time_Plugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    builtin_interfaces_msg_dds__Time_Plugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    builtin_interfaces_msg_dds__Time_Plugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    builtin_interfaces_msg_dds__Time_Plugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    builtin_interfaces_msg_dds__Time_Plugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    builtin_interfaces_msg_dds__Time__finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)builtin_interfaces_msg_dds__Time__get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    builtin_interfaces_msg_dds__Time_Plugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = builtin_interfaces_msg_dds__Time_TYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-builtin_interfaces_msg_dds__Time_Plugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type std_msgs_msg_dds__Header_
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-std_msgs_msg_dds__Header_*
-std_msgs_msg_dds__Header_PluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    std_msgs_msg_dds__Header_ *sample = NULL;
-
-    sample = new (std::nothrow) std_msgs_msg_dds__Header_ ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!std_msgs_msg_dds__Header__initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-std_msgs_msg_dds__Header_ *
-std_msgs_msg_dds__Header_PluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    std_msgs_msg_dds__Header_ *sample = NULL;
-
-    sample = new (std::nothrow) std_msgs_msg_dds__Header_ ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!std_msgs_msg_dds__Header__initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-std_msgs_msg_dds__Header_ *
-std_msgs_msg_dds__Header_PluginSupport_create_data(void)
-{
-    return std_msgs_msg_dds__Header_PluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-std_msgs_msg_dds__Header_PluginSupport_destroy_data_w_params(
-    std_msgs_msg_dds__Header_ *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    std_msgs_msg_dds__Header__finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-std_msgs_msg_dds__Header_PluginSupport_destroy_data_ex(
-    std_msgs_msg_dds__Header_ *sample,RTIBool deallocate_pointers) {
-    std_msgs_msg_dds__Header__finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-std_msgs_msg_dds__Header_PluginSupport_destroy_data(
-    std_msgs_msg_dds__Header_ *sample) {
-
-    std_msgs_msg_dds__Header_PluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-std_msgs_msg_dds__Header_PluginSupport_copy_data(
-    std_msgs_msg_dds__Header_ *dst,
-    const std_msgs_msg_dds__Header_ *src)
-{
-    return std_msgs_msg_dds__Header__copy(dst,(const std_msgs_msg_dds__Header_*) src);
-}
-
-void 
-std_msgs_msg_dds__Header_PluginSupport_print_data(
-    const std_msgs_msg_dds__Header_ *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    builtin_interfaces_msg_dds__Time_PluginSupport_print_data(
-        (const builtin_interfaces_msg_dds__Time_*) &sample->stamp_, "stamp_", indent_level + 1);
-
-    if (sample->frame_id_==NULL) {
-        RTICdrType_printString(
-            NULL,"frame_id_", indent_level + 1);
-    } else {
-        RTICdrType_printString(
-            sample->frame_id_,"frame_id_", indent_level + 1);    
-    }
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-std_msgs_msg_dds__Header_Plugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        std_msgs_msg_dds__Header__get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-std_msgs_msg_dds__Header_Plugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-std_msgs_msg_dds__Header_Plugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        std_msgs_msg_dds__Header_PluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        std_msgs_msg_dds__Header_PluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = std_msgs_msg_dds__Header_Plugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            std_msgs_msg_dds__Header_Plugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-std_msgs_msg_dds__Header_Plugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-std_msgs_msg_dds__Header_Plugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    std_msgs_msg_dds__Header_ *sample,
-    void *handle)
-{
-    std_msgs_msg_dds__Header__finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-std_msgs_msg_dds__Header_Plugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    std_msgs_msg_dds__Header_ *dst,
-    const std_msgs_msg_dds__Header_ *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return std_msgs_msg_dds__Header_PluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-std_msgs_msg_dds__Header_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-std_msgs_msg_dds__Header_Plugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const std_msgs_msg_dds__Header_ *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    std_msgs_msg_dds__Header__get_typecode();
-    pd.programs = std_msgs_msg_dds__Header_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    std_msgs_msg_dds__Header_Plugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-std_msgs_msg_dds__Header_Plugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const std_msgs_msg_dds__Header_ *sample)
-{
-    return std_msgs_msg_dds__Header_Plugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-std_msgs_msg_dds__Header_Plugin_deserialize_from_cdr_buffer(
-    std_msgs_msg_dds__Header_ *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    std_msgs_msg_dds__Header__get_typecode();
-    pd.programs = std_msgs_msg_dds__Header_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    std_msgs_msg_dds__Header__finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-std_msgs_msg_dds__Header_Plugin_data_to_string(
-    const std_msgs_msg_dds__Header_ *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!std_msgs_msg_dds__Header_Plugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!std_msgs_msg_dds__Header_Plugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        std_msgs_msg_dds__Header__get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-std_msgs_msg_dds__Header_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-std_msgs_msg_dds__Header_Plugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool std_msgs_msg_dds__Header_Plugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    std_msgs_msg_dds__Header_ **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-std_msgs_msg_dds__Header_Plugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-std_msgs_msg_dds__Header_Plugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *std_msgs_msg_dds__Header_Plugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    std_msgs_msg_dds__Header_, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *std_msgs_msg_dds__Header_Plugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    std_msgs_msg_dds__Header_Plugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    std_msgs_msg_dds__Header_Plugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    std_msgs_msg_dds__Header_Plugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    std_msgs_msg_dds__Header_Plugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    std_msgs_msg_dds__Header_Plugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    std_msgs_msg_dds__Header_Plugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    std_msgs_msg_dds__Header_Plugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    std_msgs_msg_dds__Header__finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    std_msgs_msg_dds__Header_Plugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    std_msgs_msg_dds__Header_Plugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    std_msgs_msg_dds__Header_Plugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    std_msgs_msg_dds__Header_Plugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)std_msgs_msg_dds__Header__get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    std_msgs_msg_dds__Header_Plugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    std_msgs_msg_dds__Header_Plugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = std_msgs_msg_dds__Header_TYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-std_msgs_msg_dds__Header_Plugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type sensor_msgs_msg_dds__PointField_
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-sensor_msgs_msg_dds__PointField_*
-sensor_msgs_msg_dds__PointField_PluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    sensor_msgs_msg_dds__PointField_ *sample = NULL;
-
-    sample = new (std::nothrow) sensor_msgs_msg_dds__PointField_ ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!sensor_msgs_msg_dds__PointField__initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-sensor_msgs_msg_dds__PointField_ *
-sensor_msgs_msg_dds__PointField_PluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    sensor_msgs_msg_dds__PointField_ *sample = NULL;
-
-    sample = new (std::nothrow) sensor_msgs_msg_dds__PointField_ ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!sensor_msgs_msg_dds__PointField__initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-sensor_msgs_msg_dds__PointField_ *
-sensor_msgs_msg_dds__PointField_PluginSupport_create_data(void)
-{
-    return sensor_msgs_msg_dds__PointField_PluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-sensor_msgs_msg_dds__PointField_PluginSupport_destroy_data_w_params(
-    sensor_msgs_msg_dds__PointField_ *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    sensor_msgs_msg_dds__PointField__finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-sensor_msgs_msg_dds__PointField_PluginSupport_destroy_data_ex(
-    sensor_msgs_msg_dds__PointField_ *sample,RTIBool deallocate_pointers) {
-    sensor_msgs_msg_dds__PointField__finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-sensor_msgs_msg_dds__PointField_PluginSupport_destroy_data(
-    sensor_msgs_msg_dds__PointField_ *sample) {
-
-    sensor_msgs_msg_dds__PointField_PluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-sensor_msgs_msg_dds__PointField_PluginSupport_copy_data(
-    sensor_msgs_msg_dds__PointField_ *dst,
-    const sensor_msgs_msg_dds__PointField_ *src)
-{
-    return sensor_msgs_msg_dds__PointField__copy(dst,(const sensor_msgs_msg_dds__PointField_*) src);
-}
-
-void 
-sensor_msgs_msg_dds__PointField_PluginSupport_print_data(
-    const sensor_msgs_msg_dds__PointField_ *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    if (sample->name_==NULL) {
-        RTICdrType_printString(
-            NULL,"name_", indent_level + 1);
-    } else {
-        RTICdrType_printString(
-            sample->name_,"name_", indent_level + 1);    
-    }
-
-    RTICdrType_printUnsignedLong(
-        &sample->offset_, "offset_", indent_level + 1);    
-
-    RTICdrType_printOctet(
-        &sample->datatype_, "datatype_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->count_, "count_", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-sensor_msgs_msg_dds__PointField_Plugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        sensor_msgs_msg_dds__PointField__get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-sensor_msgs_msg_dds__PointField_Plugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-sensor_msgs_msg_dds__PointField_Plugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        sensor_msgs_msg_dds__PointField_PluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        sensor_msgs_msg_dds__PointField_PluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = sensor_msgs_msg_dds__PointField_Plugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            sensor_msgs_msg_dds__PointField_Plugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-sensor_msgs_msg_dds__PointField_Plugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-sensor_msgs_msg_dds__PointField_Plugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    sensor_msgs_msg_dds__PointField_ *sample,
-    void *handle)
-{
-    sensor_msgs_msg_dds__PointField__finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-sensor_msgs_msg_dds__PointField_Plugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    sensor_msgs_msg_dds__PointField_ *dst,
-    const sensor_msgs_msg_dds__PointField_ *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return sensor_msgs_msg_dds__PointField_PluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-sensor_msgs_msg_dds__PointField_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-sensor_msgs_msg_dds__PointField_Plugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const sensor_msgs_msg_dds__PointField_ *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    sensor_msgs_msg_dds__PointField__get_typecode();
-    pd.programs = sensor_msgs_msg_dds__PointField_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    sensor_msgs_msg_dds__PointField_Plugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-sensor_msgs_msg_dds__PointField_Plugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const sensor_msgs_msg_dds__PointField_ *sample)
-{
-    return sensor_msgs_msg_dds__PointField_Plugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-sensor_msgs_msg_dds__PointField_Plugin_deserialize_from_cdr_buffer(
-    sensor_msgs_msg_dds__PointField_ *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    sensor_msgs_msg_dds__PointField__get_typecode();
-    pd.programs = sensor_msgs_msg_dds__PointField_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    sensor_msgs_msg_dds__PointField__finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-sensor_msgs_msg_dds__PointField_Plugin_data_to_string(
-    const sensor_msgs_msg_dds__PointField_ *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!sensor_msgs_msg_dds__PointField_Plugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!sensor_msgs_msg_dds__PointField_Plugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        sensor_msgs_msg_dds__PointField__get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-sensor_msgs_msg_dds__PointField_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-sensor_msgs_msg_dds__PointField_Plugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool sensor_msgs_msg_dds__PointField_Plugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    sensor_msgs_msg_dds__PointField_ **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-sensor_msgs_msg_dds__PointField_Plugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-sensor_msgs_msg_dds__PointField_Plugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *sensor_msgs_msg_dds__PointField_Plugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    sensor_msgs_msg_dds__PointField_, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *sensor_msgs_msg_dds__PointField_Plugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    sensor_msgs_msg_dds__PointField_Plugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    sensor_msgs_msg_dds__PointField_Plugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    sensor_msgs_msg_dds__PointField_Plugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    sensor_msgs_msg_dds__PointField_Plugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    sensor_msgs_msg_dds__PointField__finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)sensor_msgs_msg_dds__PointField__get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    sensor_msgs_msg_dds__PointField_Plugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = sensor_msgs_msg_dds__PointField_TYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-sensor_msgs_msg_dds__PointField_Plugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type sensor_msgs_msg_dds__PointCloud2_
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-sensor_msgs_msg_dds__PointCloud2_*
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    sensor_msgs_msg_dds__PointCloud2_ *sample = NULL;
-
-    sample = new (std::nothrow) sensor_msgs_msg_dds__PointCloud2_ ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!sensor_msgs_msg_dds__PointCloud2__initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-sensor_msgs_msg_dds__PointCloud2_ *
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    sensor_msgs_msg_dds__PointCloud2_ *sample = NULL;
-
-    sample = new (std::nothrow) sensor_msgs_msg_dds__PointCloud2_ ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!sensor_msgs_msg_dds__PointCloud2__initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-sensor_msgs_msg_dds__PointCloud2_ *
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_create_data(void)
-{
-    return sensor_msgs_msg_dds__PointCloud2_PluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_destroy_data_w_params(
-    sensor_msgs_msg_dds__PointCloud2_ *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    sensor_msgs_msg_dds__PointCloud2__finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_destroy_data_ex(
-    sensor_msgs_msg_dds__PointCloud2_ *sample,RTIBool deallocate_pointers) {
-    sensor_msgs_msg_dds__PointCloud2__finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_destroy_data(
-    sensor_msgs_msg_dds__PointCloud2_ *sample) {
-
-    sensor_msgs_msg_dds__PointCloud2_PluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_copy_data(
-    sensor_msgs_msg_dds__PointCloud2_ *dst,
-    const sensor_msgs_msg_dds__PointCloud2_ *src)
-{
-    return sensor_msgs_msg_dds__PointCloud2__copy(dst,(const sensor_msgs_msg_dds__PointCloud2_*) src);
-}
-
-void 
-sensor_msgs_msg_dds__PointCloud2_PluginSupport_print_data(
-    const sensor_msgs_msg_dds__PointCloud2_ *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    std_msgs_msg_dds__Header_PluginSupport_print_data(
-        (const std_msgs_msg_dds__Header_*) &sample->header_, "header_", indent_level + 1);
-
-    RTICdrType_printUnsignedLong(
-        &sample->height_, "height_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->width_, "width_", indent_level + 1);    
-
-    if (sensor_msgs_msg_dds__PointField_Seq_get_contiguous_bufferI(&sample->fields_) != NULL) {
-        RTICdrType_printArray(
-            sensor_msgs_msg_dds__PointField_Seq_get_contiguous_bufferI(&sample->fields_), 
-            sensor_msgs_msg_dds__PointField_Seq_get_length(&sample->fields_),
-            sizeof(sensor_msgs_msg_dds__PointField_),
-            (RTICdrTypePrintFunction)sensor_msgs_msg_dds__PointField_PluginSupport_print_data,
-            "fields_", indent_level + 1);
-    } else {
-        RTICdrType_printPointerArray(
-            sensor_msgs_msg_dds__PointField_Seq_get_discontiguous_bufferI(&sample->fields_), 
-            sensor_msgs_msg_dds__PointField_Seq_get_length(&sample->fields_),
-            (RTICdrTypePrintFunction)sensor_msgs_msg_dds__PointField_PluginSupport_print_data,
-            "fields_", indent_level + 1);
-    }
-
-    RTICdrType_printBoolean(
-        &sample->is_bigendian_, "is_bigendian_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->point_step_, "point_step_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->row_step_, "row_step_", indent_level + 1);    
-
-    if (DDS_OctetSeq_get_contiguous_bufferI(&sample->data_) != NULL) {
-        RTICdrType_printArray(
-            DDS_OctetSeq_get_contiguous_bufferI(&sample->data_),
-            DDS_OctetSeq_get_length(&sample->data_),
-            RTI_CDR_OCTET_SIZE,
-            (RTICdrTypePrintFunction)RTICdrType_printOctet,
-            "data_", indent_level + 1);
-    } else {
-        RTICdrType_printPointerArray(
-            DDS_OctetSeq_get_discontiguous_bufferI(&sample->data_),
-            DDS_OctetSeq_get_length(&sample->data_ ),
-            (RTICdrTypePrintFunction)RTICdrType_printOctet,
-            "data_", indent_level + 1);
-    }
-
-    RTICdrType_printBoolean(
-        &sample->is_dense_, "is_dense_", indent_level + 1);    
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-sensor_msgs_msg_dds__PointCloud2_Plugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        sensor_msgs_msg_dds__PointCloud2__get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-sensor_msgs_msg_dds__PointCloud2_Plugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-sensor_msgs_msg_dds__PointCloud2_Plugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        sensor_msgs_msg_dds__PointCloud2_PluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        sensor_msgs_msg_dds__PointCloud2_PluginSupport_destroy_data,
-        NULL , NULL );
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-sensor_msgs_msg_dds__PointCloud2_Plugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-sensor_msgs_msg_dds__PointCloud2_Plugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    sensor_msgs_msg_dds__PointCloud2_ *sample,
-    void *handle)
-{
-    sensor_msgs_msg_dds__PointCloud2__finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-sensor_msgs_msg_dds__PointCloud2_Plugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    sensor_msgs_msg_dds__PointCloud2_ *dst,
-    const sensor_msgs_msg_dds__PointCloud2_ *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return sensor_msgs_msg_dds__PointCloud2_PluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-sensor_msgs_msg_dds__PointCloud2_Plugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const sensor_msgs_msg_dds__PointCloud2_ *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    sensor_msgs_msg_dds__PointCloud2__get_typecode();
-    pd.programs = sensor_msgs_msg_dds__PointCloud2_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-sensor_msgs_msg_dds__PointCloud2_Plugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const sensor_msgs_msg_dds__PointCloud2_ *sample)
-{
-    return sensor_msgs_msg_dds__PointCloud2_Plugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-sensor_msgs_msg_dds__PointCloud2_Plugin_deserialize_from_cdr_buffer(
-    sensor_msgs_msg_dds__PointCloud2_ *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    sensor_msgs_msg_dds__PointCloud2__get_typecode();
-    pd.programs = sensor_msgs_msg_dds__PointCloud2_Plugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    sensor_msgs_msg_dds__PointCloud2__finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-sensor_msgs_msg_dds__PointCloud2_Plugin_data_to_string(
-    const sensor_msgs_msg_dds__PointCloud2_ *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!sensor_msgs_msg_dds__PointCloud2_Plugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!sensor_msgs_msg_dds__PointCloud2_Plugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        sensor_msgs_msg_dds__PointCloud2__get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-sensor_msgs_msg_dds__PointCloud2_Plugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_NO_KEY;
-}
-
-RTIBool sensor_msgs_msg_dds__PointCloud2_Plugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    sensor_msgs_msg_dds__PointCloud2_ **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-struct RTIXCdrInterpreterPrograms *sensor_msgs_msg_dds__PointCloud2_Plugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    sensor_msgs_msg_dds__PointCloud2_, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *sensor_msgs_msg_dds__PointCloud2_Plugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    sensor_msgs_msg_dds__PointCloud2__finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_get_key_kind;
-
-    /* These functions are only used for keyed types. As this is not a keyed
-    type they are all set to NULL
-    */
-    plugin->serializeKeyFnc = NULL ;    
-    plugin->deserializeKeyFnc = NULL;  
-    plugin->getKeyFnc = NULL;
-    plugin->returnKeyFnc = NULL;
-    plugin->instanceToKeyFnc = NULL;
-    plugin->keyToInstanceFnc = NULL;
-    plugin->getSerializedKeyMaxSizeFnc = NULL;
-    plugin->instanceToKeyHashFnc = NULL;
-    plugin->serializedSampleToKeyHashFnc = NULL;
-    plugin->serializedKeyToKeyHashFnc = NULL;    
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)sensor_msgs_msg_dds__PointCloud2__get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    sensor_msgs_msg_dds__PointCloud2_Plugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = sensor_msgs_msg_dds__PointCloud2_TYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-sensor_msgs_msg_dds__PointCloud2_Plugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-
-unsigned int 
-ShapeFillKindPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int initial_alignment = current_alignment;
-
-    current_alignment += PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,
-        NULL,
-        include_encapsulation,
-        encapsulation_id, current_alignment);
-
-    return current_alignment - initial_alignment;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-/* ----------------------------------------------------------------------------
-Support functions:
-* ---------------------------------------------------------------------------- */
-
-void ShapeFillKindPluginSupport_print_data(
-    const ShapeFillKind *sample,
-    const char *description, int indent_level)
-{
-    if (description != NULL) {
-        RTICdrType_printIndent(indent_level);
-        RTILog_debug("%s:\n", description);
-    }
-
-    if (sample == NULL) {
-        RTICdrType_printIndent(indent_level+1);
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printEnum((RTICdrEnum *)sample, "ShapeFillKind", indent_level + 1);
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-
-/* ----------------------------------------------------------------------------
-*  Type ShapeType
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-ShapeType*
-ShapeTypePluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    ShapeType *sample = NULL;
-
-    sample = new (std::nothrow) ShapeType ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!ShapeType_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-ShapeType *
-ShapeTypePluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    ShapeType *sample = NULL;
-
-    sample = new (std::nothrow) ShapeType ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!ShapeType_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-ShapeType *
-ShapeTypePluginSupport_create_data(void)
-{
-    return ShapeTypePluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-ShapeTypePluginSupport_destroy_data_w_params(
-    ShapeType *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    ShapeType_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-ShapeTypePluginSupport_destroy_data_ex(
-    ShapeType *sample,RTIBool deallocate_pointers) {
-    ShapeType_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-ShapeTypePluginSupport_destroy_data(
-    ShapeType *sample) {
-
-    ShapeTypePluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-ShapeTypePluginSupport_copy_data(
-    ShapeType *dst,
-    const ShapeType *src)
-{
-    return ShapeType_copy(dst,(const ShapeType*) src);
-}
-
-void 
-ShapeTypePluginSupport_print_data(
-    const ShapeType *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    if (sample->color==NULL) {
-        RTICdrType_printString(
-            NULL,"color", indent_level + 1);
-    } else {
-        RTICdrType_printString(
-            sample->color,"color", indent_level + 1);    
-    }
-
-    RTICdrType_printLong(
-        &sample->x, "x", indent_level + 1);    
-
-    RTICdrType_printLong(
-        &sample->y, "y", indent_level + 1);    
-
-    RTICdrType_printLong(
-        &sample->shapesize, "shapesize", indent_level + 1);    
-
-}
-
-ShapeType *
-ShapeTypePluginSupport_create_key_ex(RTIBool allocate_pointers){
-    ShapeType *key = NULL;
-
-    key = new (std::nothrow) ShapeTypeKeyHolder ;
-
-    ShapeType_initialize_ex(key,allocate_pointers, RTI_TRUE);
-
-    return key;
-}
-
-ShapeType *
-ShapeTypePluginSupport_create_key(void)
-{
-    return  ShapeTypePluginSupport_create_key_ex(RTI_TRUE);
-}
-
-void 
-ShapeTypePluginSupport_destroy_key_ex(
-    ShapeTypeKeyHolder *key,RTIBool deallocate_pointers)
-{
-    ShapeType_finalize_ex(key,deallocate_pointers);
-
-    delete  key;
-    key=NULL;
-}
-
-void 
-ShapeTypePluginSupport_destroy_key(
-    ShapeTypeKeyHolder *key) {
-
-    ShapeTypePluginSupport_destroy_key_ex(key,RTI_TRUE);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-ShapeTypePlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        ShapeType_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-ShapeTypePlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-ShapeTypePlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    unsigned int serializedKeyMaxSize = 0;
-    unsigned int serializedKeyMaxSizeV2 = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        ShapeTypePluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        ShapeTypePluginSupport_destroy_data,
-        (PRESTypePluginDefaultEndpointDataCreateKeyFunction)
-        ShapeTypePluginSupport_create_key ,            (PRESTypePluginDefaultEndpointDataDestroyKeyFunction)
-        ShapeTypePluginSupport_destroy_key);
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    serializedKeyMaxSize =  ShapeTypePlugin_get_serialized_key_max_size(
-        epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-    serializedKeyMaxSizeV2 =  ShapeTypePlugin_get_serialized_key_max_size_for_keyhash(
-        epd,
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE,
-        0);
-
-    if(!PRESTypePluginDefaultEndpointData_createMD5StreamWithInfo(
-        epd,
-        endpoint_info,
-        serializedKeyMaxSize,
-        serializedKeyMaxSizeV2))  
-    {
-        PRESTypePluginDefaultEndpointData_delete(epd);
-        return NULL;
-    }
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = ShapeTypePlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            ShapeTypePlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-ShapeTypePlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-ShapeTypePlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeType *sample,
-    void *handle)
-{
-    ShapeType_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-ShapeTypePlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeType *dst,
-    const ShapeType *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return ShapeTypePluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-ShapeTypePlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-ShapeTypePlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const ShapeType *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    ShapeType_get_typecode();
-    pd.programs = ShapeTypePlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    ShapeTypePlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-ShapeTypePlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const ShapeType *sample)
-{
-    return ShapeTypePlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-ShapeTypePlugin_deserialize_from_cdr_buffer(
-    ShapeType *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    ShapeType_get_typecode();
-    pd.programs = ShapeTypePlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    ShapeType_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-ShapeTypePlugin_data_to_string(
-    const ShapeType *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!ShapeTypePlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!ShapeTypePlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        ShapeType_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-ShapeTypePlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-ShapeTypePlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_USER_KEY;
-}
-
-RTIBool ShapeTypePlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeType **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-ShapeTypePlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-ShapeTypePlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-RTIBool 
-ShapeTypePlugin_instance_to_key(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeTypeKeyHolder *dst, 
-    const ShapeType *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */   
-
-    if (!RTICdrType_copyStringEx (
-        &dst->color, src->color, 
-        (128) + 1, RTI_FALSE)){
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-ShapeTypePlugin_key_to_instance(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeType *dst, const
-    ShapeTypeKeyHolder *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */   
-    if (!RTICdrType_copyStringEx (
-        &dst->color, src->color, 
-        (128) + 1, RTI_FALSE)){
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-ShapeTypePlugin_instance_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    DDS_KeyHash_t *keyhash,
-    const ShapeType *instance,
-    RTIEncapsulationId encapsulationId)
-{
-    struct RTICdrStream * md5Stream = NULL;
-    struct RTICdrStreamState cdrState;
-    char * buffer = NULL;
-    RTIXCdrBoolean iCdrv2;
-
-    iCdrv2 = RTIXCdrEncapsulationId_isCdrV2(encapsulationId);
-    RTICdrStreamState_init(&cdrState);
-    md5Stream = PRESTypePluginDefaultEndpointData_getMD5Stream(endpoint_data);
-
-    if (md5Stream == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTICdrStream_resetPosition(md5Stream);
-    RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-
-    if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-        endpoint_data,
-        instance,
-        md5Stream,
-        iCdrv2?
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-        RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-        NULL)) 
-    {
-        int size;
-
-        RTICdrStream_pushState(md5Stream, &cdrState, -1);
-
-        size = (int)PRESTypePlugin_interpretedGetSerializedSampleSize(
-            endpoint_data,
-            RTI_FALSE,
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            0,
-            instance);
-
-        if (size <= RTICdrStream_getBufferLength(md5Stream)) {
-            RTICdrStream_popState(md5Stream, &cdrState);        
-            return RTI_FALSE;
-        }   
-
-        RTIOsapiHeap_allocateBuffer(&buffer,size,0);
-
-        if (buffer == NULL) {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            return RTI_FALSE;
-        }
-
-        RTICdrStream_set(md5Stream, buffer, size);
-        RTIOsapiMemory_zero(
-            RTICdrStream_getBuffer(md5Stream),
-            RTICdrStream_getBufferLength(md5Stream));
-        RTICdrStream_resetPosition(md5Stream);
-        RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-        if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-            endpoint_data,
-            instance,
-            md5Stream, 
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            NULL)) 
-        {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            RTIOsapiHeap_freeBuffer(buffer);
-            return RTI_FALSE;
-        }        
-    }   
-
-    if (PRESTypePluginDefaultEndpointData_getMaxSizeSerializedKey(endpoint_data, iCdrv2) > 
-    (unsigned int)(MIG_RTPS_KEY_HASH_MAX_LENGTH) ||
-    PRESTypePluginDefaultEndpointData_forceMD5KeyHash(endpoint_data)) {
-        RTICdrStream_computeMD5(md5Stream, keyhash->value);
-    } else {
-        RTIOsapiMemory_zero(keyhash->value,MIG_RTPS_KEY_HASH_MAX_LENGTH);
-        RTIOsapiMemory_copy(
-            keyhash->value, 
-            RTICdrStream_getBuffer(md5Stream), 
-            RTICdrStream_getCurrentPositionOffset(md5Stream));
-    }
-
-    keyhash->length = MIG_RTPS_KEY_HASH_MAX_LENGTH;
-
-    if (buffer != NULL) {
-        RTICdrStream_popState(md5Stream, &cdrState);
-        RTIOsapiHeap_freeBuffer(buffer);
-    }
-
-    return RTI_TRUE;
-}
-
-RTIBool 
-ShapeTypePlugin_serialized_sample_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    struct RTICdrStream *stream, 
-    DDS_KeyHash_t *keyhash,
-    RTIBool deserialize_encapsulation,
-    void *endpoint_plugin_qos) 
-{   
-    ShapeType * sample = NULL;
-    sample = (ShapeType *)
-    PRESTypePluginDefaultEndpointData_getTempSample(endpoint_data);
-    if (sample == NULL) {
-        return RTI_FALSE;
-    }
-
-    if (!PRESTypePlugin_interpretedSerializedSampleToKey(
-        endpoint_data,
-        sample,
-        stream, 
-        deserialize_encapsulation, 
-        RTI_TRUE,
-        endpoint_plugin_qos)) {
-        return RTI_FALSE;
-    }
-    if (!ShapeTypePlugin_instance_to_keyhash(
-        endpoint_data, 
-        keyhash, 
-        sample,
-        RTICdrStream_getEncapsulationKind(stream))) {
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-struct RTIXCdrInterpreterPrograms *ShapeTypePlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    ShapeType, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *ShapeTypePlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    ShapeTypePlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    ShapeTypePlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    ShapeTypePlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    ShapeTypePlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    ShapeTypePlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    ShapeTypePlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    ShapeTypePlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    ShapeType_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    ShapeTypePlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    ShapeTypePlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    ShapeTypePlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    ShapeTypePlugin_get_key_kind;
-
-    plugin->getSerializedKeyMaxSizeFnc =   
-    (PRESTypePluginGetSerializedKeyMaxSizeFunction)
-    ShapeTypePlugin_get_serialized_key_max_size;
-    plugin->serializeKeyFnc =
-    (PRESTypePluginSerializeKeyFunction)
-    PRESTypePlugin_interpretedSerializeKey;
-    plugin->deserializeKeyFnc =
-    (PRESTypePluginDeserializeKeyFunction)
-    ShapeTypePlugin_deserialize_key;
-    plugin->deserializeKeySampleFnc =
-    (PRESTypePluginDeserializeKeySampleFunction)
-    PRESTypePlugin_interpretedDeserializeKey;
-
-    plugin-> instanceToKeyHashFnc = 
-    (PRESTypePluginInstanceToKeyHashFunction)
-    ShapeTypePlugin_instance_to_keyhash;
-    plugin->serializedSampleToKeyHashFnc = 
-    (PRESTypePluginSerializedSampleToKeyHashFunction)
-    ShapeTypePlugin_serialized_sample_to_keyhash;
-
-    plugin->getKeyFnc =
-    (PRESTypePluginGetKeyFunction)
-    ShapeTypePlugin_get_key;
-    plugin->returnKeyFnc =
-    (PRESTypePluginReturnKeyFunction)
-    ShapeTypePlugin_return_key;
-
-    plugin->instanceToKeyFnc =
-    (PRESTypePluginInstanceToKeyFunction)
-    ShapeTypePlugin_instance_to_key;
-    plugin->keyToInstanceFnc =
-    (PRESTypePluginKeyToInstanceFunction)
-    ShapeTypePlugin_key_to_instance;
-    plugin->serializedKeyToKeyHashFnc = NULL; /* Not supported yet */
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)ShapeType_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    ShapeTypePlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    ShapeTypePlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = ShapeTypeTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-ShapeTypePlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type ShapeTypeExtended
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-ShapeTypeExtended*
-ShapeTypeExtendedPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    ShapeTypeExtended *sample = NULL;
-
-    sample = new (std::nothrow) ShapeTypeExtended ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!ShapeTypeExtended_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-ShapeTypeExtended *
-ShapeTypeExtendedPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    ShapeTypeExtended *sample = NULL;
-
-    sample = new (std::nothrow) ShapeTypeExtended ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!ShapeTypeExtended_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-ShapeTypeExtended *
-ShapeTypeExtendedPluginSupport_create_data(void)
-{
-    return ShapeTypeExtendedPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-ShapeTypeExtendedPluginSupport_destroy_data_w_params(
-    ShapeTypeExtended *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    ShapeTypeExtended_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-ShapeTypeExtendedPluginSupport_destroy_data_ex(
-    ShapeTypeExtended *sample,RTIBool deallocate_pointers) {
-    ShapeTypeExtended_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-ShapeTypeExtendedPluginSupport_destroy_data(
-    ShapeTypeExtended *sample) {
-
-    ShapeTypeExtendedPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-ShapeTypeExtendedPluginSupport_copy_data(
-    ShapeTypeExtended *dst,
-    const ShapeTypeExtended *src)
-{
-    return ShapeTypeExtended_copy(dst,(const ShapeTypeExtended*) src);
-}
-
-void 
-ShapeTypeExtendedPluginSupport_print_data(
-    const ShapeTypeExtended *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    ShapeTypePluginSupport_print_data((const ShapeType*)sample,"",indent_level);
-
-    ShapeFillKindPluginSupport_print_data(
-        (const ShapeFillKind*) &sample->fillKind, "fillKind", indent_level + 1);
-
-    RTICdrType_printFloat(
-        &sample->angle, "angle", indent_level + 1);    
-
-}
-
-ShapeTypeExtended *
-ShapeTypeExtendedPluginSupport_create_key_ex(RTIBool allocate_pointers){
-    ShapeTypeExtended *key = NULL;
-
-    key = new (std::nothrow) ShapeTypeExtendedKeyHolder ;
-
-    ShapeTypeExtended_initialize_ex(key,allocate_pointers, RTI_TRUE);
-
-    return key;
-}
-
-ShapeTypeExtended *
-ShapeTypeExtendedPluginSupport_create_key(void)
-{
-    return  ShapeTypeExtendedPluginSupport_create_key_ex(RTI_TRUE);
-}
-
-void 
-ShapeTypeExtendedPluginSupport_destroy_key_ex(
-    ShapeTypeExtendedKeyHolder *key,RTIBool deallocate_pointers)
-{
-    ShapeTypeExtended_finalize_ex(key,deallocate_pointers);
-
-    delete  key;
-    key=NULL;
-}
-
-void 
-ShapeTypeExtendedPluginSupport_destroy_key(
-    ShapeTypeExtendedKeyHolder *key) {
-
-    ShapeTypeExtendedPluginSupport_destroy_key_ex(key,RTI_TRUE);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-ShapeTypeExtendedPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        ShapeTypeExtended_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-ShapeTypeExtendedPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-ShapeTypeExtendedPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    unsigned int serializedKeyMaxSize = 0;
-    unsigned int serializedKeyMaxSizeV2 = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        ShapeTypeExtendedPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        ShapeTypeExtendedPluginSupport_destroy_data,
-        (PRESTypePluginDefaultEndpointDataCreateKeyFunction)
-        ShapeTypeExtendedPluginSupport_create_key ,            (PRESTypePluginDefaultEndpointDataDestroyKeyFunction)
-        ShapeTypeExtendedPluginSupport_destroy_key);
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    serializedKeyMaxSize =  ShapeTypeExtendedPlugin_get_serialized_key_max_size(
-        epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-    serializedKeyMaxSizeV2 =  ShapeTypeExtendedPlugin_get_serialized_key_max_size_for_keyhash(
-        epd,
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE,
-        0);
-
-    if(!PRESTypePluginDefaultEndpointData_createMD5StreamWithInfo(
-        epd,
-        endpoint_info,
-        serializedKeyMaxSize,
-        serializedKeyMaxSizeV2))  
-    {
-        PRESTypePluginDefaultEndpointData_delete(epd);
-        return NULL;
-    }
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = ShapeTypeExtendedPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            ShapeTypeExtendedPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-ShapeTypeExtendedPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-ShapeTypeExtendedPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeTypeExtended *sample,
-    void *handle)
-{
-    ShapeTypeExtended_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-ShapeTypeExtendedPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeTypeExtended *dst,
-    const ShapeTypeExtended *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return ShapeTypeExtendedPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-ShapeTypeExtendedPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-ShapeTypeExtendedPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const ShapeTypeExtended *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    ShapeTypeExtended_get_typecode();
-    pd.programs = ShapeTypeExtendedPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    ShapeTypeExtendedPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-ShapeTypeExtendedPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const ShapeTypeExtended *sample)
-{
-    return ShapeTypeExtendedPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-ShapeTypeExtendedPlugin_deserialize_from_cdr_buffer(
-    ShapeTypeExtended *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    ShapeTypeExtended_get_typecode();
-    pd.programs = ShapeTypeExtendedPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    ShapeTypeExtended_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-ShapeTypeExtendedPlugin_data_to_string(
-    const ShapeTypeExtended *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!ShapeTypeExtendedPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!ShapeTypeExtendedPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        ShapeTypeExtended_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-ShapeTypeExtendedPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-ShapeTypeExtendedPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_USER_KEY;
-}
-
-RTIBool ShapeTypeExtendedPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeTypeExtended **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-ShapeTypeExtendedPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-ShapeTypeExtendedPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-RTIBool 
-ShapeTypeExtendedPlugin_instance_to_key(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeTypeExtendedKeyHolder *dst, 
-    const ShapeTypeExtended *src)
-{
-    if (!ShapeTypePlugin_instance_to_key(endpoint_data,(ShapeType *)dst,(const ShapeType*)src)) {
-        return RTI_FALSE;
-    }
-
-    return RTI_TRUE;
-}
-
-RTIBool 
-ShapeTypeExtendedPlugin_key_to_instance(
-    PRESTypePluginEndpointData endpoint_data,
-    ShapeTypeExtended *dst, const
-    ShapeTypeExtendedKeyHolder *src)
-{
-    if (!ShapeTypePlugin_key_to_instance(endpoint_data,(ShapeType*)dst,(const ShapeType*)src)) {
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-ShapeTypeExtendedPlugin_instance_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    DDS_KeyHash_t *keyhash,
-    const ShapeTypeExtended *instance,
-    RTIEncapsulationId encapsulationId)
-{
-    struct RTICdrStream * md5Stream = NULL;
-    struct RTICdrStreamState cdrState;
-    char * buffer = NULL;
-    RTIXCdrBoolean iCdrv2;
-
-    iCdrv2 = RTIXCdrEncapsulationId_isCdrV2(encapsulationId);
-    RTICdrStreamState_init(&cdrState);
-    md5Stream = PRESTypePluginDefaultEndpointData_getMD5Stream(endpoint_data);
-
-    if (md5Stream == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTICdrStream_resetPosition(md5Stream);
-    RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-
-    if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-        endpoint_data,
-        instance,
-        md5Stream,
-        iCdrv2?
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-        RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-        NULL)) 
-    {
-        int size;
-
-        RTICdrStream_pushState(md5Stream, &cdrState, -1);
-
-        size = (int)PRESTypePlugin_interpretedGetSerializedSampleSize(
-            endpoint_data,
-            RTI_FALSE,
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            0,
-            instance);
-
-        if (size <= RTICdrStream_getBufferLength(md5Stream)) {
-            RTICdrStream_popState(md5Stream, &cdrState);        
-            return RTI_FALSE;
-        }   
-
-        RTIOsapiHeap_allocateBuffer(&buffer,size,0);
-
-        if (buffer == NULL) {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            return RTI_FALSE;
-        }
-
-        RTICdrStream_set(md5Stream, buffer, size);
-        RTIOsapiMemory_zero(
-            RTICdrStream_getBuffer(md5Stream),
-            RTICdrStream_getBufferLength(md5Stream));
-        RTICdrStream_resetPosition(md5Stream);
-        RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-        if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-            endpoint_data,
-            instance,
-            md5Stream, 
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            NULL)) 
-        {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            RTIOsapiHeap_freeBuffer(buffer);
-            return RTI_FALSE;
-        }        
-    }   
-
-    if (PRESTypePluginDefaultEndpointData_getMaxSizeSerializedKey(endpoint_data, iCdrv2) > 
-    (unsigned int)(MIG_RTPS_KEY_HASH_MAX_LENGTH) ||
-    PRESTypePluginDefaultEndpointData_forceMD5KeyHash(endpoint_data)) {
-        RTICdrStream_computeMD5(md5Stream, keyhash->value);
-    } else {
-        RTIOsapiMemory_zero(keyhash->value,MIG_RTPS_KEY_HASH_MAX_LENGTH);
-        RTIOsapiMemory_copy(
-            keyhash->value, 
-            RTICdrStream_getBuffer(md5Stream), 
-            RTICdrStream_getCurrentPositionOffset(md5Stream));
-    }
-
-    keyhash->length = MIG_RTPS_KEY_HASH_MAX_LENGTH;
-
-    if (buffer != NULL) {
-        RTICdrStream_popState(md5Stream, &cdrState);
-        RTIOsapiHeap_freeBuffer(buffer);
-    }
-
-    return RTI_TRUE;
-}
-
-RTIBool 
-ShapeTypeExtendedPlugin_serialized_sample_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    struct RTICdrStream *stream, 
-    DDS_KeyHash_t *keyhash,
-    RTIBool deserialize_encapsulation,
-    void *endpoint_plugin_qos) 
-{   
-    ShapeTypeExtended * sample = NULL;
-    sample = (ShapeTypeExtended *)
-    PRESTypePluginDefaultEndpointData_getTempSample(endpoint_data);
-    if (sample == NULL) {
-        return RTI_FALSE;
-    }
-
-    if (!PRESTypePlugin_interpretedSerializedSampleToKey(
-        endpoint_data,
-        sample,
-        stream, 
-        deserialize_encapsulation, 
-        RTI_TRUE,
-        endpoint_plugin_qos)) {
-        return RTI_FALSE;
-    }
-    if (!ShapeTypeExtendedPlugin_instance_to_keyhash(
-        endpoint_data, 
-        keyhash, 
-        sample,
-        RTICdrStream_getEncapsulationKind(stream))) {
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-struct RTIXCdrInterpreterPrograms *ShapeTypeExtendedPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    ShapeTypeExtended, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *ShapeTypeExtendedPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    ShapeTypeExtendedPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    ShapeTypeExtendedPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    ShapeTypeExtendedPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    ShapeTypeExtendedPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    ShapeTypeExtendedPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    ShapeTypeExtendedPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    ShapeTypeExtendedPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    ShapeTypeExtended_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    ShapeTypeExtendedPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    ShapeTypeExtendedPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    ShapeTypeExtendedPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    ShapeTypeExtendedPlugin_get_key_kind;
-
-    plugin->getSerializedKeyMaxSizeFnc =   
-    (PRESTypePluginGetSerializedKeyMaxSizeFunction)
-    ShapeTypeExtendedPlugin_get_serialized_key_max_size;
-    plugin->serializeKeyFnc =
-    (PRESTypePluginSerializeKeyFunction)
-    PRESTypePlugin_interpretedSerializeKey;
-    plugin->deserializeKeyFnc =
-    (PRESTypePluginDeserializeKeyFunction)
-    ShapeTypeExtendedPlugin_deserialize_key;
-    plugin->deserializeKeySampleFnc =
-    (PRESTypePluginDeserializeKeySampleFunction)
-    PRESTypePlugin_interpretedDeserializeKey;
-
-    plugin-> instanceToKeyHashFnc = 
-    (PRESTypePluginInstanceToKeyHashFunction)
-    ShapeTypeExtendedPlugin_instance_to_keyhash;
-    plugin->serializedSampleToKeyHashFnc = 
-    (PRESTypePluginSerializedSampleToKeyHashFunction)
-    ShapeTypeExtendedPlugin_serialized_sample_to_keyhash;
-
-    plugin->getKeyFnc =
-    (PRESTypePluginGetKeyFunction)
-    ShapeTypeExtendedPlugin_get_key;
-    plugin->returnKeyFnc =
-    (PRESTypePluginReturnKeyFunction)
-    ShapeTypeExtendedPlugin_return_key;
-
-    plugin->instanceToKeyFnc =
-    (PRESTypePluginInstanceToKeyFunction)
-    ShapeTypeExtendedPlugin_instance_to_key;
-    plugin->keyToInstanceFnc =
-    (PRESTypePluginKeyToInstanceFunction)
-    ShapeTypeExtendedPlugin_key_to_instance;
-    plugin->serializedKeyToKeyHashFnc = NULL; /* Not supported yet */
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)ShapeTypeExtended_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    ShapeTypeExtendedPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    ShapeTypeExtendedPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = ShapeTypeExtendedTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-ShapeTypeExtendedPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-
-/* ----------------------------------------------------------------------------
-*  Type CameraImage_CameraImageData
-* -------------------------------------------------------------------------- */
-
-/* -----------------------------------------------------------------------------
-Support functions:
-* -------------------------------------------------------------------------- */
-
-CameraImage_CameraImageData*
-CameraImage_CameraImageDataPluginSupport_create_data_w_params(
-    const struct DDS_TypeAllocationParams_t * alloc_params) 
-{
-    CameraImage_CameraImageData *sample = NULL;
-
-    sample = new (std::nothrow) CameraImage_CameraImageData ;
-    if (sample == NULL) {
-        return NULL;
-    }
-
-    if (!CameraImage_CameraImageData_initialize_w_params(sample,alloc_params)) {
-        delete  sample;
-        sample=NULL;
-    }
-    return sample;
-} 
-
-CameraImage_CameraImageData *
-CameraImage_CameraImageDataPluginSupport_create_data_ex(RTIBool allocate_pointers) 
-{
-    CameraImage_CameraImageData *sample = NULL;
-
-    sample = new (std::nothrow) CameraImage_CameraImageData ;
-
-    if(sample == NULL) {
-        return NULL;
-    }
-
-    if (!CameraImage_CameraImageData_initialize_ex(sample,allocate_pointers, RTI_TRUE)) {
-        delete  sample;
-        sample=NULL;
-    }
-
-    return sample;
-}
-
-CameraImage_CameraImageData *
-CameraImage_CameraImageDataPluginSupport_create_data(void)
-{
-    return CameraImage_CameraImageDataPluginSupport_create_data_ex(RTI_TRUE);
-}
-
-void 
-CameraImage_CameraImageDataPluginSupport_destroy_data_w_params(
-    CameraImage_CameraImageData *sample,
-    const struct DDS_TypeDeallocationParams_t * dealloc_params) {
-    CameraImage_CameraImageData_finalize_w_params(sample,dealloc_params);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-CameraImage_CameraImageDataPluginSupport_destroy_data_ex(
-    CameraImage_CameraImageData *sample,RTIBool deallocate_pointers) {
-    CameraImage_CameraImageData_finalize_ex(sample,deallocate_pointers);
-
-    delete  sample;
-    sample=NULL;
-}
-
-void 
-CameraImage_CameraImageDataPluginSupport_destroy_data(
-    CameraImage_CameraImageData *sample) {
-
-    CameraImage_CameraImageDataPluginSupport_destroy_data_ex(sample,RTI_TRUE);
-
-}
-
-RTIBool 
-CameraImage_CameraImageDataPluginSupport_copy_data(
-    CameraImage_CameraImageData *dst,
-    const CameraImage_CameraImageData *src)
-{
-    return CameraImage_CameraImageData_copy(dst,(const CameraImage_CameraImageData*) src);
-}
-
-void 
-CameraImage_CameraImageDataPluginSupport_print_data(
-    const CameraImage_CameraImageData *sample,
-    const char *desc,
-    unsigned int indent_level)
-{
-
-    RTICdrType_printIndent(indent_level);
-
-    if (desc != NULL) {
-        RTILog_debug("%s:\n", desc);
-    } else {
-        RTILog_debug("\n");
-    }
-
-    if (sample == NULL) {
-        RTILog_debug("NULL\n");
-        return;
-    }
-
-    RTICdrType_printUnsignedLong(
-        &sample->id, "id", indent_level + 1);    
-
-    RTICdrType_printLong(
-        &sample->sec_, "sec_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->nanosec_, "nanosec_", indent_level + 1);    
-
-    RTICdrType_printUnsignedLong(
-        &sample->seqnum, "seqnum", indent_level + 1);    
-
-    RTICdrType_printArray(
-        sample->data, ((MAX_IMAGE_SIZE)), RTI_CDR_OCTET_SIZE,
-        (RTICdrTypePrintFunction)RTICdrType_printOctet, 
-        "data", indent_level + 1);        
-
-}
-
-CameraImage_CameraImageData *
-CameraImage_CameraImageDataPluginSupport_create_key_ex(RTIBool allocate_pointers){
-    CameraImage_CameraImageData *key = NULL;
-
-    key = new (std::nothrow) CameraImage_CameraImageDataKeyHolder ;
-
-    CameraImage_CameraImageData_initialize_ex(key,allocate_pointers, RTI_TRUE);
-
-    return key;
-}
-
-CameraImage_CameraImageData *
-CameraImage_CameraImageDataPluginSupport_create_key(void)
-{
-    return  CameraImage_CameraImageDataPluginSupport_create_key_ex(RTI_TRUE);
-}
-
-void 
-CameraImage_CameraImageDataPluginSupport_destroy_key_ex(
-    CameraImage_CameraImageDataKeyHolder *key,RTIBool deallocate_pointers)
-{
-    CameraImage_CameraImageData_finalize_ex(key,deallocate_pointers);
-
-    delete  key;
-    key=NULL;
-}
-
-void 
-CameraImage_CameraImageDataPluginSupport_destroy_key(
-    CameraImage_CameraImageDataKeyHolder *key) {
-
-    CameraImage_CameraImageDataPluginSupport_destroy_key_ex(key,RTI_TRUE);
-
-}
-
-/* ----------------------------------------------------------------------------
-Callback functions:
-* ---------------------------------------------------------------------------- */
-
-PRESTypePluginParticipantData 
-CameraImage_CameraImageDataPlugin_on_participant_attached(
-    void *registration_data,
-    const struct PRESTypePluginParticipantInfo *participant_info,
-    RTIBool top_level_registration,
-    void *container_plugin_context,
-    RTICdrTypeCode *type_code)
-{
-    struct RTIXCdrInterpreterPrograms *programs = NULL;
-    struct PRESTypePluginDefaultParticipantData *pd = NULL;
-    struct RTIXCdrInterpreterProgramsGenProperty programProperty =
-    RTIXCdrInterpreterProgramsGenProperty_INITIALIZER;
-
-    if (registration_data) {} /* To avoid warnings */
-    if (participant_info) {} /* To avoid warnings */
-    if (top_level_registration) {} /* To avoid warnings */
-    if (container_plugin_context) {} /* To avoid warnings */
-    if (type_code) {} /* To avoid warnings */
-
-    pd = (struct PRESTypePluginDefaultParticipantData *)
-    PRESTypePluginDefaultParticipantData_new(participant_info);
-
-    programProperty.generateV1Encapsulation = RTI_XCDR_TRUE;
-    programProperty.generateV2Encapsulation = RTI_XCDR_TRUE;
-    programProperty.resolveAlias = RTI_XCDR_TRUE;
-    programProperty.inlineStruct = RTI_XCDR_TRUE;
-    programProperty.optimizeEnum = RTI_XCDR_TRUE;
-
-    programs = DDS_TypeCodeFactory_assert_programs_in_global_list(
-        DDS_TypeCodeFactory_get_instance(),
-        CameraImage_CameraImageData_get_typecode(),
-        &programProperty,
-        RTI_XCDR_PROGRAM_MASK_TYPEPLUGIN);
-    if (programs == NULL) {
-        PRESTypePluginDefaultParticipantData_delete(
-            (PRESTypePluginParticipantData) pd);
-        return NULL;
-    }
-
-    pd->programs = programs;
-    return (PRESTypePluginParticipantData)pd;
-}
-
-void 
-CameraImage_CameraImageDataPlugin_on_participant_detached(
-    PRESTypePluginParticipantData participant_data)
-{  		
-    if (participant_data != NULL) {
-        struct PRESTypePluginDefaultParticipantData *pd = 
-        (struct PRESTypePluginDefaultParticipantData *)participant_data;
-
-        if (pd->programs != NULL) {
-            DDS_TypeCodeFactory_remove_programs_from_global_list(
-                DDS_TypeCodeFactory_get_instance(),
-                pd->programs);
-            pd->programs = NULL;
-        }
-        PRESTypePluginDefaultParticipantData_delete(participant_data);
-    }
-}
-
-PRESTypePluginEndpointData
-CameraImage_CameraImageDataPlugin_on_endpoint_attached(
-    PRESTypePluginParticipantData participant_data,
-    const struct PRESTypePluginEndpointInfo *endpoint_info,
-    RTIBool top_level_registration, 
-    void *containerPluginContext)
-{
-    PRESTypePluginEndpointData epd = NULL;
-    unsigned int serializedSampleMaxSize = 0;
-
-    unsigned int serializedKeyMaxSize = 0;
-    unsigned int serializedKeyMaxSizeV2 = 0;
-
-    if (top_level_registration) {} /* To avoid warnings */
-    if (containerPluginContext) {} /* To avoid warnings */
-
-    if (participant_data == NULL) {
-        return NULL;
-    } 
-
-    epd = PRESTypePluginDefaultEndpointData_new(
-        participant_data,
-        endpoint_info,
-        (PRESTypePluginDefaultEndpointDataCreateSampleFunction)
-        CameraImage_CameraImageDataPluginSupport_create_data,
-        (PRESTypePluginDefaultEndpointDataDestroySampleFunction)
-        CameraImage_CameraImageDataPluginSupport_destroy_data,
-        (PRESTypePluginDefaultEndpointDataCreateKeyFunction)
-        CameraImage_CameraImageDataPluginSupport_create_key ,            (PRESTypePluginDefaultEndpointDataDestroyKeyFunction)
-        CameraImage_CameraImageDataPluginSupport_destroy_key);
-
-    if (epd == NULL) {
-        return NULL;
-    } 
-
-    serializedKeyMaxSize =  CameraImage_CameraImageDataPlugin_get_serialized_key_max_size(
-        epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-    serializedKeyMaxSizeV2 =  CameraImage_CameraImageDataPlugin_get_serialized_key_max_size_for_keyhash(
-        epd,
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE,
-        0);
-
-    if(!PRESTypePluginDefaultEndpointData_createMD5StreamWithInfo(
-        epd,
-        endpoint_info,
-        serializedKeyMaxSize,
-        serializedKeyMaxSizeV2))  
-    {
-        PRESTypePluginDefaultEndpointData_delete(epd);
-        return NULL;
-    }
-
-    if (endpoint_info->endpointKind == PRES_TYPEPLUGIN_ENDPOINT_WRITER) {
-        serializedSampleMaxSize = CameraImage_CameraImageDataPlugin_get_serialized_sample_max_size(
-            epd,RTI_FALSE,RTI_CDR_ENCAPSULATION_ID_CDR_BE,0);
-        PRESTypePluginDefaultEndpointData_setMaxSizeSerializedSample(epd, serializedSampleMaxSize);
-
-        if (PRESTypePluginDefaultEndpointData_createWriterPool(
-            epd,
-            endpoint_info,
-            (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-            CameraImage_CameraImageDataPlugin_get_serialized_sample_max_size, epd,
-            (PRESTypePluginGetSerializedSampleSizeFunction)
-            PRESTypePlugin_interpretedGetSerializedSampleSize,
-            epd) == RTI_FALSE) {
-            PRESTypePluginDefaultEndpointData_delete(epd);
-            return NULL;
-        }
-    }
-
-    return epd;    
-}
-
-void 
-CameraImage_CameraImageDataPlugin_on_endpoint_detached(
-    PRESTypePluginEndpointData endpoint_data)
-{
-    PRESTypePluginDefaultEndpointData_delete(endpoint_data);
-}
-
-void    
-CameraImage_CameraImageDataPlugin_return_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    CameraImage_CameraImageData *sample,
-    void *handle)
-{
-    CameraImage_CameraImageData_finalize_optional_members(sample, RTI_TRUE);
-
-    PRESTypePluginDefaultEndpointData_returnSample(
-        endpoint_data, sample, handle);
-}
-
-RTIBool 
-CameraImage_CameraImageDataPlugin_copy_sample(
-    PRESTypePluginEndpointData endpoint_data,
-    CameraImage_CameraImageData *dst,
-    const CameraImage_CameraImageData *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */
-    return CameraImage_CameraImageDataPluginSupport_copy_data(dst,src);
-}
-
-/* ----------------------------------------------------------------------------
-(De)Serialize functions:
-* ------------------------------------------------------------------------- */
-unsigned int 
-CameraImage_CameraImageDataPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment);
-
-RTIBool
-CameraImage_CameraImageDataPlugin_serialize_to_cdr_buffer_ex(
-    char *buffer,
-    unsigned int *length,
-    const CameraImage_CameraImageData *sample,
-    DDS_DataRepresentationId_t representation)
-{
-    RTIEncapsulationId encapsulationId = RTI_CDR_ENCAPSULATION_ID_INVALID;
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    RTIBool result;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePlugin plugin;
-
-    if (length == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTIOsapiMemory_zero(&epd, sizeof(struct PRESTypePluginDefaultEndpointData));
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    CameraImage_CameraImageData_get_typecode();
-    pd.programs = CameraImage_CameraImageDataPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    encapsulationId = DDS_TypeCode_get_native_encapsulation(
-        (DDS_TypeCode *) plugin.typeCode,
-        representation);    
-    if (encapsulationId == RTI_CDR_ENCAPSULATION_ID_INVALID) {
-        return RTI_FALSE;
-    }
-
-    epd._maxSizeSerializedSample =
-    CameraImage_CameraImageDataPlugin_get_serialized_sample_max_size(
-        (PRESTypePluginEndpointData)&epd, 
-        RTI_TRUE, 
-        encapsulationId,
-        0);
-
-    if (buffer == NULL) {
-        *length = 
-        PRESTypePlugin_interpretedGetSerializedSampleSize(
-            (PRESTypePluginEndpointData)&epd,
-            RTI_TRUE,
-            encapsulationId,
-            0,
-            sample);
-
-        if (*length == 0) {
-            return RTI_FALSE;
-        }
-
-        return RTI_TRUE;
-    }    
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, *length);
-
-    result = PRESTypePlugin_interpretedSerialize(
-        (PRESTypePluginEndpointData)&epd,
-        sample,
-        &stream,
-        RTI_TRUE,
-        encapsulationId,
-        RTI_TRUE,
-        NULL);
-
-    *length = RTICdrStream_getCurrentPositionOffset(&stream);
-    return result;
-}
-
-RTIBool
-CameraImage_CameraImageDataPlugin_serialize_to_cdr_buffer(
-    char *buffer,
-    unsigned int *length,
-    const CameraImage_CameraImageData *sample)
-{
-    return CameraImage_CameraImageDataPlugin_serialize_to_cdr_buffer_ex(
-        buffer,
-        length,
-        sample,
-        DDS_AUTO_DATA_REPRESENTATION);
-}
-
-RTIBool
-CameraImage_CameraImageDataPlugin_deserialize_from_cdr_buffer(
-    CameraImage_CameraImageData *sample,
-    const char * buffer,
-    unsigned int length)
-{
-    struct RTICdrStream stream;
-    struct PRESTypePluginDefaultEndpointData epd;
-    struct RTIXCdrTypePluginProgramContext defaultProgramConext =
-    RTIXCdrTypePluginProgramContext_INTIALIZER;
-    struct PRESTypePluginDefaultParticipantData pd;
-    struct PRESTypePlugin plugin;
-
-    epd.programContext = defaultProgramConext;  
-    epd._participantData = &pd;
-    epd.typePlugin = &plugin;
-    epd.programContext.endpointPluginData = &epd;
-    plugin.typeCode = (struct RTICdrTypeCode *)
-    CameraImage_CameraImageData_get_typecode();
-    pd.programs = CameraImage_CameraImageDataPlugin_get_programs();
-    if (pd.programs == NULL) {
-        return RTI_FALSE;
-    }
-
-    epd._assignabilityProperty.acceptUnknownEnumValue = RTI_XCDR_TRUE;
-    epd._assignabilityProperty.acceptUnknownUnionDiscriminator = RTI_XCDR_TRUE;
-
-    RTICdrStream_init(&stream);
-    RTICdrStream_set(&stream, (char *)buffer, length);
-
-    CameraImage_CameraImageData_finalize_optional_members(sample, RTI_TRUE);
-    return PRESTypePlugin_interpretedDeserialize( 
-        (PRESTypePluginEndpointData)&epd, sample,
-        &stream, RTI_TRUE, RTI_TRUE, 
-        NULL);
-}
-
-#ifndef NDDS_STANDALONE_TYPE
-DDS_ReturnCode_t
-CameraImage_CameraImageDataPlugin_data_to_string(
-    const CameraImage_CameraImageData *sample,
-    char *str,
-    DDS_UnsignedLong *str_size, 
-    const struct DDS_PrintFormatProperty *property)
-{
-    DDS_DynamicData *data = NULL;
-    char *buffer = NULL;
-    unsigned int length = 0;
-    struct DDS_PrintFormat printFormat;
-    DDS_ReturnCode_t retCode = DDS_RETCODE_ERROR;
-
-    if (sample == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (str_size == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-
-    if (property == NULL) {
-        return DDS_RETCODE_BAD_PARAMETER;
-    }
-    if (!CameraImage_CameraImageDataPlugin_serialize_to_cdr_buffer(
-        NULL, 
-        &length, 
-        sample)) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    RTIOsapiHeap_allocateBuffer(&buffer, length, RTI_OSAPI_ALIGNMENT_DEFAULT);
-    if (buffer == NULL) {
-        return DDS_RETCODE_ERROR;
-    }
-
-    if (!CameraImage_CameraImageDataPlugin_serialize_to_cdr_buffer(
-        buffer, 
-        &length, 
-        sample)) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-    data = DDS_DynamicData_new(
-        CameraImage_CameraImageData_get_typecode(), 
-        &DDS_DYNAMIC_DATA_PROPERTY_DEFAULT);
-    if (data == NULL) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        return DDS_RETCODE_ERROR;
-    }
-
-    retCode = DDS_DynamicData_from_cdr_buffer(data, buffer, length);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_PrintFormatProperty_to_print_format(
-        property, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    retCode = DDS_DynamicDataFormatter_to_string_w_format(
-        data, 
-        str,
-        str_size, 
-        &printFormat);
-    if (retCode != DDS_RETCODE_OK) {
-        RTIOsapiHeap_freeBuffer(buffer);
-        DDS_DynamicData_delete(data);
-        return retCode;
-    }
-
-    RTIOsapiHeap_freeBuffer(buffer);
-    DDS_DynamicData_delete(data);
-    return DDS_RETCODE_OK;
-}
-#endif
-
-unsigned int 
-CameraImage_CameraImageDataPlugin_get_serialized_sample_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-
-    size = PRESTypePlugin_interpretedGetSerializedSampleMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-/* --------------------------------------------------------------------------------------
-Key Management functions:
-* -------------------------------------------------------------------------------------- */
-
-PRESTypePluginKeyKind 
-CameraImage_CameraImageDataPlugin_get_key_kind(void)
-{
-    return PRES_TYPEPLUGIN_USER_KEY;
-}
-
-RTIBool CameraImage_CameraImageDataPlugin_deserialize_key(
-    PRESTypePluginEndpointData endpoint_data,
-    CameraImage_CameraImageData **sample, 
-    RTIBool * drop_sample,
-    struct RTICdrStream *stream,
-    RTIBool deserialize_encapsulation,
-    RTIBool deserialize_key,
-    void *endpoint_plugin_qos)
-{
-    RTIBool result;
-    if (drop_sample) {} /* To avoid warnings */
-    stream->_xTypesState.unassignable = RTI_FALSE;
-    result= PRESTypePlugin_interpretedDeserializeKey(
-        endpoint_data, (sample != NULL)?*sample:NULL, stream,
-        deserialize_encapsulation, deserialize_key, endpoint_plugin_qos);
-    if (result) {
-        if (stream->_xTypesState.unassignable) {
-            result = RTI_FALSE;
-        }
-    }
-    return result;    
-
-}
-
-unsigned int
-CameraImage_CameraImageDataPlugin_get_serialized_key_max_size(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIBool include_encapsulation,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSize(
-        endpoint_data,&overflow,include_encapsulation,encapsulation_id,current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-unsigned int
-CameraImage_CameraImageDataPlugin_get_serialized_key_max_size_for_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    RTIEncapsulationId encapsulation_id,
-    unsigned int current_alignment)
-{
-    unsigned int size;
-    RTIBool overflow = RTI_FALSE;
-    size = PRESTypePlugin_interpretedGetSerializedKeyMaxSizeForKeyhash(
-        endpoint_data,
-        &overflow,
-        encapsulation_id,
-        current_alignment);
-    if (overflow) {
-        size = RTI_CDR_MAX_SERIALIZED_SIZE;
-    }
-
-    return size;
-}
-
-RTIBool 
-CameraImage_CameraImageDataPlugin_instance_to_key(
-    PRESTypePluginEndpointData endpoint_data,
-    CameraImage_CameraImageDataKeyHolder *dst, 
-    const CameraImage_CameraImageData *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */   
-
-    if (!RTICdrType_copyUnsignedLong (
-        &dst->id, &src->id)) { 
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-CameraImage_CameraImageDataPlugin_key_to_instance(
-    PRESTypePluginEndpointData endpoint_data,
-    CameraImage_CameraImageData *dst, const
-    CameraImage_CameraImageDataKeyHolder *src)
-{
-    if (endpoint_data) {} /* To avoid warnings */   
-    if (!RTICdrType_copyUnsignedLong (
-        &dst->id, &src->id)) { 
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-RTIBool 
-CameraImage_CameraImageDataPlugin_instance_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    DDS_KeyHash_t *keyhash,
-    const CameraImage_CameraImageData *instance,
-    RTIEncapsulationId encapsulationId)
-{
-    struct RTICdrStream * md5Stream = NULL;
-    struct RTICdrStreamState cdrState;
-    char * buffer = NULL;
-    RTIXCdrBoolean iCdrv2;
-
-    iCdrv2 = RTIXCdrEncapsulationId_isCdrV2(encapsulationId);
-    RTICdrStreamState_init(&cdrState);
-    md5Stream = PRESTypePluginDefaultEndpointData_getMD5Stream(endpoint_data);
-
-    if (md5Stream == NULL) {
-        return RTI_FALSE;
-    }
-
-    RTICdrStream_resetPosition(md5Stream);
-    RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-
-    if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-        endpoint_data,
-        instance,
-        md5Stream,
-        iCdrv2?
-        RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-        RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-        NULL)) 
-    {
-        int size;
-
-        RTICdrStream_pushState(md5Stream, &cdrState, -1);
-
-        size = (int)PRESTypePlugin_interpretedGetSerializedSampleSize(
-            endpoint_data,
-            RTI_FALSE,
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            0,
-            instance);
-
-        if (size <= RTICdrStream_getBufferLength(md5Stream)) {
-            RTICdrStream_popState(md5Stream, &cdrState);        
-            return RTI_FALSE;
-        }   
-
-        RTIOsapiHeap_allocateBuffer(&buffer,size,0);
-
-        if (buffer == NULL) {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            return RTI_FALSE;
-        }
-
-        RTICdrStream_set(md5Stream, buffer, size);
-        RTIOsapiMemory_zero(
-            RTICdrStream_getBuffer(md5Stream),
-            RTICdrStream_getBufferLength(md5Stream));
-        RTICdrStream_resetPosition(md5Stream);
-        RTICdrStream_setDirtyBit(md5Stream, RTI_TRUE);
-        if (!PRESTypePlugin_interpretedSerializeKeyForKeyhash(
-            endpoint_data,
-            instance,
-            md5Stream, 
-            iCdrv2?
-            RTI_CDR_ENCAPSULATION_ID_CDR2_BE:
-            RTI_CDR_ENCAPSULATION_ID_CDR_BE,
-            NULL)) 
-        {
-            RTICdrStream_popState(md5Stream, &cdrState);
-            RTIOsapiHeap_freeBuffer(buffer);
-            return RTI_FALSE;
-        }        
-    }   
-
-    if (PRESTypePluginDefaultEndpointData_getMaxSizeSerializedKey(endpoint_data, iCdrv2) > 
-    (unsigned int)(MIG_RTPS_KEY_HASH_MAX_LENGTH) ||
-    PRESTypePluginDefaultEndpointData_forceMD5KeyHash(endpoint_data)) {
-        RTICdrStream_computeMD5(md5Stream, keyhash->value);
-    } else {
-        RTIOsapiMemory_zero(keyhash->value,MIG_RTPS_KEY_HASH_MAX_LENGTH);
-        RTIOsapiMemory_copy(
-            keyhash->value, 
-            RTICdrStream_getBuffer(md5Stream), 
-            RTICdrStream_getCurrentPositionOffset(md5Stream));
-    }
-
-    keyhash->length = MIG_RTPS_KEY_HASH_MAX_LENGTH;
-
-    if (buffer != NULL) {
-        RTICdrStream_popState(md5Stream, &cdrState);
-        RTIOsapiHeap_freeBuffer(buffer);
-    }
-
-    return RTI_TRUE;
-}
-
-RTIBool 
-CameraImage_CameraImageDataPlugin_serialized_sample_to_keyhash(
-    PRESTypePluginEndpointData endpoint_data,
-    struct RTICdrStream *stream, 
-    DDS_KeyHash_t *keyhash,
-    RTIBool deserialize_encapsulation,
-    void *endpoint_plugin_qos) 
-{   
-    CameraImage_CameraImageData * sample = NULL;
-    sample = (CameraImage_CameraImageData *)
-    PRESTypePluginDefaultEndpointData_getTempSample(endpoint_data);
-    if (sample == NULL) {
-        return RTI_FALSE;
-    }
-
-    if (!PRESTypePlugin_interpretedSerializedSampleToKey(
-        endpoint_data,
-        sample,
-        stream, 
-        deserialize_encapsulation, 
-        RTI_TRUE,
-        endpoint_plugin_qos)) {
-        return RTI_FALSE;
-    }
-    if (!CameraImage_CameraImageDataPlugin_instance_to_keyhash(
-        endpoint_data, 
-        keyhash, 
-        sample,
-        RTICdrStream_getEncapsulationKind(stream))) {
-        return RTI_FALSE;
-    }
-    return RTI_TRUE;
-}
-
-struct RTIXCdrInterpreterPrograms *CameraImage_CameraImageDataPlugin_get_programs()
-{
-    return rti::xcdr::get_cdr_serialization_programs<
-    CameraImage_CameraImageData, 
-    true, true, true>();
-}
-
-/* ------------------------------------------------------------------------
-* Plug-in Installation Methods
-* ------------------------------------------------------------------------ */
-struct PRESTypePlugin *CameraImage_CameraImageDataPlugin_new(void) 
-{ 
-    struct PRESTypePlugin *plugin = NULL;
-    const struct PRESTypePluginVersion PLUGIN_VERSION = 
-    PRES_TYPE_PLUGIN_VERSION_2_0;
-
-    RTIOsapiHeap_allocateStructure(
-        &plugin, struct PRESTypePlugin);
-
-    if (plugin == NULL) {
-        return NULL;
-    }
-
-    plugin->version = PLUGIN_VERSION;
-
-    /* set up parent's function pointers */
-    plugin->onParticipantAttached =
-    (PRESTypePluginOnParticipantAttachedCallback)
-    CameraImage_CameraImageDataPlugin_on_participant_attached;
-    plugin->onParticipantDetached =
-    (PRESTypePluginOnParticipantDetachedCallback)
-    CameraImage_CameraImageDataPlugin_on_participant_detached;
-    plugin->onEndpointAttached =
-    (PRESTypePluginOnEndpointAttachedCallback)
-    CameraImage_CameraImageDataPlugin_on_endpoint_attached;
-    plugin->onEndpointDetached =
-    (PRESTypePluginOnEndpointDetachedCallback)
-    CameraImage_CameraImageDataPlugin_on_endpoint_detached;
-
-    plugin->copySampleFnc =
-    (PRESTypePluginCopySampleFunction)
-    CameraImage_CameraImageDataPlugin_copy_sample;
-    plugin->createSampleFnc =
-    (PRESTypePluginCreateSampleFunction)
-    CameraImage_CameraImageDataPlugin_create_sample;
-    plugin->destroySampleFnc =
-    (PRESTypePluginDestroySampleFunction)
-    CameraImage_CameraImageDataPlugin_destroy_sample;
-    plugin->finalizeOptionalMembersFnc =
-    (PRESTypePluginFinalizeOptionalMembersFunction)
-    CameraImage_CameraImageData_finalize_optional_members;
-
-    plugin->serializeFnc = 
-    (PRESTypePluginSerializeFunction) PRESTypePlugin_interpretedSerialize;
-    plugin->deserializeFnc =
-    (PRESTypePluginDeserializeFunction) PRESTypePlugin_interpretedDeserializeWithAlloc;
-    plugin->getSerializedSampleMaxSizeFnc =
-    (PRESTypePluginGetSerializedSampleMaxSizeFunction)
-    CameraImage_CameraImageDataPlugin_get_serialized_sample_max_size;
-    plugin->getSerializedSampleMinSizeFnc =
-    (PRESTypePluginGetSerializedSampleMinSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleMinSize;
-    plugin->getDeserializedSampleMaxSizeFnc = NULL; 
-    plugin->getSampleFnc =
-    (PRESTypePluginGetSampleFunction)
-    CameraImage_CameraImageDataPlugin_get_sample;
-    plugin->returnSampleFnc =
-    (PRESTypePluginReturnSampleFunction)
-    CameraImage_CameraImageDataPlugin_return_sample;
-    plugin->getKeyKindFnc =
-    (PRESTypePluginGetKeyKindFunction)
-    CameraImage_CameraImageDataPlugin_get_key_kind;
-
-    plugin->getSerializedKeyMaxSizeFnc =   
-    (PRESTypePluginGetSerializedKeyMaxSizeFunction)
-    CameraImage_CameraImageDataPlugin_get_serialized_key_max_size;
-    plugin->serializeKeyFnc =
-    (PRESTypePluginSerializeKeyFunction)
-    PRESTypePlugin_interpretedSerializeKey;
-    plugin->deserializeKeyFnc =
-    (PRESTypePluginDeserializeKeyFunction)
-    CameraImage_CameraImageDataPlugin_deserialize_key;
-    plugin->deserializeKeySampleFnc =
-    (PRESTypePluginDeserializeKeySampleFunction)
-    PRESTypePlugin_interpretedDeserializeKey;
-
-    plugin-> instanceToKeyHashFnc = 
-    (PRESTypePluginInstanceToKeyHashFunction)
-    CameraImage_CameraImageDataPlugin_instance_to_keyhash;
-    plugin->serializedSampleToKeyHashFnc = 
-    (PRESTypePluginSerializedSampleToKeyHashFunction)
-    CameraImage_CameraImageDataPlugin_serialized_sample_to_keyhash;
-
-    plugin->getKeyFnc =
-    (PRESTypePluginGetKeyFunction)
-    CameraImage_CameraImageDataPlugin_get_key;
-    plugin->returnKeyFnc =
-    (PRESTypePluginReturnKeyFunction)
-    CameraImage_CameraImageDataPlugin_return_key;
-
-    plugin->instanceToKeyFnc =
-    (PRESTypePluginInstanceToKeyFunction)
-    CameraImage_CameraImageDataPlugin_instance_to_key;
-    plugin->keyToInstanceFnc =
-    (PRESTypePluginKeyToInstanceFunction)
-    CameraImage_CameraImageDataPlugin_key_to_instance;
-    plugin->serializedKeyToKeyHashFnc = NULL; /* Not supported yet */
-    #ifdef NDDS_STANDALONE_TYPE
-    plugin->typeCode = NULL; 
-    #else
-    plugin->typeCode =  (struct RTICdrTypeCode *)CameraImage_CameraImageData_get_typecode();
-    #endif
-    plugin->languageKind = PRES_TYPEPLUGIN_CPP_LANG;
-
-    /* Serialized buffer */
-    plugin->getBuffer = 
-    (PRESTypePluginGetBufferFunction)
-    CameraImage_CameraImageDataPlugin_get_buffer;
-    plugin->returnBuffer = 
-    (PRESTypePluginReturnBufferFunction)
-    CameraImage_CameraImageDataPlugin_return_buffer;
-    plugin->getBufferWithParams = NULL;
-    plugin->returnBufferWithParams = NULL;  
-    plugin->getSerializedSampleSizeFnc =
-    (PRESTypePluginGetSerializedSampleSizeFunction)
-    PRESTypePlugin_interpretedGetSerializedSampleSize;
-
-    plugin->getWriterLoanedSampleFnc = NULL; 
-    plugin->returnWriterLoanedSampleFnc = NULL;
-    plugin->returnWriterLoanedSampleFromCookieFnc = NULL;
-    plugin->validateWriterLoanedSampleFnc = NULL;
-    plugin->setWriterLoanedSampleSerializedStateFnc = NULL;
-
-    plugin->endpointTypeName = CameraImage_CameraImageDataTYPENAME;
-    plugin->isMetpType = RTI_FALSE;
-    return plugin;
-}
-
-void
-CameraImage_CameraImageDataPlugin_delete(struct PRESTypePlugin *plugin)
-{
-    RTIOsapiHeap_freeStructure(plugin);
-} 
-#undef RTI_CDR_CURRENT_SUBMODULE 
@@ -1,731 +0,0 @@
-
-/*
-WARNING: THIS FILE IS AUTO-GENERATED. DO NOT MODIFY.
-
-This file was generated from automotive.idl using "rtiddsgen".
-The rtiddsgen tool is part of the RTI Connext distribution.
-For more information, type 'rtiddsgen -help' at a command shell
-or consult the RTI Connext manual.
-*/
-
-#ifndef automotiveSupport_2097331952_h
-#define automotiveSupport_2097331952_h
-
-/* Uses */
-#include "automotive.h"
-
-#ifndef ndds_cpp_h
-#include "ndds/ndds_cpp.h"
-#endif
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-
-class __declspec(dllimport) DDSTypeSupport;
-class __declspec(dllimport) DDSDataWriter;
-class __declspec(dllimport) DDSDataReader;
-
-#endif
-
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    POSIXTimestampTypeSupport, 
-    POSIXTimestamp);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(POSIXTimestampDataWriter, POSIXTimestamp);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(POSIXTimestampDataReader, POSIXTimestampSeq, POSIXTimestamp);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Alerts_DriverAlertsTypeSupport, 
-    Alerts_DriverAlerts);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Alerts_DriverAlertsDataWriter, Alerts_DriverAlerts);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Alerts_DriverAlertsDataReader, Alerts_DriverAlertsSeq, Alerts_DriverAlerts);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Lane_LaneObjectTypeSupport, 
-    Lane_LaneObject);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Lane_LaneObjectDataWriter, Lane_LaneObject);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Lane_LaneObjectDataReader, Lane_LaneObjectSeq, Lane_LaneObject);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Lane_LaneSensorTypeSupport, 
-    Lane_LaneSensor);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Lane_LaneSensorDataWriter, Lane_LaneSensor);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Lane_LaneSensorDataReader, Lane_LaneSensorSeq, Lane_LaneSensor);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Lidar_PointTypeSupport, 
-    Lidar_Point);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Lidar_PointDataWriter, Lidar_Point);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Lidar_PointDataReader, Lidar_PointSeq, Lidar_Point);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Lidar_PCloudTypeSupport, 
-    Lidar_PCloud);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Lidar_PCloudDataWriter, Lidar_PCloud);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Lidar_PCloudDataReader, Lidar_PCloudSeq, Lidar_PCloud);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Lidar_LidarSensorTypeSupport, 
-    Lidar_LidarSensor);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Lidar_LidarSensorDataWriter, Lidar_LidarSensor);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Lidar_LidarSensorDataReader, Lidar_LidarSensorSeq, Lidar_LidarSensor);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Platform_PlatformControlTypeSupport, 
-    Platform_PlatformControl);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Platform_PlatformControlDataWriter, Platform_PlatformControl);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Platform_PlatformControlDataReader, Platform_PlatformControlSeq, Platform_PlatformControl);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Platform_PlatformStatusTypeSupport, 
-    Platform_PlatformStatus);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Platform_PlatformStatusDataWriter, Platform_PlatformStatus);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Platform_PlatformStatusDataReader, Platform_PlatformStatusSeq, Platform_PlatformStatus);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Sensor_SensorObjectTypeSupport, 
-    Sensor_SensorObject);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Sensor_SensorObjectDataWriter, Sensor_SensorObject);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Sensor_SensorObjectDataReader, Sensor_SensorObjectSeq, Sensor_SensorObject);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Sensor_SensorObjectListTypeSupport, 
-    Sensor_SensorObjectList);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Sensor_SensorObjectListDataWriter, Sensor_SensorObjectList);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Sensor_SensorObjectListDataReader, Sensor_SensorObjectListSeq, Sensor_SensorObjectList);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Vision_VisionObjectTypeSupport, 
-    Vision_VisionObject);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Vision_VisionObjectDataWriter, Vision_VisionObject);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Vision_VisionObjectDataReader, Vision_VisionObjectSeq, Vision_VisionObject);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    Vision_VisionSensorTypeSupport, 
-    Vision_VisionSensor);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(Vision_VisionSensorDataWriter, Vision_VisionSensor);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(Vision_VisionSensorDataReader, Vision_VisionSensorSeq, Vision_VisionSensor);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    builtin_interfaces_msg_dds__Time_TypeSupport, 
-    builtin_interfaces_msg_dds__Time_);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(builtin_interfaces_msg_dds__Time_DataWriter, builtin_interfaces_msg_dds__Time_);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(builtin_interfaces_msg_dds__Time_DataReader, builtin_interfaces_msg_dds__Time_Seq, builtin_interfaces_msg_dds__Time_);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    std_msgs_msg_dds__Header_TypeSupport, 
-    std_msgs_msg_dds__Header_);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(std_msgs_msg_dds__Header_DataWriter, std_msgs_msg_dds__Header_);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(std_msgs_msg_dds__Header_DataReader, std_msgs_msg_dds__Header_Seq, std_msgs_msg_dds__Header_);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    sensor_msgs_msg_dds__PointField_TypeSupport, 
-    sensor_msgs_msg_dds__PointField_);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(sensor_msgs_msg_dds__PointField_DataWriter, sensor_msgs_msg_dds__PointField_);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(sensor_msgs_msg_dds__PointField_DataReader, sensor_msgs_msg_dds__PointField_Seq, sensor_msgs_msg_dds__PointField_);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    sensor_msgs_msg_dds__PointCloud2_TypeSupport, 
-    sensor_msgs_msg_dds__PointCloud2_);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(sensor_msgs_msg_dds__PointCloud2_DataWriter, sensor_msgs_msg_dds__PointCloud2_);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(sensor_msgs_msg_dds__PointCloud2_DataReader, sensor_msgs_msg_dds__PointCloud2_Seq, sensor_msgs_msg_dds__PointCloud2_);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    ShapeTypeTypeSupport, 
-    ShapeType);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(ShapeTypeDataWriter, ShapeType);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(ShapeTypeDataReader, ShapeTypeSeq, ShapeType);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    ShapeTypeExtendedTypeSupport, 
-    ShapeTypeExtended);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(ShapeTypeExtendedDataWriter, ShapeTypeExtended);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(ShapeTypeExtendedDataReader, ShapeTypeExtendedSeq, ShapeTypeExtended);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-/* ========================================================================= */
-/**
-Uses:     T
-
-Defines:  TTypeSupport, TDataWriter, TDataReader
-
-Organized using the well-documented "Generics Pattern" for
-implementing generics in C and C++.
-*/
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, start exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport __declspec(dllexport)
-
-#endif
-
-DDS_TYPESUPPORT_CPP(
-    CameraImage_CameraImageDataTypeSupport, 
-    CameraImage_CameraImageData);
-
-#define ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-DDS_DATAWRITER_WITH_DATA_CONSTRUCTOR_METHODS_CPP(CameraImage_CameraImageDataDataWriter, CameraImage_CameraImageData);
-#undef ENABLE_TDATAWRITER_DATA_CONSTRUCTOR_METHODS
-#define ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-DDS_DATAREADER_W_DATA_CONSISTENCY_CHECK(CameraImage_CameraImageDataDataReader, CameraImage_CameraImageDataSeq, CameraImage_CameraImageData);
-#undef ENABLE_TDATAREADER_DATA_CONSISTENCY_CHECK_METHOD
-
-#if (defined(RTI_WIN32) || defined (RTI_WINCE) || defined(RTI_INTIME)) && defined(NDDS_USER_DLL_EXPORT)
-/* If the code is building on Windows, stop exporting symbols.
-*/
-#undef NDDSUSERDllExport
-#define NDDSUSERDllExport
-#endif
-
-#endif  /* automotiveSupport_2097331952_h */
-
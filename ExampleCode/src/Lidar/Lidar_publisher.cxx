@@ -14,20 +14,34 @@
  **/
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <cstdlib>
 #ifdef WIN32
 #include <ctime>
 #else
 #include <sys/time.h>           // timestamps
 #endif
+#include <algorithm>
+#include <cfloat>
 #include <cmath>
+#include <chrono>
 #include "Utils.h"
+#include "pointCodec.h"
+#include "pointDelta.h"
+#include "pointSlice.h"
+#include "lidarKernels.h"
+#include "lidarNoise.h"
+#include "lidarRender.h"
+#include "lidarPipeline.h"
+#include "lidarShapes.h"
+#include "lidarFormat.h"
 #include "automotive.h"
 #include "automotiveSupport.h"
 #include "ndds/ndds_cpp.h"
 
-#define PCLOUD_BYTES_PER_POINT  (16)    // 4 float32's (for x,y,z,rgb)
 #define PI                      ((float)3.14159265359)
+#define LIDAR_NOISE_SCALE       ((float)4096 / 2000000)    // max angular noise (radians)
+#define LIDAR_TILE_COLUMNS      (16)    // scan columns per render tile
 
 typedef struct {
     float x;
@@ -46,30 +60,61 @@ typedef struct {
     srParms polar;
 }scanRange;
 
+typedef struct {
+    float       radCtr;     // distance from observer to shape center
+    float       azCtr;      // azimuth of shape center
+    float       polCtr;     // polar angle of shape center
+    float       shapeZ;     // radius (and height) of the shape
+    float       nearDist;   // distance to the nearest point of the shape
+    float       span2;      // (angular radius of the shape as seen)^2
+    uint32_t    color;
+    int         colStart;   // first scan column of the shape's bounding box
+    int         colCount;   // columns in the box (may wrap past the last one)
+    int         rowStart;   // scan rows in the box: rowStart..rowStop-1
+    int         rowStop;
+}shapeHit;
+
 typedef struct {
     point       obs;        // observer position
     scanRange   scan;       // range and resolution of scan
     int         ptType;     // type of point: 0(mono), 1(RGB)
     int         ptCount;    // count of points
-    float       *ptArray;   // array of points
+    float       *ptArray;   // array of points (X,Y,Z,Color float32's)
+    pointFormat format;     // layout of the published points
+    float       ptScale;    // meters per count, for int16 and range layouts
+    uint8_t     *ptOut;     // packed points (NULL: ptArray is published as is)
+    float       *ptNoise;   // per-point angular noise (ptCount)
+    float       *ptDepth;   // distance to the nearest shape hit so far (ptCount)
+    const scanGeometry *geo;    // precomputed angles of the scan grid
+    int         tileCount;  // render tiles of LIDAR_TILE_COLUMNS columns
+    std::vector<NoiseStream *> tileNoise;   // noise generator per tile (NULL: no noise)
+    std::vector<shapeHit> hits; // shapes in the scan range, for the current frame
+    RenderPool  *pool;      // render threads
+    float       *ptPrev;    // Radius,Color of each point in the last frame (NULL: not tracked)
+    uint8_t     *colChanged;    // per column: differs from the last frame
+    bool        obsMoved;   // observer moved since the last frame (all points changed)
+    int         tileBase;   // first tile of the slice being rendered
+    int         sliceTiles; // tiles per slice (0: the frame is not sliced)
+    void        (*sliceDone)(int colStart, int colCount, void *arg);    // called as each slice is done
+    void        *sliceArg;
 }ptCloud;
 
 typedef struct {
-    uint32_t    color;
-    int32_t     x;
-    int32_t     y;
-    int32_t     shapesize;
-} shapeType;
-
-// array of [9] circle shapes (1 per color, plus error)
-shapeType shapeList[9] = { 0 };
-// enum for indexing the above
-enum sColor {
-    SC_BLUE = 0, SC_GREEN, SC_RED, SC_YELLOW, SC_CYAN, SC_MAGENTA, SC_PURPLE, SC_ORANGE, SC_ERROR, SC_MAX
-};
+    sensor_msgs_msg_dds__PointCloud2_DataWriter *writer;
+    sensor_msgs_msg_dds__PointCloud2_ *sample;  // slice sample (reused)
+    const uint8_t   *raw;       // the frame being rendered (packed)
+    uint32_t        sweep;
+    int             slice;      // next slice of the sweep
+    int             sliceCount;
+    PointCodec      *codec;     // NULL: not compressed
+    const pointCodecLayout *layout;
+}sliceWriter;
+
+// circle shapes (1 per color), updated by the listener
+ShapeTable shapeTable;
 
 // -- prototypes -----------------------------------------------
-void  shapesToPointCloud(shapeType *shapes, ptCloud *ptc);
+void  shapesToPointCloud(const std::vector<shapeType> &shapes, ptCloud *ptc);
 
 class ShapeTypeExtendedListener : public DDSDataReaderListener {
 public:
@@ -126,64 +171,224 @@ void ShapeTypeExtendedListener::on_data_available(DDSDataReader* reader)
         return;
     }
 
+    /* update the working copy of the shape table, then publish it
+       to the render thread as one new version */
     for (i = 0; i < data_seq.length(); ++i) {
         if (info_seq[i].valid_data) {
-        /* Shapes data is received here.
-           Scaling will be performed during render, but set the color here*/
-            if(strcmp(data_seq[i].color, "BLUE") == 0) {
-                shapeList[SC_BLUE].x = data_seq[i].x;
-                shapeList[SC_BLUE].y = data_seq[i].y;
-                shapeList[SC_BLUE].shapesize = data_seq[i].shapesize;
-                shapeList[SC_BLUE].color = 0xff;
-            } else if(strcmp(data_seq[i].color, "GREEN") == 0) {
-                shapeList[SC_GREEN].x = data_seq[i].x;
-                shapeList[SC_GREEN].y = data_seq[i].y;
-                shapeList[SC_GREEN].shapesize = data_seq[i].shapesize;
-                shapeList[SC_GREEN].color = 0xff00;
-            } else if(strcmp(data_seq[i].color, "RED") == 0) {
-                shapeList[SC_RED].x = data_seq[i].x;
-                shapeList[SC_RED].y = data_seq[i].y;
-                shapeList[SC_RED].shapesize = data_seq[i].shapesize;
-                shapeList[SC_RED].color = 0xff0000;
-            } else if(strcmp(data_seq[i].color, "PURPLE") == 0) {
-                shapeList[SC_PURPLE].x = data_seq[i].x;
-                shapeList[SC_PURPLE].y = data_seq[i].y;
-                shapeList[SC_PURPLE].shapesize = data_seq[i].shapesize;
-                shapeList[SC_PURPLE].color = 0x800080;
-            } else if(strcmp(data_seq[i].color, "YELLOW") == 0) {
-                shapeList[SC_YELLOW].x = data_seq[i].x;
-                shapeList[SC_YELLOW].y = data_seq[i].y;
-                shapeList[SC_YELLOW].shapesize = data_seq[i].shapesize;
-                shapeList[SC_YELLOW].color = 0xffff00;
-            } else if(strcmp(data_seq[i].color, "CYAN") == 0) {
-                shapeList[SC_CYAN].x = data_seq[i].x;
-                shapeList[SC_CYAN].y = data_seq[i].y;
-                shapeList[SC_CYAN].shapesize = data_seq[i].shapesize;
-                shapeList[SC_CYAN].color = 0x00ffff;
-            } else if(strcmp(data_seq[i].color, "MAGENTA") == 0) {
-                shapeList[SC_MAGENTA].x = data_seq[i].x;
-                shapeList[SC_MAGENTA].y = data_seq[i].y;
-                shapeList[SC_MAGENTA].shapesize = data_seq[i].shapesize;
-                shapeList[SC_MAGENTA].color = 0xff00ff;
-            } else if(strcmp(data_seq[i].color, "ORANGE") == 0) {
-                shapeList[SC_ORANGE].x = data_seq[i].x;
-                shapeList[SC_ORANGE].y = data_seq[i].y;
-                shapeList[SC_ORANGE].shapesize = data_seq[i].shapesize;
-                shapeList[SC_ORANGE].color = 0xff5733;
-            } else {        // use WHITE for error
-                shapeList[SC_ERROR].x = data_seq[i].x;
-                shapeList[SC_ERROR].y = data_seq[i].y;
-                shapeList[SC_ERROR].shapesize = data_seq[i].shapesize;
-                shapeList[SC_ERROR].color =  0xffffff;
+            /* Shapes data is received here; the slot for each color
+               (and its RGB) comes from the shape table.
+               Scaling will be performed during render. */
+            int slot = shapeTable.slot(data_seq[i].color);
+            if (slot < 0) {
+                continue;           // table full: ignore new colors
             }
+            shapeType *shape = &shapeTable.edit()[slot];
+            shape->x = data_seq[i].x;
+            shape->y = data_seq[i].y;
+            shape->shapesize = data_seq[i].shapesize;
         }
     }
 
+    shapeTable.publish();
+
     retcode = ShapeTypeExtended_reader->return_loan(data_seq, info_seq);
     if (retcode != DDS_RETCODE_OK) {
         fprintf(stderr, "return loan error %d\n", retcode);
     }
 }
+/** ---------------------------------------------------
+ * initPointCloudSample()
+ * set up a PointCloud2 sample for the scan in 'ptc'
+ **/
+static void initPointCloudSample(sensor_msgs_msg_dds__PointCloud2_ *instance, ptCloud *ptc)
+{
+    const pointLayout *layout = pointFormatLayout(ptc->format);
+
+    /* initialize the LiDAR data elements here */
+    instance->is_bigendian_ = false;
+    instance->is_dense_ = true;          // true=no invalid datapoints
+    instance->point_step_ = layout->bytes;
+    instance->fields_.length(layout->fieldCount);
+    for (int i = 0; i < layout->fieldCount; i++) {
+        DDS_String_replace(&instance->fields_[i].name_, layout->fields[i].name);
+        instance->fields_[i].offset_ = layout->fields[i].offset;
+        instance->fields_[i].datatype_ = layout->fields[i].datatype;
+        instance->fields_[i].count_ = 1;
+    }
+    /* range images are in the sensor frame; points are in the map */
+    DDS_String_replace(&instance->header_.frame_id_, (ptc->format == PCLOUD_RANGE_U16) ? "lidar" : "map");
+
+    /* one row per column (azimuth) of the scan, polarSteps points each */
+    instance->height_ = ptc->scan.azim.steps;
+    instance->width_ = ptc->scan.polar.steps;
+    instance->row_step_ = (layout->bytes * ptc->scan.polar.steps);
+    instance->data_.length(ptc->ptCount * layout->bytes);
+}
+
+/** ---------------------------------------------------
+ * initGeometrySample()
+ * set up the scan geometry sample sent with range images and int16
+ * points: a single 'point' holding the azimuth of each row of the scan,
+ * the polar angle of each column, and the scale of the ranges or of the
+ * int16 x,y,z (float32's, meters per count).
+ * A cell at azimuth A, polar angle P and range r is at
+ * x = r*sin(P)*cos(A), y = -r*sin(P)*sin(A), z = r*cos(P) in the
+ * sensor frame.
+ **/
+static void initGeometrySample(sensor_msgs_msg_dds__PointCloud2_ *instance, ptCloud *ptc)
+{
+    const scanGeometry *geo = ptc->geo;
+    static const char *names[3] = { "azimuth", "polar", "scale" };
+    int counts[3] = { geo->azimSteps, geo->polarSteps, 1 };
+    int offset = 0;
+
+    instance->is_bigendian_ = false;
+    instance->is_dense_ = true;
+    instance->fields_.length(3);
+    for (int i = 0; i < 3; i++) {
+        DDS_String_replace(&instance->fields_[i].name_, names[i]);
+        instance->fields_[i].offset_ = offset;
+        instance->fields_[i].datatype_ = PCLOUD_DATATYPE_FLOAT32;
+        instance->fields_[i].count_ = counts[i];
+        offset += counts[i] * sizeof(float);
+    }
+    DDS_String_replace(&instance->header_.frame_id_, "lidar");
+    TimestampUtil::getTimestamp(&(instance->header_.stamp_.sec_),
+                  (((DDS_Long *)&(instance->header_.stamp_.nanosec_))));
+
+    instance->height_ = 1;
+    instance->width_ = 1;
+    instance->point_step_ = offset;
+    instance->row_step_ = offset;
+    instance->data_.length(offset);
+    float *fbuf = (float *)&instance->data_[0];
+    memcpy(fbuf, &geo->azim[0], geo->azimSteps * sizeof(float));
+    memcpy(&fbuf[geo->azimSteps], &geo->polar[0], geo->polarSteps * sizeof(float));
+    fbuf[geo->azimSteps + geo->polarSteps] = ptc->ptScale;
+}
+
+/** ---------------------------------------------------
+ * compressPointCloud()
+ * code the 'rawBytes' of points in 'raw' into the data of 'instance',
+ * or copy them as is when they don't compress, and report the ratio
+ * and speed of the codec
+ **/
+static void compressPointCloud(sensor_msgs_msg_dds__PointCloud2_ *instance, const uint8_t *raw,
+    int rawBytes, PointCodec *codec, const pointCodecLayout *layout)
+{
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    instance->data_.length(instance->data_.maximum());
+    int size = codec->encode(raw, rawBytes, layout, (uint8_t *)&instance->data_[0],
+        instance->data_.maximum());
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    if (size == 0) {
+        memcpy(&instance->data_[0], raw, rawBytes);
+        size = rawBytes;
+    }
+    instance->data_.length(size);
+    printf("LiDAR codec: %d -> %d bytes (%.2f:1), %.1f MB/s\n", rawBytes, size,
+        (double)rawBytes / size, (secs > 0) ? ((rawBytes / secs) / 1000000) : 0.0);
+}
+
+/** ---------------------------------------------------
+ * deltaPointCloud()
+ * put the columns of 'raw' that changed since the last frame (whose
+ * stamp is baseSec.baseNanosec) in the data of 'instance'.  Returns
+ * false when they don't fit, and a keyframe has to be sent instead.
+ **/
+static bool deltaPointCloud(sensor_msgs_msg_dds__PointCloud2_ *instance, const uint8_t *raw,
+    const ptCloud *ptc, int32_t baseSec, uint32_t baseNanosec,
+    PointCodec *codec, const pointCodecLayout *layout)
+{
+    int rowBytes = (int)instance->row_step_;
+    int rows = (int)instance->height_;
+    instance->data_.length(instance->data_.maximum());
+    int size = pointDeltaEncode(raw, rowBytes, rows, ptc->colChanged, baseSec, baseNanosec,
+        codec, layout, (uint8_t *)&instance->data_[0], instance->data_.maximum());
+    if (size == 0) {
+        return false;
+    }
+    instance->data_.length(size);
+    int changed = 0;
+    for (int r = 0; r < rows; r++) {
+        changed += ptc->colChanged[r];
+    }
+    printf("LiDAR delta: %d of %d columns, %d bytes\n", changed, rows, size);
+    return true;
+}
+
+/** ---------------------------------------------------
+ * writeSlice()
+ * publish columns colStart..colStart+colCount-1 of the frame, as soon
+ * as they are rendered (ptCloud.sliceDone)
+ **/
+static void writeSlice(int colStart, int colCount, void *arg)
+{
+    sliceWriter *sw = (sliceWriter *)arg;
+    sensor_msgs_msg_dds__PointCloud2_ *instance = sw->sample;
+    instance->data_.length(instance->data_.maximum());
+    int size = pointSliceEncode(sw->raw, (int)instance->row_step_, sw->sweep, sw->slice, sw->sliceCount,
+        colStart, colCount, sw->codec, sw->layout, (uint8_t *)&instance->data_[0],
+        instance->data_.maximum());
+    sw->slice++;
+    if (size == 0) {
+        /* not sent: the reader counts it as a lost slice */
+        printf("slice of columns %d..%d does not fit in a sample\n", colStart, colStart + colCount - 1);
+        return;
+    }
+    instance->data_.length(size);
+
+    /* Set the timestamp (time the slice was done) and send it */
+    TimestampUtil::getTimestamp(&(instance->header_.stamp_.sec_),
+                  (((DDS_Long *)&(instance->header_.stamp_.nanosec_))));
+    DDS_ReturnCode_t retcode = sw->writer->write(*instance, DDS_HANDLE_NIL);
+    if (retcode != DDS_RETCODE_OK) {
+        printf("slice write error %d\n", retcode);
+    }
+}
+
+/** ---------------------------------------------------
+ * initZeroCopySample()
+ * lay out a zero copy sample (loaned from shared memory by 'builder')
+ * like initPointCloudSample(), but for the stamp, which is added when
+ * the scan is done.  Returns where the points go in the sample, or NULL
+ * on error.
+ **/
+static uint8_t *initZeroCopySample(LidarZeroCopy_PointCloud2Builder &builder, ptCloud *ptc)
+{
+    const pointLayout *layout = pointFormatLayout(ptc->format);
+
+    builder.add_is_bigendian_(false);
+    builder.add_is_dense_(true);
+    builder.add_point_step_(layout->bytes);
+    auto fields = builder.build_fields_();
+    for (int i = 0; i < layout->fieldCount; i++) {
+        auto field = fields.build_next();
+        auto name = field.build_name_();
+        name.set_string(layout->fields[i].name);
+        name.finish();
+        field.add_offset_(layout->fields[i].offset);
+        field.add_datatype_(layout->fields[i].datatype);
+        field.add_count_(1);
+        field.finish();
+    }
+    fields.finish();
+    auto frameId = builder.build_frame_id_();
+    frameId.set_string((ptc->format == PCLOUD_RANGE_U16) ? "lidar" : "map");
+    frameId.finish();
+
+    builder.add_height_(ptc->scan.azim.steps);
+    builder.add_width_(ptc->scan.polar.steps);
+    builder.add_row_step_(layout->bytes * ptc->scan.polar.steps);
+    auto data = builder.build_data_();
+    data.add_n(ptc->ptCount * layout->bytes);
+    uint8_t *points = (uint8_t *)rti::flat::plain_cast(data.finish());
+    if (builder.check_failure()) {
+        return NULL;
+    }
+    return points;
+}
+
 /* Delete all entities */
 static int publisher_shutdown(
     DDSDomainParticipant *participant)
@@ -230,18 +435,21 @@ static int publisher_shutdown(
     DDSSubscriber *subscriber = NULL;
     DDSTopic *pointCloudTopic = NULL;
     DDSTopic *shapeTopic = NULL;
+    DDSTopic *geometryTopic = NULL;
     DDSDataWriter *writer = NULL;
     sensor_msgs_msg_dds__PointCloud2_DataWriter * Lidar_LidarSensor_writer = NULL;
-    sensor_msgs_msg_dds__PointCloud2_ *instance = NULL;
+    LidarZeroCopy_PointCloud2DataWriter *zeroCopy_writer = NULL;
+    std::vector<sensor_msgs_msg_dds__PointCloud2_ *> samples;   // one per frame slot
     ShapeTypeExtendedListener *reader_listener = NULL;
     DDSDataReader *reader = NULL;
     DDS_ReturnCode_t retcode;
     DDS_InstanceHandle_t instance_handle = DDS_HANDLE_NIL;
     const char *pointcloud_type_name = NULL;
+    const char *zerocopy_type_name = NULL;
     const char *shape_type_name = NULL;
     int domainId = 0;
-    DDS_Duration_t send_period = {4,0};
     ptCloud topLidar;       // to hold LiDAR data
+    scanGeometry scanGeo;   // sin/cos tables for the scan grid
     topLidar.obs.x = 0;
     topLidar.obs.y = 0;
     topLidar.obs.z = 1;
@@ -251,8 +459,6 @@ static int publisher_shutdown(
     PropertyUtil* prop = new PropertyUtil("lidar.properties");
 
     long period = prop->getLongProperty("config.pubInterval");
-    send_period.sec = period / 1000;
-    send_period.nanosec = (period % 1000) * 1000 * 1000;
 
     domainId = prop->getLongProperty("config.domainId");
     std::string topicName = prop->getStringProperty("topic.Sensor");
@@ -285,8 +491,79 @@ static int publisher_shutdown(
     scanTmp = prop->getLongProperty("config.polarSteps");
     topLidar.scan.polar.steps = scanTmp;
 
-    /* Initialize the random number generator */
-    srand((unsigned int)time(NULL));
+    /* The scan grid never changes, so its angles (and their sin/cos)
+       are computed once here rather than for every point of every frame */
+    buildScanGeometry(&scanGeo,
+        topLidar.scan.azim.start, topLidar.scan.azim.range, topLidar.scan.azim.steps,
+        topLidar.scan.polar.start, topLidar.scan.polar.range, topLidar.scan.polar.steps);
+    topLidar.geo = &scanGeo;
+
+    /* Point layout on the wire (xyzrgb, xyzi, xyzi16f, xyzi16 or range) */
+    topLidar.format = pointFormatFromName(prop->getStringProperty("config.pointFormat"));
+    topLidar.ptScale = prop->getFloatProperty("config.pointScale");
+    if (topLidar.ptScale <= 0) {
+        topLidar.ptScale = (float)0.001;
+    }
+    /* Lossless compression of the points (0: off, 1: on) */
+    bool compress = (prop->getLongProperty("config.compress") != 0);
+    /* Keyframe + delta publishing: a full frame every 'keyframeInterval'
+       frames, and only the changed columns in between (0: full frames) */
+    long keyframeInterval = prop->getLongProperty("config.keyframeInterval");
+    /* Sliced publishing: each slice of 'sliceColumns' columns (rounded up
+       to whole render tiles) is sent as soon as it is rendered (0: whole
+       frames).  Slices are always complete, so there are no deltas. */
+    long sliceColumns = prop->getLongProperty("config.sliceColumns");
+    topLidar.tileBase = 0;
+    topLidar.sliceTiles = 0;
+    if (sliceColumns > 0) {
+        topLidar.sliceTiles = (int)((sliceColumns + LIDAR_TILE_COLUMNS - 1) / LIDAR_TILE_COLUMNS);
+        keyframeInterval = 0;
+    }
+    /* Zero copy: the points are rendered right into a FlatData sample
+       loaned from shared memory, and sent by reference on a topic of
+       their own (0: off).  The sample is the whole frame as rendered, so
+       there is no compression, keyframe + delta or slicing. */
+    bool zeroCopy = (prop->getLongProperty("config.zeroCopy") != 0);
+    std::string zeroCopyTopicName = prop->getStringProperty("topic.ZeroCopy");
+    std::string zeroCopyProfile = prop->getStringProperty("qos.ZeroCopyProfile");
+    if (zeroCopy) {
+        if ((zeroCopyTopicName == "") || (zeroCopyProfile == "")) {
+            printf("No zero copy topic name or QoS Profile specified\n");
+            return -1;
+        }
+        compress = false;
+        keyframeInterval = 0;
+        topLidar.sliceTiles = 0;
+        topicName = zeroCopyTopicName;
+        qosProfile = zeroCopyProfile;
+    }
+    std::string geometryTopicName = prop->getStringProperty("topic.Geometry");
+    std::string geometryProfile = prop->getStringProperty("qos.GeometryProfile");
+    /* the scale of range images and int16 points is not in PointCloud2:
+       subscribers get it from the geometry sample */
+    bool sendGeometry = ((topLidar.format == PCLOUD_RANGE_U16) || (topLidar.format == PCLOUD_XYZI_I16));
+    if (sendGeometry && ((geometryTopicName == "") || (geometryProfile == ""))) {
+        printf("No geometry topic name or QoS Profile specified\n");
+        return -1;
+    }
+
+    /* Position noise: engine is none, xorshift or pcg; a seed of 0 (or none)
+       uses the time, any other value gives a repeatable point cloud */
+    noiseEngineKind noiseKind = noiseEngineFromName(prop->getStringProperty("config.noiseEngine"));
+    uint64_t noiseSeed = (uint64_t)prop->getLongProperty("config.noiseSeed");
+    if (noiseSeed == 0) {
+        noiseSeed = (uint64_t)time(NULL);
+    }
+
+    /* Render threads: the scan is split into tiles of LIDAR_TILE_COLUMNS
+       columns, rendered by 'renderThreads' threads (0: one per core).
+       Each tile has its own noise stream, so the point cloud does not
+       depend on the number of threads. */
+    topLidar.tileCount = (topLidar.scan.azim.steps + LIDAR_TILE_COLUMNS - 1) / LIDAR_TILE_COLUMNS;
+    for (int t = 0; t < topLidar.tileCount; t++) {
+        topLidar.tileNoise.push_back(createNoiseStream(noiseKind, noiseSeed, t));
+    }
+    topLidar.pool = new RenderPool(prop->getLongProperty("config.renderThreads"));
 
     /* Create the participant */
     participant = DDSTheParticipantFactory->create_participant_with_profile(
@@ -329,6 +606,17 @@ static int publisher_shutdown(
         return -1;
     }
 
+    if (zeroCopy) {
+        zerocopy_type_name = LidarZeroCopy_PointCloud2TypeSupport::get_type_name();
+        retcode = LidarZeroCopy_PointCloud2TypeSupport::register_type(
+            participant, zerocopy_type_name);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "zero copy register_type error %d\n", retcode);
+            publisher_shutdown(participant);
+            return -1;
+        }
+    }
+
     shape_type_name = ShapeTypeExtendedTypeSupport::get_type_name();
     retcode = ShapeTypeExtendedTypeSupport::register_type(
         participant, shape_type_name);
@@ -340,7 +628,8 @@ static int publisher_shutdown(
     /* Create the topic */
     pointCloudTopic = participant->create_topic_with_profile(
         topicName.c_str(),
-        pointcloud_type_name, qosLibrary.c_str(), qosProfile.c_str(), NULL /* listener */,
+        (zeroCopy ? zerocopy_type_name : pointcloud_type_name),
+        qosLibrary.c_str(), qosProfile.c_str(), NULL /* listener */,
         DDS_STATUS_MASK_NONE);
     if (pointCloudTopic == NULL) {
         printf("create_topic error\n");
@@ -368,13 +657,54 @@ static int publisher_shutdown(
         return -1;
     }
 
-    Lidar_LidarSensor_writer = sensor_msgs_msg_dds__PointCloud2_DataWriter::narrow(writer);
-    if (Lidar_LidarSensor_writer == NULL) {
+    if (zeroCopy) {
+        zeroCopy_writer = LidarZeroCopy_PointCloud2DataWriter::narrow(writer);
+    }
+    else {
+        Lidar_LidarSensor_writer = sensor_msgs_msg_dds__PointCloud2_DataWriter::narrow(writer);
+    }
+    if ((Lidar_LidarSensor_writer == NULL) && (zeroCopy_writer == NULL)) {
         printf("DataWriter narrow error\n");
         publisher_shutdown(participant);
         return -1;
     }
 
+    /* Range images and int16 points: send the scan geometry and scale
+       once, on a topic that keeps it for subscribers that join later */
+    if (sendGeometry) {
+        geometryTopic = participant->create_topic_with_profile(
+            geometryTopicName.c_str(),
+            pointcloud_type_name, qosLibrary.c_str(), geometryProfile.c_str(), NULL /* listener */,
+            DDS_STATUS_MASK_NONE);
+        if (geometryTopic == NULL) {
+            fprintf(stderr, "geometry create_topic error\n");
+            publisher_shutdown(participant);
+            return -1;
+        }
+        DDSDataWriter *geometryWriter = publisher->create_datawriter_with_profile(
+            geometryTopic, qosLibrary.c_str(), geometryProfile.c_str(), NULL /* listener */,
+            DDS_STATUS_MASK_NONE);
+        sensor_msgs_msg_dds__PointCloud2_DataWriter *geometry_writer =
+            sensor_msgs_msg_dds__PointCloud2_DataWriter::narrow(geometryWriter);
+        if (geometry_writer == NULL) {
+            fprintf(stderr, "geometry create_datawriter error\n");
+            publisher_shutdown(participant);
+            return -1;
+        }
+        sensor_msgs_msg_dds__PointCloud2_ *geometry = sensor_msgs_msg_dds__PointCloud2_TypeSupport::create_data();
+        if (geometry == NULL) {
+            fprintf(stderr, "geometry create_data error\n");
+            publisher_shutdown(participant);
+            return -1;
+        }
+        initGeometrySample(geometry, &topLidar);
+        retcode = geometry_writer->write(*geometry, instance_handle);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "geometry write error %d\n", retcode);
+        }
+        sensor_msgs_msg_dds__PointCloud2_TypeSupport::delete_data(geometry);
+    }
+
     /* Create a data reader listener */
     reader_listener = new ShapeTypeExtendedListener();
 
@@ -390,69 +720,247 @@ static int publisher_shutdown(
         return -1;
     }
 
-    /* Create data sample for writing */
-    instance = sensor_msgs_msg_dds__PointCloud2_TypeSupport::create_data();
-    if (instance == NULL) {
-        printf("Lidar_LidarSensorTypeSupport::create_data error\n");
+    /* Create the data samples: frames are rendered into one slot of the
+       ring while the previous one is being written */
+    FrameRing ring(prop->getLongProperty("config.frameSlots"));
+    int dataPointCount = (topLidar.scan.azim.steps * topLidar.scan.polar.steps);
+    topLidar.ptCount = dataPointCount;
+    for (int i = 0; i < ring.slotCount(); i++) {
+        sensor_msgs_msg_dds__PointCloud2_ *instance = sensor_msgs_msg_dds__PointCloud2_TypeSupport::create_data();
+        if (instance == NULL) {
+            printf("Lidar_LidarSensorTypeSupport::create_data error\n");
+            publisher_shutdown(participant);
+            return -1;
+        }
+        initPointCloudSample(instance, &topLidar);
+        samples.push_back(instance);
+    }
+    /* A frame has to fit in the data of one sample (368640 bytes: 23040
+       points as xyzrgb, 52662 as xyzi16, 122880 as range) */
+    int rawBytes = dataPointCount * pointFormatLayout(topLidar.format)->bytes;
+    int sampleBytes = zeroCopy ? (int)LidarZeroCopy_POINT_CLOUD_MAX_BYTES : (int)samples[0]->data_.maximum();
+    if (rawBytes > sampleBytes) {
+        printf("A scan of %d x %d points is %d bytes as %s, more than the %d of a sample\n",
+            (int)topLidar.scan.azim.steps, (int)topLidar.scan.polar.steps, rawBytes,
+            pointFormatLayout(topLidar.format)->name, sampleBytes);
         publisher_shutdown(participant);
         return -1;
     }
+    std::vector<float> noiseBuf(dataPointCount);
+    topLidar.ptNoise = &noiseBuf[0];
+    std::vector<float> depthBuf(dataPointCount);
+    topLidar.ptDepth = &depthBuf[0];
+    // points are rendered here first when they are packed for publishing
+    std::vector<float> renderBuf((topLidar.format == PCLOUD_XYZRGB_F32) ? 0 : (dataPointCount * 4));
+    // and packed here when they are compressed or sent as deltas
+    bool staged = (compress || (keyframeInterval > 0) || (topLidar.sliceTiles > 0));
+    std::vector<float> rawBuf(staged ? ((rawBytes + 3) / 4) : 0);
+    PointCodec codec;
+    pointCodecLayout codecLayout;
+    if (compress && !pointCodecLayoutFromSample(samples[0], &codecLayout)) {
+        printf("LiDAR points can't be compressed\n");
+        compress = false;
+    }
+    // the last frame, to find the columns that change (NaN: all of them, at first)
+    std::vector<float> prevBuf((keyframeInterval > 0) ? (dataPointCount * 2) : 0);
+    std::vector<uint8_t> colChanged(topLidar.scan.azim.steps, 1);
+    topLidar.ptPrev = NULL;
+    topLidar.colChanged = &colChanged[0];
+    topLidar.obsMoved = true;
+    if (keyframeInterval > 0) {
+        memset(&prevBuf[0], 0xff, prevBuf.size() * sizeof(float));
+        topLidar.ptPrev = &prevBuf[0];
+    }
+    // sliced frames are written from the render thread, in this sample
+    sliceWriter slices;
+    slices.writer = Lidar_LidarSensor_writer;
+    slices.sample = NULL;
+    slices.sweep = 0;
+    slices.sliceCount = 0;
+    slices.codec = (compress ? &codec : NULL);
+    slices.layout = &codecLayout;
+    topLidar.sliceDone = writeSlice;
+    topLidar.sliceArg = &slices;
+    if (topLidar.sliceTiles > 0) {
+        slices.sliceCount = (topLidar.tileCount + topLidar.sliceTiles - 1) / topLidar.sliceTiles;
+        slices.sample = sensor_msgs_msg_dds__PointCloud2_TypeSupport::create_data();
+        if (slices.sample == NULL) {
+            printf("Lidar_LidarSensorTypeSupport::create_data error\n");
+            publisher_shutdown(participant);
+            return -1;
+        }
+        initPointCloudSample(slices.sample, &topLidar);
+    }
+    // zero copy samples, from the time they are rendered to the time they are written
+    std::vector<LidarZeroCopy_PointCloud2 *> zeroCopySamples(ring.slotCount(), NULL);
 
 
-    /* initialize the LiDAR data elements here */
-    instance->is_bigendian_ = false;
-    instance->is_dense_ = true;          // true=no invalid datapoints
-    instance->point_step_ = PCLOUD_BYTES_PER_POINT;
-    instance->row_step_ = (PCLOUD_BYTES_PER_POINT * topLidar.scan.azim.steps);
-    instance->fields_.length(4);
-    instance->fields_[0].name_ = (char *)"x";
-    instance->fields_[0].offset_ = 0;
-    instance->fields_[0].datatype_ = 7;      // 2=UINT8, 7=float32
-    instance->fields_[0].count_ = 1;
-    instance->fields_[1].name_ = (char *)"y";
-    instance->fields_[1].offset_ = 4;
-    instance->fields_[1].datatype_ = 7;
-    instance->fields_[1].count_ = 1;
-    instance->fields_[2].name_ = (char *)"z";
-    instance->fields_[2].offset_ = 8;
-    instance->fields_[2].datatype_ = 7;
-    instance->fields_[2].count_ = 1;
-    instance->fields_[3].name_ = (char *)"rgb";
-    instance->fields_[3].offset_ = 12;
-    instance->fields_[3].datatype_ = 7;
-    instance->fields_[3].count_ = 1;
-    instance->header_.frame_id_ = (DDS_Char *) "map";
+    printf("LiDAR XYZ conversion kernel: %s\n", scanToXyzKernelName());
+    printf("LiDAR point format: %s, %d bytes/point\n",
+        pointFormatLayout(topLidar.format)->name, pointFormatLayout(topLidar.format)->bytes);
+    printf("LiDAR compression: %s\n", (compress ? "delta/shuffle/rANS" : "none"));
+    if (keyframeInterval > 0) {
+        printf("LiDAR keyframe every %ld frames, changed columns in between\n", keyframeInterval);
+    }
+    if (topLidar.sliceTiles > 0) {
+        printf("LiDAR sliced: %d slices of %d columns\n", slices.sliceCount,
+            topLidar.sliceTiles * LIDAR_TILE_COLUMNS);
+    }
+    if (zeroCopy) {
+        printf("LiDAR zero copy: FlatData samples in shared memory\n");
+    }
+    printf("LiDAR render: %d threads, %d tiles, %d frame slots\n",
+        topLidar.pool->threadCount(), topLidar.tileCount, ring.slotCount());
+    if (noiseKind != NOISE_NONE) {
+        printf("LiDAR noise: %s, seed %llu\n", (noiseKind == NOISE_PCG ? "pcg" : "xorshift"),
+            (unsigned long long)noiseSeed);
+    }
+    else {
+        printf("LiDAR noise: none\n");
+    }
 
-    int dataPointCount = (topLidar.scan.azim.steps * topLidar.scan.polar.steps);
-    instance->height_ = topLidar.scan.azim.steps;
-    instance->width_ = topLidar.scan.polar.steps;
-    instance->data_.length(dataPointCount * PCLOUD_BYTES_PER_POINT);
-    topLidar.ptCount = dataPointCount;
-    topLidar.ptArray = (float *)&instance->data_[0];    // put data into PointCloud2 instance buffer
+    /* Render thread: renders each requested frame into the next slot */
+    std::thread renderThread([&]() {
+        int slot;
+        long frame = 0;
+        int32_t lastSec = 0;        // stamp of the last frame, the base of a delta
+        uint32_t lastNanosec = 0;
+        while ((slot = ring.beginRender()) >= 0) {
+            /* get the data: float32 XYZRGB goes right into the PointCloud2
+               sample buffer, other layouts are packed into it.  When
+               compressed or sent as a delta, the points go to rawBuf and
+               are coded from there into the sample.  With zero copy, they
+               go right into a sample loaned from shared memory. */
+            uint8_t *points = staged ? (uint8_t *)&rawBuf[0] : (uint8_t *)&samples[slot]->data_[0];
+            LidarZeroCopy_PointCloud2Builder builder;
+            if (zeroCopy) {
+                builder = rti::flat::build_data<LidarZeroCopy_PointCloud2>(zeroCopy_writer);
+                points = builder.check_failure() ? NULL : initZeroCopySample(builder, &topLidar);
+                if (points == NULL) {
+                    printf("zero copy sample error\n");
+                    ring.endRender(slot);
+                    continue;
+                }
+            }
+            if (topLidar.format == PCLOUD_XYZRGB_F32) {
+                topLidar.ptArray = (float *)points;
+                topLidar.ptOut = NULL;
+            }
+            else {
+                topLidar.ptArray = &renderBuf[0];
+                topLidar.ptOut = points;
+            }
+            slices.raw = points;
+            slices.slice = 0;
+            shapesToPointCloud(shapeTable.snapshot(), &topLidar);
+            slices.sweep++;
+
+            if (zeroCopy) {
+                /* Set the timestamp (time of the scan): the sample is done */
+                DDS_Long sec, nanosec;
+                TimestampUtil::getTimestamp(&sec, &nanosec);
+                LidarZeroCopy_TimeOffset stamp = builder.add_stamp_();
+                stamp.sec_(sec);
+                stamp.nanosec_((DDS_UnsignedLong)nanosec);
+                zeroCopySamples[slot] = builder.finish_sample();
+                if (zeroCopySamples[slot] == NULL) {
+                    printf("finish_sample() error\n");
+                }
+                ring.endRender(slot);
+                continue;
+            }
 
+            /* Set the timestamp (time of the scan) */
+            TimestampUtil::getTimestamp(&(samples[slot]->header_.stamp_.sec_),
+                          (((DDS_Long *)&(samples[slot]->header_.stamp_.nanosec_))));
+
+            /* a delta when only some columns changed, else a keyframe */
+            bool sent = (topLidar.sliceTiles > 0);      // already written, slice by slice
+            if (!sent && (keyframeInterval > 0) && ((frame % keyframeInterval) != 0)) {
+                int changed = 0;
+                for (int c = 0; c < topLidar.scan.azim.steps; c++) {
+                    changed += topLidar.colChanged[c];
+                }
+                if ((changed * 2) <= topLidar.scan.azim.steps) {
+                    sent = deltaPointCloud(samples[slot], points, &topLidar, lastSec, lastNanosec,
+                        (compress ? &codec : NULL), &codecLayout);
+                }
+            }
+            if (!sent && compress) {
+                compressPointCloud(samples[slot], points, rawBytes, &codec, &codecLayout);
+            }
+            else if (!sent && staged) {
+                samples[slot]->data_.length(rawBytes);
+                memcpy(&samples[slot]->data_[0], points, rawBytes);
+            }
+            frame = sent ? (frame + 1) : 1;     // keyframes restart the count
+            lastSec = samples[slot]->header_.stamp_.sec_;
+            lastNanosec = samples[slot]->header_.stamp_.nanosec_;
+            ring.endRender(slot);
+        }
+    });
 
-    /* Main loop */
+    /* Main loop: frame N+1 is rendered while frame N is written.
+       The deadlines are absolute, so the rate stays at pubInterval
+       no matter how long rendering and writing take. */
+    DeadlineTimer timer(period);
+    ring.requestFrame();
     while(1) {
-        /* get the data */
-        shapesToPointCloud(&shapeList[0], &topLidar);
+        ring.requestFrame();
+        int slot = ring.beginPublish();
+        if (slot < 0) {
+            break;
+        }
 
-        /* Set the timestamp */
-        TimestampUtil::getTimestamp(&(instance->header_.stamp_.sec_), 
-                      (((DDS_Long *)&(instance->header_.stamp_.nanosec_))));
+        /* And send it (sliced frames were sent as they were rendered).
+           A zero copy sample goes back to the writer, that only sends a
+           reference to it to readers on this host. */
+        if (zeroCopy) {
+            if (zeroCopySamples[slot] != NULL) {
+                retcode = zeroCopy_writer->write(*zeroCopySamples[slot], instance_handle);
+                if (retcode != DDS_RETCODE_OK) {
+                    printf("write error %d\n", retcode);
+                    zeroCopy_writer->discard_loan(*zeroCopySamples[slot]);
+                }
+                zeroCopySamples[slot] = NULL;
+            }
+        }
+        else if (topLidar.sliceTiles == 0) {
+            retcode = Lidar_LidarSensor_writer->write(*samples[slot], instance_handle);
+            if (retcode != DDS_RETCODE_OK) {
+                printf("write error %d\n", retcode);
+            }
+        }
+        ring.endPublish(slot);
 
-        /* And send it */
-        retcode = Lidar_LidarSensor_writer->write(*instance, instance_handle);
-        if (retcode != DDS_RETCODE_OK) {
-            printf("write error %d\n", retcode);
+        int skipped = timer.wait();
+        if (skipped != 0) {
+            printf("LiDAR frame late, %d period(s) skipped\n", skipped);
         }
+    }
+    ring.stop();
+    renderThread.join();
 
-        NDDSUtility::sleep(send_period);
+    /* Zero copy samples rendered but not written */
+    for (size_t i = 0; i < zeroCopySamples.size(); i++) {
+        if (zeroCopySamples[i] != NULL) {
+            zeroCopy_writer->discard_loan(*zeroCopySamples[i]);
+        }
     }
 
-    /* Delete data sample */
-    retcode = sensor_msgs_msg_dds__PointCloud2_TypeSupport::delete_data(instance);
-    if (retcode != DDS_RETCODE_OK) {
-        fprintf(stderr, "sensor_msgs_msg_dds__PointCloud2_TypeSupport::delete_data error %d\n", retcode);
+    /* Delete data samples */
+    for (size_t i = 0; i < samples.size(); i++) {
+        retcode = sensor_msgs_msg_dds__PointCloud2_TypeSupport::delete_data(samples[i]);
+        if (retcode != DDS_RETCODE_OK) {
+            fprintf(stderr, "sensor_msgs_msg_dds__PointCloud2_TypeSupport::delete_data error %d\n", retcode);
+        }
+    }
+    if (slices.sample != NULL) {
+        sensor_msgs_msg_dds__PointCloud2_TypeSupport::delete_data(slices.sample);
+    }
+    delete topLidar.pool;
+    for (int t = 0; t < topLidar.tileCount; t++) {
+        delete topLidar.tileNoise[t];
     }
 
     /* Delete all entities */
@@ -460,158 +968,237 @@ static int publisher_shutdown(
 }
 
 /** --------------------------------------------------------
- * findHitDist()
- * given a sphere radius and an x,y from its center, 
- * return the depth to the center plane
+ * hitColumns()
+ * test the scan points of columns cStart..cStop-1 (within the shape's
+ * row range) against the (spherical) shape, and keep the nearest hit
+ * of each point in its radius, color, and depth.
  **/
-float findHitDist(float radius, float x, float y)
+static void hitColumns(const shapeHit *h, const scanGeometry *geo, float *fbuf, float *depth,
+    int cStart, int cStop)
 {
-    // get the squares of radius, x, and y
-    float rSquared = pow(radius, 2);
-    float xSquared = pow(x, 2);
-    float ySquared = pow(y, 2);
-    float zSquared = -1 * (xSquared + ySquared - rSquared);
-    if (zSquared > 0) {
-        zSquared = sqrt(zSquared);
-    }
-    else {
-        zSquared = 0;
+    for (int c = cStart; c < cStop; c++) {
+        // angle of this column off of the sphere center
+        float azDiff = h->azCtr - geo->azim[c];
+        if (fabs(azDiff) > 5) {
+            if (azDiff > 0)
+                azDiff -= (2 * PI);
+            else
+                azDiff += (2 * PI);
+        }
+        float az2 = azDiff * azDiff;
+        if (az2 >= h->span2) {
+            continue;
+        }
+
+        // skip the column if nearer shapes already cover all its rows
+        int base = c * geo->polarSteps;
+        bool occluded = true;
+        for (int p = h->rowStart; occluded && (p < h->rowStop); p++) {
+            occluded = (depth[base + p] <= h->nearDist);
+        }
+        if (occluded) {
+            continue;
+        }
+
+        for (int p = h->rowStart; p < h->rowStop; p++) {
+            // find this scans' angle off of the sphere center
+            float polDiff = h->polCtr - geo->polar[p];
+            float scanCtr2 = az2 + (polDiff * polDiff);
+            if (scanCtr2 >= h->span2) {
+                continue;
+            }
+            // the center-offset length of the point on the sphere,
+            // then the distance from there to the hit
+            float scanPtOffset = h->radCtr * tan(sqrt(scanCtr2));
+            float dist2 = (h->shapeZ * h->shapeZ) - (scanPtOffset * scanPtOffset);
+            if (dist2 <= 0) {
+                continue;
+            }
+            float hitRad = h->radCtr - sqrt(dist2);
+
+            // keep the nearest hit
+            int pt = base + p;
+            if (hitRad < depth[pt]) {
+                depth[pt] = hitRad;
+                fbuf[(pt * 4) + 2] = hitRad;
+                memcpy(&fbuf[(pt * 4) + 3], &h->color, sizeof(float));  // color bits
+            }
+        }
     }
-    return zSquared;
 }
 
 /** --------------------------------------------------------
- * shapesToPointCloud()
- * render shapes to pointcloud, from observers' perspective
- * This keeps the points in an APR format 
- * (will need to convert to XYZ before publishing)
+ * renderTile()
+ * render one tile (LIDAR_TILE_COLUMNS scan columns) of the frame set
+ * up by shapesToPointCloud(); called from the render threads.
  **/
-void shapesToPointCloud(shapeType *shapes, ptCloud *ptc)
+static void renderTile(int tile, void *arg)
 {
-    // init the points to azimuth,polar,INFINITY,0
-    float azim = ptc->scan.azim.start;
-    float polar = ptc->scan.polar.start;
-    float aStep = ptc->scan.azim.range / ptc->scan.azim.steps;
-    float pStep = ptc->scan.polar.range / ptc->scan.polar.steps;
+    ptCloud *ptc = (ptCloud *)arg;
+    const scanGeometry *geo = ptc->geo;
     float *fbuf = &ptc->ptArray[0];
-    int i = 0;
+    tile += ptc->tileBase;
+    int colStart = tile * LIDAR_TILE_COLUMNS;
+    int colStop = colStart + LIDAR_TILE_COLUMNS;
+    if (colStop > geo->azimSteps) {
+        colStop = geo->azimSteps;
+    }
+    int ptStart = colStart * geo->polarSteps;
+    int ptStop = colStop * geo->polarSteps;
+
+    // init the points to -,-,8.5,grey (with nothing hit yet)
     uint32_t greyPoint = 0x393939;
-    float posNoise = 0;
-    for (int a = 0; a < ptc->scan.azim.steps; a++)
+    float greyColor;
+    memcpy(&greyColor, &greyPoint, sizeof(greyColor));  // the color bits, as a float
+    for (int i = ptStart; i < ptStop; i++)
     {
-        for (int p = 0; p < ptc->scan.polar.steps; p++)
-        {
-            // order in buffer is X,Y,Z,Color <--> Azim,Polar,Radius,Color
-            fbuf[i++] = azim + (a * aStep) + posNoise;      // azimuth
-            fbuf[i++] = polar + (p * pStep) + posNoise;     // polar
-            fbuf[i++] = (float)8.5;                         // radius
-            fbuf[i++] = *reinterpret_cast<float*>(&greyPoint); // color
-            // add a little noise to the position
-            posNoise = (((float)(rand() % 4096)) / 2000000);
+        // order in buffer is X,Y,Z,Color <--> -,-,Radius,Color
+        fbuf[(i * 4) + 2] = (float)8.5;                         // radius
+        fbuf[(i * 4) + 3] = greyColor;                          // color
+        ptc->ptDepth[i] = FLT_MAX;
+    }
+    // add a little noise to the position (range images keep the grid angles)
+    const float *noise = NULL;
+    if ((ptc->tileNoise[tile] != NULL) && (ptc->format != PCLOUD_RANGE_U16)) {
+        ptc->tileNoise[tile]->fill(&ptc->ptNoise[ptStart], ptStop - ptStart, LIDAR_NOISE_SCALE);
+        noise = ptc->ptNoise;
+    }
+
+    // only the shapes whose bounding box overlaps this tile (nearest first)
+    for (size_t i = 0; i < ptc->hits.size(); i++) {
+        const shapeHit *h = &ptc->hits[i];
+        int hStop = h->colStart + h->colCount;
+        hitColumns(h, geo, fbuf, ptc->ptDepth, std::max(h->colStart, colStart), std::min(hStop, colStop));
+        if (hStop > geo->azimSteps) {
+            // the box wraps around to the first columns
+            hitColumns(h, geo, fbuf, ptc->ptDepth, colStart, std::min(hStop - geo->azimSteps, colStop));
         }
     }
 
-    // for each shape in shapelist that has a size
-    for (int i = 0; i < SC_MAX; i++)
-    {
-        if (shapeList[i].shapesize)
-        {
-            // except for YELLOW -- it gets to be the observer.
-            if (shapeList[i].color == 0xffff00)
-            {
-                ptc->obs.x = ((float)(shapeList[i].x - 120)) / 24;
-                ptc->obs.y = ((float)(shapeList[i].y - 135)) / 27;
-                ptc->obs.z = ((float)shapeList[i].shapesize) / 30;
-            }
-            else {
-                // find all scan points that hit the shape
-                // first: get the xyz and azimuth/polar/radius of the shape center
-                float shapeX = (((float)(shapeList[i].x - 120)) / 24);
-                float shapeY = (((float)(shapeList[i].y - 135)) / 27);
-                float shapeZ = (((float)shapeList[i].shapesize) / 60);
-                float radCtr = sqrt(pow(shapeX - ptc->obs.x, 2)
-                    + pow(shapeY - ptc->obs.y, 2)
-                    + pow(shapeZ - ptc->obs.z, 2));
-                float azCtr = atan2((shapeY - ptc->obs.y), (shapeX - ptc->obs.x)) + PI;
-                float polCtr = acos((shapeZ - ptc->obs.z) / radCtr);
-
-                // is this shape within the (azimuth) scan range?
-                if (((azCtr) > ptc->scan.azim.start) && (azCtr <= (ptc->scan.azim.start + ptc->scan.azim.range)))
-                {
-                    // find the column(azimuth) of this center position
-                    int m = ((int)(((azCtr - ptc->scan.azim.start) * ptc->scan.azim.steps * ptc->scan.polar.steps * 4) 
-                        / ptc->scan.azim.range) & ~0x3);
-
-                    // cover the azimuth span of the shape size at its current distance from observer
-                    float azSpan = atan2(shapeZ, radCtr);
-                    float azStart = azCtr - azSpan;
-                    float azStop = azCtr + azSpan;
-                    int mStart = ((int)(((azStart - ptc->scan.azim.start) * ptc->scan.azim.steps * ptc->scan.polar.steps * 4)
-                        / ptc->scan.azim.range) & ~0x3);
-                    int mStop = ((int)(((azStop - ptc->scan.azim.start) * ptc->scan.azim.steps * ptc->scan.polar.steps * 4)
-                        / ptc->scan.azim.range) & ~0x3);
-                    int mRange = (ptc->scan.azim.steps * ptc->scan.polar.steps * 4);
-                    int s = mStop - mStart;
-                    if (mStart < 0) mStart += mRange;
-                    if (mStop > mRange) mStop -= mRange;
-
-                    m = mStart;
-                    while(s > 0) {
-                        // find this scans' angle off of the sphere center
-                        float azDiff = azCtr - fbuf[m + 0];
-                        if (abs(azDiff) > 5) {
-                            if (azDiff > 0)
-                                azDiff -= (2 * PI);
-                            else
-                                azDiff += (2 * PI);
-                        }
-                        float scanCtrAngle = sqrt(pow(azDiff, 2) + pow(polCtr - fbuf[m + 1], 2));
-                        // find the remaining angle (Pi - rtAngle - scanCtrAngle)
-                        float scanRemAngle = (PI / 2) - scanCtrAngle;
-                        // find the center-offset length of the point on the sphere
-                        float scanPtOffset = sin(scanCtrAngle) * radCtr / sin(scanRemAngle);
-
-                        // use that offset to find the distance to the hit
-                        float distOffset = findHitDist(shapeZ, 0, scanPtOffset);
-
-                        // is it inside the sphere?
-                        if ((distOffset < (2 * shapeZ)) && (distOffset > 0)) {
-                            fbuf[m + 2] = radCtr - distOffset;
-                            fbuf[m + 3] = *reinterpret_cast<float*>(&shapeList[i].color);
-                        }
-                        s -= 4;
-                        m += 4;
-                        if (m >= mRange) {
-                            m = 0;
-                        }
-                    }
+    // note the columns that differ from the last frame
+    if (ptc->ptPrev != NULL) {
+        for (int c = colStart; c < colStop; c++) {
+            bool changed = ptc->obsMoved;
+            for (int i = c * geo->polarSteps; i < ((c + 1) * geo->polarSteps); i++) {
+                if (memcmp(&ptc->ptPrev[i * 2], &fbuf[(i * 4) + 2], 2 * sizeof(float)) != 0) {
+                    memcpy(&ptc->ptPrev[i * 2], &fbuf[(i * 4) + 2], 2 * sizeof(float));
+                    changed = true;
                 }
             }
+            ptc->colChanged[c] = changed;
         }
     }
 
-    // now convert all from APR to XYZ
-    i = 0;
-    for (int a = 0; a < ptc->scan.azim.steps; a++)
+    // range images are packed right from the radius and color
+    if (ptc->format == PCLOUD_RANGE_U16) {
+        packRanges(fbuf, geo, colStart, colStop, ptc->obs.z, ptc->ptOut, ptc->ptScale);
+        return;
+    }
+
+    // now convert the tile to XYZ
+    scanToXyzColumns(fbuf, geo, noise, colStart, colStop, ptc->obs.x, ptc->obs.y, ptc->obs.z);
+
+    // and pack it into the sample
+    if (ptc->ptOut != NULL) {
+        int bytes = pointFormatLayout(ptc->format)->bytes;
+        packPoints(ptc->format, &fbuf[ptStart * 4], ptStop - ptStart, &ptc->ptOut[ptStart * bytes], ptc->ptScale);
+    }
+}
+
+static bool nearerHit(const shapeHit &a, const shapeHit &b)
+{
+    return a.nearDist < b.nearDist;
+}
+
+/** --------------------------------------------------------
+ * shapesToPointCloud()
+ * render shapes to pointcloud, from observers' perspective
+ * This finds the observer and the angular bounding box of each shape, then
+ * renders the scan in tiles on the render threads; it returns when
+ * the whole point cloud is done.  'shapes' is a snapshot of the shape
+ * table, which does not change while the frame is rendered.
+ * A sliced frame is rendered one slice (of sliceTiles tiles) at a time,
+ * and sliceDone() is called as each one is done.
+ **/
+void shapesToPointCloud(const std::vector<shapeType> &shapes, ptCloud *ptc)
+{
+    // YELLOW gets to be the observer.
+    point lastObs = ptc->obs;
+    if (shapes[SC_YELLOW].shapesize)
     {
-        for (int p = 0; p < ptc->scan.polar.steps; p++)
+        ptc->obs.x = ((float)(shapes[SC_YELLOW].x - 120)) / 24;
+        ptc->obs.y = ((float)(shapes[SC_YELLOW].y - 135)) / 27;
+        ptc->obs.z = ((float)shapes[SC_YELLOW].shapesize) / 30;
+    }
+    ptc->obsMoved = ptc->obsMoved || (lastObs.x != ptc->obs.x) || (lastObs.y != ptc->obs.y)
+        || (lastObs.z != ptc->obs.z);
+
+    // for each other shape in shapelist that has a size
+    ptc->hits.clear();
+    for (size_t i = 0; i < shapes.size(); i++)
+    {
+        if ((i == SC_YELLOW) || (shapes[i].shapesize == 0)) {
+            continue;
+        }
+        // get the xyz and azimuth/polar/radius of the shape center
+        shapeHit h;
+        float shapeX = (((float)(shapes[i].x - 120)) / 24);
+        float shapeY = (((float)(shapes[i].y - 135)) / 27);
+        h.shapeZ = (((float)shapes[i].shapesize) / 60);
+        h.radCtr = sqrt(pow(shapeX - ptc->obs.x, 2)
+            + pow(shapeY - ptc->obs.y, 2)
+            + pow(h.shapeZ - ptc->obs.z, 2));
+        h.azCtr = atan2((shapeY - ptc->obs.y), (shapeX - ptc->obs.x)) + PI;
+        h.polCtr = acos((h.shapeZ - ptc->obs.z) / h.radCtr);
+        h.color = shapes[i].color;
+        if (!(h.radCtr > h.shapeZ)) {
+            continue;           // observer is inside the shape
+        }
+
+        // is this shape within the (azimuth) scan range?
+        if (((h.azCtr) > ptc->scan.azim.start) && (h.azCtr <= (ptc->scan.azim.start + ptc->scan.azim.range)))
         {
-            // order in buffer is Azim,Polar,Radius,Color --> X,Y,Z,Color
-            float tmpAz  = fbuf[i + 0];
-            float tmpPol = fbuf[i + 1];
-            float tmpRad = fbuf[i + 2];
-            fbuf[i + 0] = (tmpRad * sin(tmpPol) * cos(tmpAz) - ptc->obs.x);     // X
-            fbuf[i + 1] = -(tmpRad * sin(tmpPol) * sin(tmpAz) - ptc->obs.y);    // Y
-            fbuf[i + 2] = ((tmpRad * cos(tmpPol)) + ptc->obs.z);                // Z
-            // limit Z to ground level and change dot color
-            if (fbuf[i + 2] < 0) {
-                fbuf[i + 2] = 0;
-                uint32_t tmpColor = 0x404040;
-                fbuf[i+3] = *reinterpret_cast<float*>(&tmpColor);
+            // angular radius of the shape at its current distance from observer:
+            // scan rays further than this from the center miss it
+            float span = atan2(h.shapeZ, h.radCtr);
+            h.span2 = span * span;
+            h.nearDist = h.radCtr - h.shapeZ;
+
+            // bounding box: the columns and rows within 'span' of the center
+            int col0 = (int)floor(((h.azCtr - span - ptc->scan.azim.start) * ptc->scan.azim.steps)
+                / ptc->scan.azim.range);
+            int col1 = (int)floor(((h.azCtr + span - ptc->scan.azim.start) * ptc->scan.azim.steps)
+                / ptc->scan.azim.range);
+            h.colCount = std::min(col1 - col0 + 1, ptc->scan.azim.steps);
+            h.colStart = (col0 < 0) ? (col0 + ptc->scan.azim.steps) : col0;
+            float pStep = ptc->scan.polar.range / ptc->scan.polar.steps;
+            h.rowStart = std::max(0, (int)floor((h.polCtr - span - ptc->scan.polar.start) / pStep));
+            h.rowStop = std::min(ptc->scan.polar.steps, (int)floor((h.polCtr + span - ptc->scan.polar.start) / pStep) + 2);
+            if ((h.rowStart >= h.rowStop) || (h.colStart >= ptc->scan.azim.steps)) {
+                continue;       // above or below the scan
             }
-            i += 4;
+            ptc->hits.push_back(h);
         }
     }
+
+    // nearest shapes first, so farther ones are often skipped as occluded
+    std::sort(ptc->hits.begin(), ptc->hits.end(), nearerHit);
+
+    // render all tiles (and convert to XYZ)
+    if (ptc->sliceTiles > 0) {
+        for (ptc->tileBase = 0; ptc->tileBase < ptc->tileCount; ptc->tileBase += ptc->sliceTiles) {
+            int tiles = std::min(ptc->sliceTiles, ptc->tileCount - ptc->tileBase);
+            ptc->pool->run(tiles, renderTile, ptc);
+            int colStart = ptc->tileBase * LIDAR_TILE_COLUMNS;
+            ptc->sliceDone(colStart, std::min(tiles * LIDAR_TILE_COLUMNS, ptc->scan.azim.steps - colStart),
+                ptc->sliceArg);
+        }
+        ptc->tileBase = 0;
+    }
+    else {
+        ptc->pool->run(ptc->tileCount, renderTile, ptc);
+    }
+    ptc->obsMoved = false;
 }
 
 /** -----------------------------------------------------
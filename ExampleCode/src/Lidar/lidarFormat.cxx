@@ -0,0 +1,225 @@
+/** ------------------------------------------------------------------------
+ * lidarFormat.cxx
+ * Point layouts for the PointCloud2 'data_' of the LiDAR publisher.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <cmath>
+#include <string.h>
+#include "lidarFormat.h"
+
+static const pointLayout layouts[] = {
+    { "xyzrgb", 16, 4, {
+        { "x", 0, PCLOUD_DATATYPE_FLOAT32 },
+        { "y", 4, PCLOUD_DATATYPE_FLOAT32 },
+        { "z", 8, PCLOUD_DATATYPE_FLOAT32 },
+        { "rgb", 12, PCLOUD_DATATYPE_FLOAT32 } } },
+    { "xyzi", 13, 4, {
+        { "x", 0, PCLOUD_DATATYPE_FLOAT32 },
+        { "y", 4, PCLOUD_DATATYPE_FLOAT32 },
+        { "z", 8, PCLOUD_DATATYPE_FLOAT32 },
+        { "intensity", 12, PCLOUD_DATATYPE_UINT8 } } },
+    { "xyzi16f", 7, 4, {
+        { "x", 0, PCLOUD_DATATYPE_FLOAT16 },
+        { "y", 2, PCLOUD_DATATYPE_FLOAT16 },
+        { "z", 4, PCLOUD_DATATYPE_FLOAT16 },
+        { "intensity", 6, PCLOUD_DATATYPE_UINT8 } } },
+    { "xyzi16", 7, 4, {
+        { "x", 0, PCLOUD_DATATYPE_INT16 },
+        { "y", 2, PCLOUD_DATATYPE_INT16 },
+        { "z", 4, PCLOUD_DATATYPE_INT16 },
+        { "intensity", 6, PCLOUD_DATATYPE_UINT8 } } },
+    { "range", 3, 2, {
+        { "range", 0, PCLOUD_DATATYPE_UINT16 },
+        { "intensity", 2, PCLOUD_DATATYPE_UINT8 } } }
+};
+
+pointFormat pointFormatFromName(const std::string &name)
+{
+    for (int i = 0; i < (int)(sizeof(layouts) / sizeof(layouts[0])); i++) {
+        if (name == layouts[i].name) {
+            return (pointFormat)i;
+        }
+    }
+    return PCLOUD_XYZRGB_F32;
+}
+
+const pointLayout *pointFormatLayout(pointFormat fmt)
+{
+    return &layouts[fmt];
+}
+
+/** --------------------------------------------------------
+ * floatToHalf() / halfToFloat()
+ **/
+uint16_t floatToHalf(float f)
+{
+    uint32_t x;
+    memcpy(&x, &f, sizeof(x));
+    uint16_t sign = (uint16_t)((x >> 16) & 0x8000);
+    uint32_t absx = x & 0x7fffffff;
+
+    if (absx >= 0x7f800000) {                   // Inf or NaN
+        return sign | 0x7c00 | ((absx > 0x7f800000) ? 0x200 : 0);
+    }
+    if (absx >= 0x477ff000) {                   // rounds to >= 65520: Inf
+        return sign | 0x7c00;
+    }
+    if (absx < 0x38800000) {                    // subnormal half (or 0)
+        if (absx < 0x33000000) {
+            return sign;
+        }
+        uint32_t mant = (absx & 0x7fffff) | 0x800000;
+        int shift = 126 - (int)(absx >> 23);    // 14..24
+        uint32_t half = mant >> shift;
+        uint32_t rem = mant & ((1u << shift) - 1);
+        uint32_t mid = 1u << (shift - 1);
+        if ((rem > mid) || ((rem == mid) && (half & 1))) {
+            half++;
+        }
+        return sign | (uint16_t)half;
+    }
+    // normal: rebias the exponent, round the mantissa to 10 bits
+    uint32_t half = ((absx - 0x38000000) >> 13);
+    uint32_t rem = absx & 0x1fff;
+    if ((rem > 0x1000) || ((rem == 0x1000) && (half & 1))) {
+        half++;
+    }
+    return sign | (uint16_t)half;
+}
+
+float halfToFloat(uint16_t h)
+{
+    uint32_t sign = ((uint32_t)h & 0x8000) << 16;
+    uint32_t exp = (h >> 10) & 0x1f;
+    uint32_t mant = h & 0x3ff;
+    uint32_t x;
+
+    if (exp == 0x1f) {                          // Inf or NaN
+        x = sign | 0x7f800000 | (mant << 13);
+    }
+    else if (exp != 0) {                        // normal
+        x = sign | ((exp + 112) << 23) | (mant << 13);
+    }
+    else if (mant != 0) {                       // subnormal: normalize
+        exp = 113;
+        while ((mant & 0x400) == 0) {
+            mant <<= 1;
+            exp--;
+        }
+        x = sign | (exp << 23) | ((mant & 0x3ff) << 13);
+    }
+    else {
+        x = sign;
+    }
+    float f;
+    memcpy(&f, &x, sizeof(f));
+    return f;
+}
+
+/** --------------------------------------------------------
+ * colorToIntensity()
+ * brightness (luma) of a 0x00RRGGBB color stored in a float
+ **/
+static inline uint8_t colorToIntensity(float c)
+{
+    uint32_t rgb;
+    memcpy(&rgb, &c, sizeof(rgb));
+    uint32_t r = (rgb >> 16) & 0xff;
+    uint32_t g = (rgb >> 8) & 0xff;
+    uint32_t b = rgb & 0xff;
+    return (uint8_t)(((r * 77) + (g * 150) + (b * 29)) >> 8);
+}
+
+static inline int16_t quantize(float v, float invScale)
+{
+    float q = v * invScale;
+    if (q > 32767.0f) {
+        return 32767;
+    }
+    if (q < -32767.0f) {
+        return -32767;
+    }
+    return (int16_t)lrintf(q);
+}
+
+/** --------------------------------------------------------
+ * packPoints()
+ **/
+void packPoints(pointFormat fmt, const float *xyzc, int count, uint8_t *out, float scale)
+{
+    switch (fmt) {
+        case PCLOUD_XYZI_F32:
+            for (int i = 0; i < count; i++, xyzc += 4, out += 13) {
+                memcpy(out, xyzc, 3 * sizeof(float));
+                out[12] = colorToIntensity(xyzc[3]);
+            }
+            break;
+
+        case PCLOUD_XYZI_F16:
+            for (int i = 0; i < count; i++, xyzc += 4, out += 7) {
+                uint16_t h[3] = { floatToHalf(xyzc[0]), floatToHalf(xyzc[1]), floatToHalf(xyzc[2]) };
+                memcpy(out, h, sizeof(h));
+                out[6] = colorToIntensity(xyzc[3]);
+            }
+            break;
+
+        case PCLOUD_XYZI_I16:
+        {
+            float invScale = (scale > 0) ? (1.0f / scale) : 1000.0f;
+            for (int i = 0; i < count; i++, xyzc += 4, out += 7) {
+                int16_t q[3] = { quantize(xyzc[0], invScale), quantize(xyzc[1], invScale),
+                    quantize(xyzc[2], invScale) };
+                memcpy(out, q, sizeof(q));
+                out[6] = colorToIntensity(xyzc[3]);
+            }
+            break;
+        }
+
+        case PCLOUD_RANGE_U16:
+            break;              // needs the scan angles: see packRanges()
+
+        default:
+            memcpy(out, xyzc, (size_t)count * 4 * sizeof(float));
+            break;
+    }
+}
+
+/** --------------------------------------------------------
+ * packRanges()
+ **/
+void packRanges(const float *rc, const scanGeometry *geo, int colStart, int colStop,
+    float obsZ, uint8_t *out, float scale)
+{
+    float invScale = (scale > 0) ? (1.0f / scale) : 1000.0f;
+    uint32_t groundColor = LIDAR_GROUND_COLOR;
+    float ground;
+    memcpy(&ground, &groundColor, sizeof(ground));
+    int rows = geo->polarSteps;
+
+    for (int a = colStart; a < colStop; a++) {
+        const float *pt = &rc[a * rows * 4];
+        uint8_t *cell = &out[a * rows * 3];
+        for (int p = 0; p < rows; p++, pt += 4, cell += 3) {
+            float r = pt[2];
+            float c = pt[3];
+            // limit the ray to ground level and change dot color
+            float cP = geo->cosPolar[p];
+            if (((r * cP) + obsZ) < 0) {
+                r = -obsZ / cP;
+                c = ground;
+            }
+            float q = r * invScale;
+            uint16_t range = (q >= 65535.0f) ? 0xffff : ((q > 0) ? (uint16_t)lrintf(q) : 0);
+            memcpy(cell, &range, sizeof(range));
+            cell[2] = colorToIntensity(c);
+        }
+    }
+}
@@ -0,0 +1,107 @@
+/** ------------------------------------------------------------------------
+ * lidarFormat.h
+ * Point layouts for the PointCloud2 'data_' of the LiDAR publisher.
+ * The renderer always works in X,Y,Z,Color float32's; these layouts
+ * pack that into fewer bytes on the wire:
+ *   xyzrgb   float32 x,y,z,rgb                      16 bytes/point
+ *   xyzi     float32 x,y,z + uint8 intensity        13 bytes/point
+ *   xyzi16f  float16 x,y,z + uint8 intensity         7 bytes/point
+ *   xyzi16   int16 x,y,z (* scale) + uint8 intensity 7 bytes/point
+ *   range    uint16 range (* scale) + uint8 intensity  3 bytes/point
+ * Points are packed (no padding), in the host byte order.  Intensity is
+ * the brightness of the rendered color.  The int16 and range scales
+ * (meters per count) are not carried in PointCloud2: the publisher sends
+ * them once on a separate topic, with the scan geometry.
+ * 'range' is an organized range image in the sensor frame: the angles
+ * of each cell are those of the scan grid, from that same topic.
+ * xyzi16f is not interoperable: ROS defines no float16 PointField
+ * datatype, so other PointCloud2 subscribers can't read its points.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarFormat_h
+#define lidarFormat_h
+
+#include <stdint.h>
+#include <string>
+#include "lidarKernels.h"
+
+// PointField datatype codes (as in ROS sensor_msgs/PointField)
+#define PCLOUD_DATATYPE_UINT8       (2)
+#define PCLOUD_DATATYPE_INT16       (3)
+#define PCLOUD_DATATYPE_UINT16      (4)
+#define PCLOUD_DATATYPE_FLOAT32     (7)
+#define PCLOUD_DATATYPE_FLOAT16     (9)     // not defined by ROS; xyzi16f only
+
+#define PCLOUD_FIELDS_MAX           (4)     // bound of PointCloud2 fields_
+
+typedef enum {
+    PCLOUD_XYZRGB_F32 = 0,
+    PCLOUD_XYZI_F32,
+    PCLOUD_XYZI_F16,
+    PCLOUD_XYZI_I16,
+    PCLOUD_RANGE_U16
+} pointFormat;
+
+typedef struct {
+    const char  *name;
+    uint32_t    offset;
+    uint8_t     datatype;
+} pointFieldDesc;
+
+typedef struct {
+    const char      *name;      // as set in the .properties file
+    int             bytes;      // per point (point_step)
+    int             fieldCount;
+    pointFieldDesc  fields[PCLOUD_FIELDS_MAX];
+} pointLayout;
+
+/** --------------------------------------------------------
+ * pointFormatFromName()
+ * "xyzrgb", "xyzi", "xyzi16f", "xyzi16" or "range"; empty or unknown
+ * names select xyzrgb.
+ **/
+pointFormat pointFormatFromName(const std::string &name);
+
+/** --------------------------------------------------------
+ * pointFormatLayout()
+ * size and field descriptors of a format
+ **/
+const pointLayout *pointFormatLayout(pointFormat fmt);
+
+/** --------------------------------------------------------
+ * packPoints()
+ * pack 'count' X,Y,Z,Color float32 points from 'xyzc' into 'out' in
+ * format 'fmt'.  'scale' is the meters per count of xyzi16 (values
+ * out of range are clamped).  xyzrgb is a plain copy.
+ * 'range' points are not packed from X,Y,Z: use packRanges().
+ **/
+void packPoints(pointFormat fmt, const float *xyzc, int count, uint8_t *out, float scale);
+
+/** --------------------------------------------------------
+ * packRanges()
+ * pack columns colStart..colStop-1 of a scan of -,-,Radius,Color
+ * float32's into 'range' cells ('rc' and 'out' point to the start
+ * of the full scan).  Rays that reach the ground before the radius
+ * (sensor at height obsZ) are cut there and get LIDAR_GROUND_COLOR,
+ * as in scanToXyz().  Ranges are in 'scale' meters per count,
+ * clamped to 0xffff.
+ **/
+void packRanges(const float *rc, const scanGeometry *geo, int colStart, int colStop,
+    float obsZ, uint8_t *out, float scale);
+
+/** --------------------------------------------------------
+ * floatToHalf() / halfToFloat()
+ * IEEE 754 binary16 conversion (round to nearest even)
+ **/
+uint16_t floatToHalf(float f);
+float halfToFloat(uint16_t h);
+
+#endif  // ndef lidarFormat_h
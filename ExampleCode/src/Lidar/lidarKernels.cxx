@@ -0,0 +1,344 @@
+/** ------------------------------------------------------------------------
+ * lidarKernels.cxx
+ * Scan geometry and per-point math kernels used by the LiDAR point cloud
+ * generator.
+ *
+ * The sin/cos of every scan angle is looked up in the scanGeometry tables,
+ * and the small per-point angular noise is applied with the small-angle
+ * identities sin(a+e) ~= sin(a) + e*cos(a), cos(a+e) ~= cos(a) - e*sin(a)
+ * (e is < 0.002 radians), so converting a point costs a few multiply-adds.
+ * The SSE4.1 (4 points per iteration) and AVX2 (8 points per iteration)
+ * versions are chosen at runtime, so the same binary runs on any x86 CPU;
+ * non-x86 builds only compile the scalar version.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <cmath>
+#include <string.h>
+#include "lidarKernels.h"
+
+// SIMD kernels need x86, and (for gcc) a compiler that accepts
+// intrinsics inside functions with a 'target' attribute (gcc >= 4.9).
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+#if defined(_MSC_VER)
+#define LIDAR_KERNEL_SIMD
+#include <intrin.h>
+#include <immintrin.h>
+#define LIDAR_TARGET_SSE41
+#define LIDAR_TARGET_AVX2
+#elif defined(__clang__) || (__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9))
+#define LIDAR_KERNEL_SIMD
+#include <immintrin.h>
+#define LIDAR_TARGET_SSE41  __attribute__((target("sse4.1")))
+#define LIDAR_TARGET_AVX2   __attribute__((target("avx2,fma")))
+#endif
+#endif
+
+typedef void (*scanToXyzFn)(float *fbuf, const scanGeometry *geo, const float *noise,
+    int colStart, int colStop, float obsX, float obsY, float obsZ);
+
+/** --------------------------------------------------------
+ * buildScanGeometry()
+ **/
+void buildScanGeometry(scanGeometry *geo,
+    float azimStart, float azimRange, int azimSteps,
+    float polarStart, float polarRange, int polarSteps)
+{
+    float aStep = azimRange / azimSteps;
+    float pStep = polarRange / polarSteps;
+
+    geo->azimSteps = azimSteps;
+    geo->polarSteps = polarSteps;
+    geo->azim.resize(azimSteps);
+    geo->sinAzim.resize(azimSteps);
+    geo->cosAzim.resize(azimSteps);
+    for (int a = 0; a < azimSteps; a++) {
+        geo->azim[a] = azimStart + (a * aStep);
+        geo->sinAzim[a] = sinf(geo->azim[a]);
+        geo->cosAzim[a] = cosf(geo->azim[a]);
+    }
+    geo->polar.resize(polarSteps);
+    geo->sinPolar.resize(polarSteps);
+    geo->cosPolar.resize(polarSteps);
+    for (int p = 0; p < polarSteps; p++) {
+        geo->polar[p] = polarStart + (p * pStep);
+        geo->sinPolar[p] = sinf(geo->polar[p]);
+        geo->cosPolar[p] = cosf(geo->polar[p]);
+    }
+}
+
+/** --------------------------------------------------------
+ * columnToXyzScalar()
+ * convert 'rows' points of one scan column, starting at polar row 'p'.
+ * Used by the scalar kernel and for the tail of each SIMD column; it is
+ * inlined there so that the AVX2 loop never calls into non-VEX code.
+ **/
+static inline void columnToXyzScalar(float *fbuf, const scanGeometry *geo, const float *noise,
+    int p, int rows, float sinAz, float cosAz, float obsX, float obsY, float obsZ)
+{
+    uint32_t groundColor = LIDAR_GROUND_COLOR;
+    for (int i = 0; i < rows; i++, p++, fbuf += 4)
+    {
+        // order in buffer is -,-,Radius,Color --> X,Y,Z,Color
+        float e = (noise != NULL) ? noise[i] : 0;
+        float sA = sinAz + (e * cosAz);
+        float cA = cosAz - (e * sinAz);
+        float sP = geo->sinPolar[p] + (e * geo->cosPolar[p]);
+        float cP = geo->cosPolar[p] - (e * geo->sinPolar[p]);
+        float tmpRad = fbuf[2];
+        fbuf[0] = (tmpRad * sP * cA - obsX);        // X
+        fbuf[1] = -(tmpRad * sP * sA - obsY);       // Y
+        fbuf[2] = ((tmpRad * cP) + obsZ);           // Z
+        // limit Z to ground level and change dot color
+        if (fbuf[2] < 0) {
+            fbuf[2] = 0;
+            memcpy(&fbuf[3], &groundColor, sizeof(float));
+        }
+    }
+}
+
+static void scanToXyzScalar(float *fbuf, const scanGeometry *geo, const float *noise,
+    int colStart, int colStop, float obsX, float obsY, float obsZ)
+{
+    int rows = geo->polarSteps;
+    for (int a = colStart; a < colStop; a++) {
+        columnToXyzScalar(&fbuf[a * rows * 4], geo, (noise != NULL) ? &noise[a * rows] : NULL,
+            0, rows, geo->sinAzim[a], geo->cosAzim[a], obsX, obsY, obsZ);
+    }
+}
+
+#ifdef LIDAR_KERNEL_SIMD
+/** --------------------------------------------------------
+ * scanToXyzSse41()
+ * 4 points of a column per iteration: transpose 4 points into
+ * -/-/Rad/Color vectors, convert, clamp with a compare mask, and
+ * transpose back.
+ **/
+LIDAR_TARGET_SSE41
+static void scanToXyzSse41(float *fbuf, const scanGeometry *geo, const float *noise,
+    int colStart, int colStop, float obsX, float obsY, float obsZ)
+{
+    const __m128 vObsX = _mm_set1_ps(obsX);
+    const __m128 vObsY = _mm_set1_ps(obsY);
+    const __m128 vObsZ = _mm_set1_ps(obsZ);
+    const __m128 vZero = _mm_setzero_ps();
+    const __m128 vGround = _mm_castsi128_ps(_mm_set1_epi32(LIDAR_GROUND_COLOR));
+    int rows = geo->polarSteps;
+    int n = rows & ~3;
+
+    for (int a = colStart; a < colStop; a++) {
+        float *col = &fbuf[a * rows * 4];
+        const float *colNoise = (noise != NULL) ? &noise[a * rows] : NULL;
+        const __m128 vSinAz = _mm_set1_ps(geo->sinAzim[a]);
+        const __m128 vCosAz = _mm_set1_ps(geo->cosAzim[a]);
+
+        for (int p = 0; p < n; p += 4) {
+            float *pt = &col[p * 4];
+            __m128 x = _mm_loadu_ps(pt + 0);
+            __m128 y = _mm_loadu_ps(pt + 4);
+            __m128 rad = _mm_loadu_ps(pt + 8);
+            __m128 color = _mm_loadu_ps(pt + 12);
+            _MM_TRANSPOSE4_PS(x, y, rad, color);
+
+            __m128 sA = vSinAz;
+            __m128 cA = vCosAz;
+            __m128 sP = _mm_loadu_ps(&geo->sinPolar[p]);
+            __m128 cP = _mm_loadu_ps(&geo->cosPolar[p]);
+            if (colNoise != NULL) {
+                __m128 e = _mm_loadu_ps(&colNoise[p]);
+                __m128 sP0 = sP;
+                sA = _mm_add_ps(vSinAz, _mm_mul_ps(e, vCosAz));
+                cA = _mm_sub_ps(vCosAz, _mm_mul_ps(e, vSinAz));
+                sP = _mm_add_ps(sP, _mm_mul_ps(e, cP));
+                cP = _mm_sub_ps(cP, _mm_mul_ps(e, sP0));
+            }
+            __m128 rSinPol = _mm_mul_ps(rad, sP);
+            x = _mm_sub_ps(_mm_mul_ps(rSinPol, cA), vObsX);
+            y = _mm_sub_ps(vObsY, _mm_mul_ps(rSinPol, sA));
+            __m128 z = _mm_add_ps(_mm_mul_ps(rad, cP), vObsZ);
+
+            // limit Z to ground level and change dot color
+            __m128 below = _mm_cmplt_ps(z, vZero);
+            z = _mm_andnot_ps(below, z);
+            color = _mm_blendv_ps(color, vGround, below);
+
+            _MM_TRANSPOSE4_PS(x, y, z, color);
+            _mm_storeu_ps(pt + 0, x);
+            _mm_storeu_ps(pt + 4, y);
+            _mm_storeu_ps(pt + 8, z);
+            _mm_storeu_ps(pt + 12, color);
+        }
+        columnToXyzScalar(&col[n * 4], geo, (colNoise != NULL) ? &colNoise[n] : NULL,
+            n, rows - n, geo->sinAzim[a], geo->cosAzim[a], obsX, obsY, obsZ);
+    }
+}
+
+/** --------------------------------------------------------
+ * transpose8x4()
+ * 4 registers of 2 points each <--> 4 registers of one field each.
+ * The field registers hold points in 0,2,4,6,1,3,5,7 order, which
+ * doesn't matter for element-wise math, and the same shuffle sequence
+ * restores the interleaved order.  Table values loaded alongside are
+ * permuted into the same order with TRANSPOSE8X4_ORDER.
+ **/
+#define TRANSPOSE8X4_ORDER  _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7)
+
+LIDAR_TARGET_AVX2
+static inline void transpose8x4(__m256 &r0, __m256 &r1, __m256 &r2, __m256 &r3)
+{
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+    r0 = _mm256_shuffle_ps(t0, t2, 0x44);
+    r1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+    r2 = _mm256_shuffle_ps(t1, t3, 0x44);
+    r3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+}
+
+/** --------------------------------------------------------
+ * scanToXyzAvx2()
+ * 8 points of a column per iteration, same steps as the SSE4.1 version
+ **/
+LIDAR_TARGET_AVX2
+static void scanToXyzAvx2(float *fbuf, const scanGeometry *geo, const float *noise,
+    int colStart, int colStop, float obsX, float obsY, float obsZ)
+{
+    const __m256 vObsX = _mm256_set1_ps(obsX);
+    const __m256 vObsY = _mm256_set1_ps(obsY);
+    const __m256 vObsZ = _mm256_set1_ps(obsZ);
+    const __m256 vZero = _mm256_setzero_ps();
+    const __m256 vGround = _mm256_castsi256_ps(_mm256_set1_epi32(LIDAR_GROUND_COLOR));
+    const __m256i order = TRANSPOSE8X4_ORDER;
+    int rows = geo->polarSteps;
+    int n = rows & ~7;
+
+    for (int a = colStart; a < colStop; a++) {
+        float *col = &fbuf[a * rows * 4];
+        const float *colNoise = (noise != NULL) ? &noise[a * rows] : NULL;
+        const __m256 vSinAz = _mm256_set1_ps(geo->sinAzim[a]);
+        const __m256 vCosAz = _mm256_set1_ps(geo->cosAzim[a]);
+
+        for (int p = 0; p < n; p += 8) {
+            float *pt = &col[p * 4];
+            __m256 x = _mm256_loadu_ps(pt + 0);
+            __m256 y = _mm256_loadu_ps(pt + 8);
+            __m256 rad = _mm256_loadu_ps(pt + 16);
+            __m256 color = _mm256_loadu_ps(pt + 24);
+            transpose8x4(x, y, rad, color);
+
+            __m256 sA = vSinAz;
+            __m256 cA = vCosAz;
+            __m256 sP = _mm256_permutevar8x32_ps(_mm256_loadu_ps(&geo->sinPolar[p]), order);
+            __m256 cP = _mm256_permutevar8x32_ps(_mm256_loadu_ps(&geo->cosPolar[p]), order);
+            if (colNoise != NULL) {
+                __m256 e = _mm256_permutevar8x32_ps(_mm256_loadu_ps(&colNoise[p]), order);
+                __m256 sP0 = sP;
+                sA = _mm256_fmadd_ps(e, vCosAz, vSinAz);
+                cA = _mm256_fnmadd_ps(e, vSinAz, vCosAz);
+                sP = _mm256_fmadd_ps(e, cP, sP);
+                cP = _mm256_fnmadd_ps(e, sP0, cP);
+            }
+            __m256 rSinPol = _mm256_mul_ps(rad, sP);
+            x = _mm256_fmsub_ps(rSinPol, cA, vObsX);
+            y = _mm256_fnmadd_ps(rSinPol, sA, vObsY);
+            __m256 z = _mm256_fmadd_ps(rad, cP, vObsZ);
+
+            __m256 below = _mm256_cmp_ps(z, vZero, _CMP_LT_OQ);
+            z = _mm256_andnot_ps(below, z);
+            color = _mm256_blendv_ps(color, vGround, below);
+
+            transpose8x4(x, y, z, color);
+            _mm256_storeu_ps(pt + 0, x);
+            _mm256_storeu_ps(pt + 8, y);
+            _mm256_storeu_ps(pt + 16, z);
+            _mm256_storeu_ps(pt + 24, color);
+        }
+        columnToXyzScalar(&col[n * 4], geo, (colNoise != NULL) ? &colNoise[n] : NULL,
+            n, rows - n, geo->sinAzim[a], geo->cosAzim[a], obsX, obsY, obsZ);
+    }
+}
+
+/** --------------------------------------------------------
+ * cpuHasSse41() / cpuHasAvx2()
+ * AVX2 also needs FMA, and OS support for saving the YMM registers
+ **/
+static bool cpuHasSse41(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    return (info[2] & (1 << 19)) != 0;
+#else
+    return __builtin_cpu_supports("sse4.1");
+#endif
+}
+
+static bool cpuHasAvx2(void)
+{
+#ifdef _MSC_VER
+    int info[4];
+    __cpuid(info, 1);
+    bool fma = (info[2] & (1 << 12)) != 0;
+    bool osxsave = (info[2] & (1 << 27)) != 0;
+    bool avx = (info[2] & (1 << 28)) != 0;
+    if (!(fma && osxsave && avx) || ((_xgetbv(0) & 6) != 6)) {
+        return false;
+    }
+    __cpuidex(info, 7, 0);
+    return (info[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#endif
+}
+#endif  // def LIDAR_KERNEL_SIMD
+
+/** --------------------------------------------------------
+ * selectScanToXyz()
+ * pick the widest kernel this CPU supports
+ **/
+static scanToXyzFn selectScanToXyz(const char **name)
+{
+#ifdef LIDAR_KERNEL_SIMD
+#ifndef _MSC_VER
+    __builtin_cpu_init();   // this runs from a static initializer
+#endif
+    if (cpuHasAvx2()) {
+        *name = "AVX2";
+        return scanToXyzAvx2;
+    }
+    if (cpuHasSse41()) {
+        *name = "SSE4.1";
+        return scanToXyzSse41;
+    }
+#endif
+    *name = "scalar";
+    return scanToXyzScalar;
+}
+
+static const char *scanToXyzName = NULL;
+static const scanToXyzFn scanToXyzKernel = selectScanToXyz(&scanToXyzName);
+
+void scanToXyz(float *fbuf, const scanGeometry *geo, const float *noise,
+    float obsX, float obsY, float obsZ)
+{
+    scanToXyzKernel(fbuf, geo, noise, 0, geo->azimSteps, obsX, obsY, obsZ);
+}
+
+void scanToXyzColumns(float *fbuf, const scanGeometry *geo, const float *noise,
+    int colStart, int colStop, float obsX, float obsY, float obsZ)
+{
+    scanToXyzKernel(fbuf, geo, noise, colStart, colStop, obsX, obsY, obsZ);
+}
+
+const char *scanToXyzKernelName(void)
+{
+    return scanToXyzName;
+}
@@ -0,0 +1,77 @@
+/** ------------------------------------------------------------------------
+ * lidarKernels.h
+ * Scan geometry and per-point math kernels used by the LiDAR point cloud
+ * generator.  Each kernel has a scalar version and SSE4.1 / AVX2 versions;
+ * the widest one supported by the running CPU is selected at first use.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarKernels_h
+#define lidarKernels_h
+
+#include <stdint.h>
+#include <vector>
+
+#define LIDAR_GROUND_COLOR      (0x404040)  // color of points clamped to z=0
+
+/** --------------------------------------------------------
+ * scanGeometry
+ * Angles of the scan grid and their sin/cos, as a structure of arrays:
+ * one entry per column (azimuth) and one per row (polar).
+ * The grid is fixed by lidar.properties, so this is built once at startup.
+ **/
+typedef struct {
+    int                 azimSteps;  // columns
+    int                 polarSteps; // rows (points per column)
+    std::vector<float>  azim;       // in radians
+    std::vector<float>  sinAzim;
+    std::vector<float>  cosAzim;
+    std::vector<float>  polar;      // in radians
+    std::vector<float>  sinPolar;
+    std::vector<float>  cosPolar;
+} scanGeometry;
+
+/** --------------------------------------------------------
+ * buildScanGeometry()
+ * fill 'geo' for a scan of 'steps' columns/rows over 'range'
+ * radians from 'start', for azimuth and polar.
+ **/
+void buildScanGeometry(scanGeometry *geo,
+    float azimStart, float azimRange, int azimSteps,
+    float polarStart, float polarRange, int polarSteps);
+
+/** --------------------------------------------------------
+ * scanToXyz()
+ * Convert a full scan in place to X,Y,Z,Color (4 interleaved float32's
+ * per point, column by column) as seen from the observer at obsX,obsY,obsZ.
+ * On input only the Radius (3rd) and Color (4th) of each point are used;
+ * the angles come from 'geo', offset by the per-point angular 'noise'
+ * (may be NULL).  Points below ground level are clamped to z=0 and given
+ * the LIDAR_GROUND_COLOR.
+ **/
+void scanToXyz(float *fbuf, const scanGeometry *geo, const float *noise,
+    float obsX, float obsY, float obsZ);
+
+/** --------------------------------------------------------
+ * scanToXyzColumns()
+ * same as scanToXyz(), for columns colStart..colStop-1 only.
+ * 'fbuf' and 'noise' still point to the start of the full scan, so
+ * threads can convert separate column ranges of one scan.
+ **/
+void scanToXyzColumns(float *fbuf, const scanGeometry *geo, const float *noise,
+    int colStart, int colStop, float obsX, float obsY, float obsZ);
+
+/** --------------------------------------------------------
+ * scanToXyzKernelName()
+ * returns the name of the kernel used by scanToXyz() on this CPU
+ **/
+const char *scanToXyzKernelName(void);
+
+#endif  // ndef lidarKernels_h
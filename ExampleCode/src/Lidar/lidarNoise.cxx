@@ -0,0 +1,150 @@
+/** ------------------------------------------------------------------------
+ * lidarNoise.cxx
+ * Pseudo-random position noise for the LiDAR point cloud generator.
+ *
+ * Both engines keep NOISE_LANES independent generators and emit one value
+ * from each lane in turn, so fill() is a loop of independent shift/xor
+ * (or multiply) steps that the compiler can vectorize.  Lane states are
+ * derived from (seed, stream) with splitmix64, so each render thread
+ * can get its own uncorrelated, reproducible stream.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <stddef.h>
+#include "lidarNoise.h"
+
+// 24 random bits --> float in [0, 1)
+#define NOISE_TO_UNIT   (1.0f / 16777216.0f)
+
+/** --------------------------------------------------------
+ * splitmix64()
+ * advance 'x' and return the next well-mixed 64-bit value
+ **/
+static uint64_t splitmix64(uint64_t *x)
+{
+    uint64_t z = (*x += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+/** --------------------------------------------------------
+ * XorShiftNoise
+ **/
+XorShiftNoise::XorShiftNoise(uint64_t seed, uint64_t stream)
+{
+    this->seed(seed, stream);
+}
+
+void XorShiftNoise::seed(uint64_t seed, uint64_t stream)
+{
+    uint64_t sm = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+    for (int l = 0; l < NOISE_LANES; l++) {
+        uint32_t s = 0;
+        while (s == 0) {            // xorshift state must not be 0
+            s = (uint32_t)splitmix64(&sm);
+        }
+        _state[l] = s;
+    }
+}
+
+static inline uint32_t xorshift32(uint32_t *state)
+{
+    uint32_t x = *state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    *state = x;
+    return x;
+}
+
+void XorShiftNoise::fill(float *out, int count, float scale)
+{
+    const float k = scale * NOISE_TO_UNIT;
+    int i = 0;
+    for (; (i + NOISE_LANES) <= count; i += NOISE_LANES) {
+        for (int l = 0; l < NOISE_LANES; l++) {
+            out[i + l] = (float)(int32_t)(xorshift32(&_state[l]) >> 8) * k;
+        }
+    }
+    for (int l = 0; i < count; i++, l++) {
+        out[i] = (float)(int32_t)(xorshift32(&_state[l]) >> 8) * k;
+    }
+}
+
+/** --------------------------------------------------------
+ * PcgNoise
+ * PCG32 XSH-RR; each lane has its own odd increment (PCG stream)
+ **/
+#define PCG_MULT    (6364136223846793005ULL)
+
+PcgNoise::PcgNoise(uint64_t seed, uint64_t stream)
+{
+    this->seed(seed, stream);
+}
+
+void PcgNoise::seed(uint64_t seed, uint64_t stream)
+{
+    uint64_t sm = seed ^ (stream * 0xD1B54A32D192ED03ULL);
+    for (int l = 0; l < NOISE_LANES; l++) {
+        _inc[l] = (splitmix64(&sm) << 1) | 1;
+        _state[l] = splitmix64(&sm) + _inc[l];
+        _state[l] = (_state[l] * PCG_MULT) + _inc[l];
+    }
+}
+
+static inline uint32_t pcg32(uint64_t *state, uint64_t inc)
+{
+    uint64_t old = *state;
+    *state = (old * PCG_MULT) + inc;
+    uint32_t xorshifted = (uint32_t)(((old >> 18) ^ old) >> 27);
+    uint32_t rot = (uint32_t)(old >> 59);
+    return (xorshifted >> rot) | (xorshifted << ((32 - rot) & 31));
+}
+
+void PcgNoise::fill(float *out, int count, float scale)
+{
+    const float k = scale * NOISE_TO_UNIT;
+    int i = 0;
+    for (; (i + NOISE_LANES) <= count; i += NOISE_LANES) {
+        for (int l = 0; l < NOISE_LANES; l++) {
+            out[i + l] = (float)(int32_t)(pcg32(&_state[l], _inc[l]) >> 8) * k;
+        }
+    }
+    for (int l = 0; i < count; i++, l++) {
+        out[i] = (float)(int32_t)(pcg32(&_state[l], _inc[l]) >> 8) * k;
+    }
+}
+
+/** --------------------------------------------------------
+ * noiseEngineFromName() / createNoiseStream()
+ **/
+noiseEngineKind noiseEngineFromName(const std::string &name)
+{
+    if (name == "none") {
+        return NOISE_NONE;
+    }
+    if (name == "pcg") {
+        return NOISE_PCG;
+    }
+    return NOISE_XORSHIFT;
+}
+
+NoiseStream *createNoiseStream(noiseEngineKind kind, uint64_t seed, uint64_t stream)
+{
+    switch (kind) {
+        case NOISE_XORSHIFT:
+            return new XorShiftNoise(seed, stream);
+        case NOISE_PCG:
+            return new PcgNoise(seed, stream);
+        default:
+            return NULL;
+    }
+}
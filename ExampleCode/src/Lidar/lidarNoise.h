@@ -0,0 +1,83 @@
+/** ------------------------------------------------------------------------
+ * lidarNoise.h
+ * Pseudo-random position noise for the LiDAR point cloud generator.
+ * Each NoiseStream is an independent generator owned by one thread, so
+ * no locking is needed (unlike rand()), and a given seed and stream id
+ * always produce the same sequence, which makes the generated point
+ * clouds reproducible.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarNoise_h
+#define lidarNoise_h
+
+#include <stdint.h>
+#include <string>
+
+#define NOISE_LANES     (8)     // independent generators interleaved per stream
+
+typedef enum {
+    NOISE_NONE = 0,     // no noise
+    NOISE_XORSHIFT,     // xorshift32, one per lane
+    NOISE_PCG           // PCG32 (XSH-RR), one per lane
+} noiseEngineKind;
+
+class NoiseStream {
+
+public:
+    virtual ~NoiseStream() {}
+
+    // restart the sequence for this seed and stream id
+    virtual void seed(uint64_t seed, uint64_t stream) = 0;
+
+    // fill out[0..count-1] with uniform values in [0, scale).
+    // Consecutive values come from different lanes, so the loop
+    // over lanes has no dependency chain and vectorizes.
+    virtual void fill(float *out, int count, float scale) = 0;
+};
+
+class XorShiftNoise : public NoiseStream {
+
+private:
+    uint32_t _state[NOISE_LANES];
+
+public:
+    XorShiftNoise(uint64_t seed, uint64_t stream);
+    virtual void seed(uint64_t seed, uint64_t stream);
+    virtual void fill(float *out, int count, float scale);
+};
+
+class PcgNoise : public NoiseStream {
+
+private:
+    uint64_t _state[NOISE_LANES];
+    uint64_t _inc[NOISE_LANES];
+
+public:
+    PcgNoise(uint64_t seed, uint64_t stream);
+    virtual void seed(uint64_t seed, uint64_t stream);
+    virtual void fill(float *out, int count, float scale);
+};
+
+/** --------------------------------------------------------
+ * noiseEngineFromName()
+ * "none", "xorshift" or "pcg" (as set in the .properties file).
+ * Empty or unknown names select xorshift.
+ **/
+noiseEngineKind noiseEngineFromName(const std::string &name);
+
+/** --------------------------------------------------------
+ * createNoiseStream()
+ * returns a new stream of the requested kind (caller deletes it),
+ * or NULL for NOISE_NONE.
+ **/
+NoiseStream *createNoiseStream(noiseEngineKind kind, uint64_t seed, uint64_t stream);
+
+#endif  // ndef lidarNoise_h
@@ -0,0 +1,121 @@
+/** ------------------------------------------------------------------------
+ * lidarPipeline.cxx
+ * Frame pipeline for the LiDAR publisher (sample slot ring and
+ * deadline timer).
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <thread>
+#include "lidarPipeline.h"
+
+/** --------------------------------------------------------
+ * FrameRing
+ **/
+FrameRing::FrameRing(int slots) :
+    _renderNext(0), _publishNext(0), _requests(0), _stop(false)
+{
+    if (slots < FRAME_SLOTS_MIN) {
+        slots = FRAME_SLOTS_MIN;
+    }
+    if (slots > FRAME_SLOTS_MAX) {
+        slots = FRAME_SLOTS_MAX;
+    }
+    _state.assign(slots, SLOT_FREE);
+}
+
+int FrameRing::beginRender(void)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    while (!_stop && ((_requests == 0) || (_state[_renderNext] != SLOT_FREE))) {
+        _cv.wait(lock);
+    }
+    if (_stop) {
+        return -1;
+    }
+    int slot = _renderNext;
+    _state[slot] = SLOT_RENDERING;
+    _renderNext = (_renderNext + 1) % (int)_state.size();
+    _requests--;
+    return slot;
+}
+
+void FrameRing::endRender(int slot)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _state[slot] = SLOT_READY;
+    }
+    _cv.notify_all();
+}
+
+void FrameRing::requestFrame(void)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _requests++;
+    }
+    _cv.notify_all();
+}
+
+int FrameRing::beginPublish(void)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    while (!_stop && (_state[_publishNext] != SLOT_READY)) {
+        _cv.wait(lock);
+    }
+    if (_stop) {
+        return -1;
+    }
+    int slot = _publishNext;
+    _state[slot] = SLOT_PUBLISHING;
+    _publishNext = (_publishNext + 1) % (int)_state.size();
+    return slot;
+}
+
+void FrameRing::endPublish(int slot)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _state[slot] = SLOT_FREE;
+    }
+    _cv.notify_all();
+}
+
+void FrameRing::stop(void)
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+    _cv.notify_all();
+}
+
+/** --------------------------------------------------------
+ * DeadlineTimer
+ **/
+DeadlineTimer::DeadlineTimer(long periodMs) :
+    _period(std::chrono::milliseconds(periodMs)),
+    _next(std::chrono::steady_clock::now())
+{
+}
+
+int DeadlineTimer::wait(void)
+{
+    int skipped = 0;
+    _next += _period;
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+    if ((_period.count() > 0) && ((now - _next) >= _period)) {
+        // late by a period or more: drop the missed ticks, keep the phase
+        skipped = (int)((now - _next) / _period);
+        _next += skipped * _period;
+    }
+    std::this_thread::sleep_until(_next);
+    return skipped;
+}
@@ -0,0 +1,92 @@
+/** ------------------------------------------------------------------------
+ * lidarPipeline.h
+ * Frame pipeline for the LiDAR publisher: a small ring of sample slots
+ * shared by a render thread and the publishing thread, so frame N+1 is
+ * rendered while frame N is written, and a deadline timer that keeps
+ * the publish rate at the configured period.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarPipeline_h
+#define lidarPipeline_h
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#define FRAME_SLOTS_MIN     (2)
+#define FRAME_SLOTS_MAX     (3)
+
+/** --------------------------------------------------------
+ * FrameRing
+ * Slots are used in order: the renderer fills slot 0, 1, 2, ... and
+ * the publisher sends them in the same order.  The publisher asks for
+ * each frame with requestFrame(), so rendering runs at most one frame
+ * ahead of what was asked for.
+ **/
+class FrameRing {
+
+private:
+    typedef enum {
+        SLOT_FREE = 0,
+        SLOT_RENDERING,
+        SLOT_READY,
+        SLOT_PUBLISHING
+    } slotState;
+
+    std::mutex              _lock;
+    std::condition_variable _cv;
+    std::vector<slotState>  _state;
+    int                     _renderNext;    // next slot to render
+    int                     _publishNext;   // next slot to publish
+    int                     _requests;      // frames asked for, not yet started
+    bool                    _stop;
+
+public:
+    // 'slots' is clamped to FRAME_SLOTS_MIN..FRAME_SLOTS_MAX
+    FrameRing(int slots);
+
+    int slotCount(void) const { return (int)_state.size(); }
+
+    // render thread: wait for a request and a free slot (-1 when stopped)
+    int  beginRender(void);
+    void endRender(int slot);
+
+    // publishing thread
+    void requestFrame(void);
+    int  beginPublish(void);    // wait for the next rendered slot (-1 when stopped)
+    void endPublish(int slot);
+
+    // wake up and stop both sides
+    void stop(void);
+};
+
+/** --------------------------------------------------------
+ * DeadlineTimer
+ * Sleeps until absolute deadlines start + k * period, so time spent
+ * rendering and writing doesn't add up to drift.  If a deadline was
+ * already missed by more than a period the missed ticks are skipped
+ * (rather than sent back-to-back) and the phase is kept.
+ **/
+class DeadlineTimer {
+
+private:
+    std::chrono::steady_clock::duration     _period;
+    std::chrono::steady_clock::time_point   _next;
+
+public:
+    DeadlineTimer(long periodMs);
+
+    // sleep until the next deadline; returns the number of periods skipped
+    int wait(void);
+};
+
+#endif  // ndef lidarPipeline_h
@@ -0,0 +1,117 @@
+/** ------------------------------------------------------------------------
+ * lidarRender.cxx
+ * Fixed pool of worker threads for rendering the LiDAR point cloud.
+ *
+ * Tiles are handed out from an atomic counter, so faster threads simply
+ * take more tiles.  run() is the frame barrier: it returns only when all
+ * tiles are done and no worker is still inside the frame, so the caller
+ * can publish the sample right away and post the next frame safely.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <stddef.h>
+#include "lidarRender.h"
+
+RenderPool::RenderPool(int threads) :
+    _fn(NULL), _arg(NULL), _tileCount(0), _nextTile(0),
+    _tilesDone(0), _active(0), _frame(0), _stop(false)
+{
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+    }
+    // the thread calling run() is one of the renderers
+    for (int i = 1; i < threads; i++) {
+        _threads.push_back(std::thread(&RenderPool::worker, this));
+    }
+}
+
+RenderPool::~RenderPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+    _startCv.notify_all();
+    for (size_t i = 0; i < _threads.size(); i++) {
+        _threads[i].join();
+    }
+}
+
+/** --------------------------------------------------------
+ * runTiles()
+ * render tiles until there are none left; returns how many were rendered
+ **/
+int RenderPool::runTiles(void)
+{
+    int done = 0;
+    int tile;
+    while ((tile = _nextTile.fetch_add(1)) < _tileCount) {
+        _fn(tile, _arg);
+        done++;
+    }
+    return done;
+}
+
+/** --------------------------------------------------------
+ * worker()
+ * wait for a frame, help render it, repeat
+ **/
+void RenderPool::worker(void)
+{
+    unsigned int lastFrame = 0;
+    std::unique_lock<std::mutex> lock(_lock);
+    while (1) {
+        while (!_stop && (_frame == lastFrame)) {
+            _startCv.wait(lock);
+        }
+        if (_stop) {
+            return;
+        }
+        lastFrame = _frame;
+        _active++;
+        lock.unlock();
+
+        int done = runTiles();
+
+        lock.lock();
+        _tilesDone += done;
+        _active--;
+        _doneCv.notify_all();
+    }
+}
+
+/** --------------------------------------------------------
+ * run()
+ **/
+void RenderPool::run(int tileCount, renderTileFn fn, void *arg)
+{
+    std::unique_lock<std::mutex> lock(_lock);
+    // a worker that woke up too late for the last frame may still be
+    // on its way out; the frame parameters can't change under it.
+    while (_active != 0) {
+        _doneCv.wait(lock);
+    }
+    _fn = fn;
+    _arg = arg;
+    _tileCount = tileCount;
+    _nextTile = 0;
+    _tilesDone = 0;
+    _frame++;
+    lock.unlock();
+    _startCv.notify_all();
+
+    int done = runTiles();
+
+    lock.lock();
+    _tilesDone += done;
+    while ((_tilesDone < _tileCount) || (_active != 0)) {
+        _doneCv.wait(lock);
+    }
+}
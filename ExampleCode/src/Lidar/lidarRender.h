@@ -0,0 +1,59 @@
+/** ------------------------------------------------------------------------
+ * lidarRender.h
+ * Fixed pool of worker threads for rendering the LiDAR point cloud.
+ * A frame is split into tiles (ranges of scan columns); run() hands the
+ * tiles out to the workers and to the calling thread, and returns once
+ * every tile of the frame has been rendered.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarRender_h
+#define lidarRender_h
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// renders one tile of the current frame
+typedef void (*renderTileFn)(int tile, void *arg);
+
+class RenderPool {
+
+private:
+    std::vector<std::thread> _threads;
+    std::mutex              _lock;
+    std::condition_variable _startCv;   // a new frame was posted (or stop)
+    std::condition_variable _doneCv;    // a worker left the frame
+    renderTileFn            _fn;
+    void                    *_arg;
+    int                     _tileCount;
+    std::atomic<int>        _nextTile;  // next tile to hand out
+    int                     _tilesDone;
+    int                     _active;    // workers inside runTiles()
+    unsigned int            _frame;     // incremented for every run()
+    bool                    _stop;
+
+    void worker(void);
+    int  runTiles(void);
+
+public:
+    // 'threads' includes the thread calling run(); 0 uses one per core
+    RenderPool(int threads);
+    ~RenderPool();
+
+    int threadCount(void) const { return (int)_threads.size() + 1; }
+
+    // call fn(tile, arg) for tile 0..tileCount-1, return when all are done
+    void run(int tileCount, renderTileFn fn, void *arg);
+};
+
+#endif  // ndef lidarRender_h
@@ -0,0 +1,182 @@
+/** ------------------------------------------------------------------------
+ * lidarShapes.cxx
+ * Table of the shapes seen by the LiDAR (triple-buffered).
+ *
+ * Buffer indexes move between three owners: the writer's back buffer,
+ * the reader's front buffer, and the middle one held by an atomic.  The
+ * writer fills its back buffer and swaps it into the middle; the reader
+ * swaps its front buffer with the middle only when the middle holds a
+ * version it hasn't seen.  Each side only touches the buffer it owns,
+ * so there are no torn reads and no locks.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <string.h>
+#include "lidarShapes.h"
+
+#define KEYMAP_BUCKETS_MIN  (16)
+#define KEYMAP_SEED_TRIES   (1000)  // give up on a perfect seed after this many
+
+// the standard Shapes colors, in sColor order
+static const struct {
+    const char  *key;
+    uint32_t    color;      // RGB rendered for it
+} builtinColors[SC_BUILTIN] = {
+    { "BLUE",       0xff },
+    { "GREEN",      0xff00 },
+    { "RED",        0xff0000 },
+    { "YELLOW",     0xffff00 },
+    { "CYAN",       0x00ffff },
+    { "MAGENTA",    0xff00ff },
+    { "PURPLE",     0x800080 },
+    { "ORANGE",     0xff5733 }
+};
+
+/** --------------------------------------------------------
+ * ShapeKeyMap
+ **/
+ShapeKeyMap::ShapeKeyMap() :
+    _mask(0), _seed(0)
+{
+    resize(KEYMAP_BUCKETS_MIN);
+    for (int i = 0; i < SC_BUILTIN; i++) {
+        insert(builtinColors[i].key);
+    }
+}
+
+/** --------------------------------------------------------
+ * hashKey()
+ * FNV-1a from a seeded offset, then a final mix so that the low
+ * bits (the bucket) depend on all bits of the key and seed
+ **/
+uint32_t ShapeKeyMap::hashKey(const char *key, uint32_t seed)
+{
+    uint32_t h = 2166136261u ^ (seed * 0x9E3779B9u);
+    for (; *key != '\0'; key++) {
+        h ^= (uint8_t)*key;
+        h *= 16777619u;
+    }
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+void ShapeKeyMap::place(uint32_t hash, int slot)
+{
+    uint32_t b = hash & _mask;
+    while (_buckets[b].slot >= 0) {
+        b = (b + 1) & _mask;
+    }
+    _buckets[b].hash = hash;
+    _buckets[b].slot = slot;
+}
+
+/** --------------------------------------------------------
+ * resize()
+ * rebuild with 'buckets' buckets (a power of 2), first choosing
+ * a seed that puts each standard color in a bucket of its own
+ **/
+void ShapeKeyMap::resize(size_t buckets)
+{
+    std::vector<bool> used;
+    bool perfect = false;
+    for (int tries = 0; !perfect && (tries < KEYMAP_SEED_TRIES); tries++) {
+        _seed++;
+        perfect = true;
+        used.assign(buckets, false);
+        for (int i = 0; (i < SC_BUILTIN) && perfect; i++) {
+            uint32_t b = hashKey(builtinColors[i].key, _seed) & (uint32_t)(buckets - 1);
+            perfect = !used[b];
+            used[b] = true;
+        }
+    }
+
+    bucket empty = { 0, -1 };
+    _buckets.assign(buckets, empty);
+    _mask = (uint32_t)(buckets - 1);
+    for (size_t i = 0; i < _keys.size(); i++) {
+        place(hashKey(_keys[i].c_str(), _seed), (int)i);
+    }
+}
+
+int ShapeKeyMap::find(const char *key) const
+{
+    uint32_t hash = hashKey(key, _seed);
+    uint32_t b = hash & _mask;
+    while (_buckets[b].slot >= 0) {
+        if ((_buckets[b].hash == hash) && (strcmp(_keys[_buckets[b].slot].c_str(), key) == 0)) {
+            return _buckets[b].slot;
+        }
+        b = (b + 1) & _mask;
+    }
+    return -1;
+}
+
+int ShapeKeyMap::insert(const char *key)
+{
+    if (((_keys.size() + 1) * 2) > _buckets.size()) {
+        _keys.push_back(key);
+        resize(_buckets.size() * 2);
+    }
+    else {
+        _keys.push_back(key);
+        place(hashKey(key, _seed), (int)_keys.size() - 1);
+    }
+    return (int)_keys.size() - 1;
+}
+
+/** --------------------------------------------------------
+ * ShapeTable
+ **/
+ShapeTable::ShapeTable() :
+    _back(0), _front(1), _middle(2)
+{
+    shapeType empty = { 0 };
+    _master.assign(SC_BUILTIN, empty);
+    for (int i = 0; i < SC_BUILTIN; i++) {
+        _master[i].color = builtinColors[i].color;
+    }
+    for (int i = 0; i < 3; i++) {
+        _buf[i] = _master;
+    }
+}
+
+int ShapeTable::slot(const char *color)
+{
+    int s = _keys.find(color);
+    if ((s < 0) && (_keys.size() < SHAPE_SLOTS_MAX)) {
+        s = _keys.insert(color);
+        // a color of its own, bright enough to tell from the grey
+        // background and ground points
+        shapeType shape = { 0 };
+        shape.color = 0x808080 | (ShapeKeyMap::hashKey(color, 0) & 0x7f7f7f);
+        _master.push_back(shape);
+    }
+    return s;
+}
+
+void ShapeTable::publish(void)
+{
+    _buf[_back] = _master;
+    int old = _middle.exchange(_back | NEW_VERSION, std::memory_order_acq_rel);
+    _back = old & ~NEW_VERSION;
+}
+
+const std::vector<shapeType> &ShapeTable::snapshot(void)
+{
+    if (_middle.load(std::memory_order_relaxed) & NEW_VERSION) {
+        int latest = _middle.exchange(_front, std::memory_order_acq_rel);
+        _front = latest & ~NEW_VERSION;
+    }
+    return _buf[_front];
+}
@@ -0,0 +1,107 @@
+/** ------------------------------------------------------------------------
+ * lidarShapes.h
+ * Table of the shapes (from the Shapes demo) seen by the LiDAR, one slot
+ * per color.  The standard Shapes colors have fixed slots (sColor) and
+ * any other color gets the next free slot the first time it is seen.
+ * The DDS listener thread updates the table and the render thread reads
+ * it; they hand it over through three copies (a "triple buffer"), so the
+ * renderer always gets a complete, consistent version and neither side
+ * ever waits for the other.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarShapes_h
+#define lidarShapes_h
+
+#include <stdint.h>
+#include <atomic>
+#include <string>
+#include <vector>
+
+#define SHAPE_SLOTS_MAX     (4096)  // most shapes (distinct colors) tracked
+
+typedef struct {
+    uint32_t    color;
+    int32_t     x;
+    int32_t     y;
+    int32_t     shapesize;
+} shapeType;
+
+// slots of the standard Shapes colors; other colors follow these
+enum sColor {
+    SC_BLUE = 0, SC_GREEN, SC_RED, SC_YELLOW, SC_CYAN, SC_MAGENTA, SC_PURPLE, SC_ORANGE, SC_BUILTIN
+};
+
+/** --------------------------------------------------------
+ * ShapeKeyMap
+ * color key --> slot, as an open-addressing hash table.  The hash seed
+ * is chosen so the standard colors all land in different buckets (a
+ * perfect hash for them): looking one up is one hash, one compare of
+ * the stored hash, and one strcmp to confirm.  Other colors use linear
+ * probing, and the table doubles when it is half full.
+ **/
+class ShapeKeyMap {
+
+private:
+    typedef struct {
+        uint32_t    hash;
+        int32_t     slot;       // -1: empty
+    } bucket;
+
+    std::vector<bucket>         _buckets;
+    std::vector<std::string>    _keys;      // key of each slot
+    uint32_t                    _mask;      // _buckets.size() - 1
+    uint32_t                    _seed;
+
+    void place(uint32_t hash, int slot);
+    void resize(size_t buckets);
+
+public:
+    ShapeKeyMap();
+
+    int find(const char *key) const;        // -1 if not there
+    int insert(const char *key);            // returns the new slot
+    int size(void) const { return (int)_keys.size(); }
+
+    static uint32_t hashKey(const char *key, uint32_t seed);
+};
+
+class ShapeTable {
+
+private:
+    static const int NEW_VERSION = 0x4;    // flag in _middle: not yet seen by the reader
+
+    ShapeKeyMap             _keys;      // writer only
+    std::vector<shapeType>  _master;    // writer's working copy
+    std::vector<shapeType>  _buf[3];
+    int                     _back;      // owned by the writer
+    int                     _front;     // owned by the reader
+    alignas(64) std::atomic<int> _middle;   // latest published version (+ NEW_VERSION)
+
+public:
+    ShapeTable();
+
+    // -- writer (listener thread) --
+    // slot of the shape with this color; a new color gets a new slot,
+    // or -1 when SHAPE_SLOTS_MAX are in use
+    int slot(const char *color);
+    // the working copy; changes are not seen until publish().
+    // slot() may add to it, so get this after calling slot().
+    shapeType *edit(void) { return &_master[0]; }
+    // make the working copy the latest version
+    void publish(void);
+
+    // -- reader (render thread) --
+    // the latest published version; it stays valid and unchanged
+    // until the next call to snapshot()
+    const std::vector<shapeType> &snapshot(void);
+};
+
+#endif  // ndef lidarShapes_h
@@ -0,0 +1,146 @@
+/** ------------------------------------------------------------------------
+ * fusionSync.cxx
+ * Time synchronization of the sensor data for fusion.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include "fusionSync.h"
+
+FusionSync::FusionSync(int depth, int64_t tolerance, uint64_t maxWait) :
+    _vision(depth), _lidar(depth), _tolerance(tolerance), _maxWait(maxWait), _lidarEarly(false),
+    _paired(0), _unpaired(0), _dropped(0), _lidarAlone(0)
+{
+}
+
+visionFrame &FusionSync::addVision(int64_t stamp, DDS_Long id, uint64_t tArrival)
+{
+    if (_vision.full()) {
+        _dropped++;
+    }
+    visionFrame &frame = _vision.push(stamp);
+    frame.id = id;
+    frame.tArrival = tArrival;
+    frame.objects.clear();
+    return frame;
+}
+
+void FusionSync::addLidar(int64_t stamp, uint64_t tArrival, lidarFrame &frame)
+{
+    frame.tArrival = tArrival;
+    frame.fused = false;
+    std::lock_guard<std::mutex> guard(_lidarLock);
+    std::swap(_lidar.push(stamp), frame);
+}
+
+bool FusionSync::next(uint64_t tNow, fusedSet &out)
+{
+    return nextVision(tNow, out) || nextLidar(tNow, out);
+}
+
+bool FusionSync::nextVision(uint64_t tNow, fusedSet &out)
+{
+    if (_vision.size() == 0) {
+        return false;
+    }
+    int64_t stamp = _vision.stamp(0);
+    bool expired = ((tNow - _vision.at(0).tArrival) >= _maxWait);
+    {
+        std::lock_guard<std::mutex> guard(_lidarLock);
+        int n = (int)_lidar.size();
+        // a later sweep would be further away once one is at or after the frame
+        if (!expired && ((n == 0) || (_lidar.stamp(n - 1) < stamp))) {
+            return false;
+        }
+        int nearest = _lidar.nearest(stamp);
+        out.lidar = NULL;
+        out.lidarObjects = false;
+        out.skew = 0;
+        if (nearest >= 0) {
+            int64_t skew = _lidar.stamp(nearest) - stamp;
+            if ((skew <= _tolerance) && (-skew <= _tolerance)) {
+                lidarFrame &lidar = _lidar.at(nearest);
+                out.lidarObjects = !lidar.fused;
+                lidar.fused = true;
+                _outLidar = lidar;
+                out.lidar = &_outLidar;
+                out.skew = skew;
+            }
+        }
+    }
+    std::swap(_outVision, _vision.at(0));
+    _vision.popFront();
+    out.stamp = stamp;
+    out.vision = &_outVision;
+    if (out.lidar != NULL) {
+        _paired++;
+    }
+    else {
+        _unpaired++;
+    }
+    return true;
+}
+
+/** --------------------------------------------------------
+ * lidarWanted()
+ * true if a waiting vision frame would be paired with LiDAR frame
+ * 'lidar' (with _lidarLock held)
+ **/
+bool FusionSync::lidarWanted(size_t lidar) const
+{
+    for (size_t v = 0; v < _vision.size(); v++) {
+        int64_t stamp = _vision.stamp(v);
+        int64_t skew = _lidar.stamp(lidar) - stamp;
+        if ((_lidar.nearest(stamp) == (int)lidar) && (skew <= _tolerance) && (-skew <= _tolerance)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FusionSync::nextLidar(uint64_t tNow, fusedSet &out)
+{
+    std::lock_guard<std::mutex> guard(_lidarLock);
+    for (size_t i = 0; i < _lidar.size(); i++) {
+        lidarFrame &lidar = _lidar.at(i);
+        if (!lidar.fused && (((tNow - lidar.tArrival) >= _maxWait)
+            || (_lidarEarly && !lidarWanted(i)))) {
+            lidar.fused = true;
+            _outLidar = lidar;
+            out.stamp = _lidar.stamp(i);
+            out.vision = NULL;
+            out.lidar = &_outLidar;
+            out.lidarObjects = true;
+            out.skew = 0;
+            _lidarAlone++;
+            return true;
+        }
+    }
+    return false;
+}
+
+uint64_t FusionSync::waitTime(uint64_t tNow) const
+{
+    uint64_t tRelease = UINT64_MAX;
+    if (_vision.size() > 0) {
+        tRelease = _vision.at(0).tArrival + _maxWait;
+    }
+    {
+        std::lock_guard<std::mutex> guard(_lidarLock);
+        for (size_t i = 0; i < _lidar.size(); i++) {
+            if (!_lidar.at(i).fused && ((_lidar.at(i).tArrival + _maxWait) < tRelease)) {
+                tRelease = _lidar.at(i).tArrival + _maxWait;
+            }
+        }
+    }
+    if (tRelease == UINT64_MAX) {
+        return UINT64_MAX;
+    }
+    return (tRelease > tNow) ? (tRelease - tNow) : 0;
+}
@@ -0,0 +1,196 @@
+/** ------------------------------------------------------------------------
+ * fusionSync.h
+ * Time synchronization of the sensor data for fusion.  Each sensor has a
+ * ring buffer of its frames, ordered by source timestamp (the timestamp
+ * of the vision sample, the header stamp of the LiDAR cloud), and an
+ * approximate-time synchronizer pairs each vision frame with the LiDAR
+ * sweep nearest in time, if one is within config.syncTolerance ms.
+ * A vision frame is released once no nearer sweep can come (a sweep at
+ * or after its time has arrived), or after config.syncMaxWait ms without
+ * one, unpaired.  The fused set carries the vision frame's time as its
+ * measurement time.  The objects of a LiDAR frame go with the first
+ * vision frame it is paired with; a LiDAR frame that no vision frame
+ * has been paired with config.syncMaxWait ms after it arrived is
+ * released on its own.  When the LiDAR drives the output
+ * (config.fusionTrigger=lidar), a LiDAR frame is released on its own as
+ * soon as none of the waiting vision frames would be paired with it; a
+ * vision frame that comes later can still be paired with it, without
+ * its objects.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef fusionSync_h
+#define fusionSync_h
+
+#include <stdint.h>
+#include <mutex>
+#include <utility>
+#include <vector>
+#include "automotive.h"
+
+/** --------------------------------------------------------
+ * StampedRing
+ * Ring buffer of up to 'capacity' items kept in source timestamp order
+ * (oldest first).  The slots are reused, so items that own memory (like
+ * a std::vector) do not allocate once the ring has gone round.
+ **/
+template <typename T>
+class StampedRing {
+
+private:
+    std::vector<T>          _items;
+    std::vector<int64_t>    _stamps;
+    size_t                  _first;     // slot of the oldest item
+    size_t                  _count;
+
+    size_t slot(size_t i) const { return (_first + i) % _items.size(); }
+
+public:
+    StampedRing(size_t capacity) :
+        _items(capacity), _stamps(capacity), _first(0), _count(0) {}
+
+    size_t size(void) const { return _count; }
+    bool full(void) const { return _count == _items.size(); }
+
+    // the i-th oldest item and its timestamp
+    T &at(size_t i) { return _items[slot(i)]; }
+    const T &at(size_t i) const { return _items[slot(i)]; }
+    int64_t stamp(size_t i) const { return _stamps[slot(i)]; }
+
+    void popFront(void)
+    {
+        if (_count > 0) {
+            _first = slot(1);
+            _count--;
+        }
+    }
+
+    // a slot for an item with timestamp 'stamp', in its place (usually
+    // last); when the ring is full the oldest item is dropped first
+    T &push(int64_t stamp)
+    {
+        if (full()) {
+            popFront();
+        }
+        size_t i = _count++;
+        _stamps[slot(i)] = stamp;
+        for (; (i > 0) && (_stamps[slot(i - 1)] > stamp); i--) {
+            std::swap(_items[slot(i - 1)], _items[slot(i)]);
+            std::swap(_stamps[slot(i - 1)], _stamps[slot(i)]);
+        }
+        return _items[slot(i)];
+    }
+
+    // index of the item nearest in time to 'stamp', -1 if empty
+    int nearest(int64_t stamp) const
+    {
+        if (_count == 0) {
+            return -1;
+        }
+        size_t lo = 0;
+        size_t hi = _count;
+        while (lo < hi) {       // first item at or after 'stamp'
+            size_t mid = (lo + hi) / 2;
+            if (this->stamp(mid) < stamp) lo = mid + 1;
+            else hi = mid;
+        }
+        if (lo == _count) {
+            return (int)(_count - 1);
+        }
+        if ((lo > 0) && ((stamp - this->stamp(lo - 1)) <= (this->stamp(lo) - stamp))) {
+            return (int)(lo - 1);
+        }
+        return (int)lo;
+    }
+};
+
+typedef struct {
+    DDS_Long        id;             // vision sensor instance
+    uint64_t        tArrival;       // fusionNow() when it was taken
+    std::vector<Vision_VisionObject> objects;
+} visionFrame;
+
+typedef struct {
+    int             bytes;          // of the full cloud
+    uint64_t        tArrival;       // fusionNow() when it was received
+    bool            fused;          // objects released already
+    std::vector<Sensor_SensorObject> objects;
+} lidarFrame;
+
+typedef struct {
+    int64_t             stamp;      // measurement time, ns since the epoch
+    const visionFrame   *vision;    // NULL for a LiDAR frame on its own
+    const lidarFrame    *lidar;     // NULL if unpaired
+    bool                lidarObjects;   // the LiDAR objects are new: fuse them
+    int64_t             skew;       // LiDAR - vision time, ns
+} fusedSet;
+
+/** --------------------------------------------------------
+ * sourceStamp()
+ * a POSIXTimestamp or header stamp as ns since the epoch
+ **/
+inline int64_t sourceStamp(int64_t sec, int64_t nanosec)
+{
+    return (sec * 1000000000) + nanosec;
+}
+
+/** --------------------------------------------------------
+ * FusionSync
+ * The vision frames are added and the fused sets taken by the fusion
+ * loop; the LiDAR frames are added by the LiDAR listener (locked).
+ **/
+class FusionSync {
+
+private:
+    StampedRing<visionFrame>    _vision;
+    StampedRing<lidarFrame>     _lidar;
+    mutable std::mutex          _lidarLock;
+    int64_t                     _tolerance;     // ns
+    uint64_t                    _maxWait;       // ns
+    bool                        _lidarEarly;    // release LiDAR frames no vision frame waits for
+    visionFrame                 _outVision;     // of the last fused set
+    lidarFrame                  _outLidar;
+    uint64_t                    _paired;
+    uint64_t                    _unpaired;
+    uint64_t                    _dropped;       // vision frames pushed out of a full ring
+    uint64_t                    _lidarAlone;    // LiDAR frames released on their own
+
+    bool nextVision(uint64_t tNow, fusedSet &out);
+    bool nextLidar(uint64_t tNow, fusedSet &out);
+    bool lidarWanted(size_t lidar) const;
+
+public:
+    FusionSync(int depth, int64_t tolerance, uint64_t maxWait);
+
+    // release the LiDAR frames that no waiting vision frame would be
+    // paired with right away, not after maxWait
+    void setLidarEarly(bool early) { _lidarEarly = early; }
+
+    // a vision frame, to fill in (objects is empty)
+    visionFrame &addVision(int64_t stamp, DDS_Long id, uint64_t tArrival);
+
+    // a LiDAR frame; its contents are swapped in, 'frame' gets old storage back
+    void addLidar(int64_t stamp, uint64_t tArrival, lidarFrame &frame);
+
+    // the next fused set, if its vision frame (or a LiDAR frame on its own)
+    // can be released at fusionNow() time 'tNow'.  The set is valid until
+    // the next call.
+    bool next(uint64_t tNow, fusedSet &out);
+
+    // ns until a waiting vision or LiDAR frame is released unpaired
+    uint64_t waitTime(uint64_t tNow) const;
+
+    uint64_t paired(void) const { return _paired; }
+    uint64_t unpaired(void) const { return _unpaired; }
+    uint64_t dropped(void) const { return _dropped; }
+    uint64_t lidarAlone(void) const { return _lidarAlone; }
+};
+
+#endif  // ndef fusionSync_h
@@ -0,0 +1,86 @@
+/** ------------------------------------------------------------------------
+ * fusionTrigger.cxx
+ * When sensor fusion publishes its SensorObjectList.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <chrono>
+#include "fusionTrigger.h"
+
+static const char *policyNames[] = { "vision", "lidar", "interval" };
+
+fusionTriggerPolicy fusionTriggerFromName(const std::string &name)
+{
+    for (int i = 0; i < (int)(sizeof(policyNames) / sizeof(policyNames[0])); i++) {
+        if (name == policyNames[i]) {
+            return (fusionTriggerPolicy)i;
+        }
+    }
+    return FUSION_ON_INTERVAL;
+}
+
+const char *fusionTriggerName(fusionTriggerPolicy policy)
+{
+    return policyNames[policy];
+}
+
+uint64_t fusionNow(void)
+{
+    return (uint64_t)std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+/** --------------------------------------------------------
+ * FusionTrigger
+ **/
+FusionTrigger::FusionTrigger(fusionTriggerPolicy policy, uint64_t period, uint64_t minInterval) :
+    _policy(policy), _period(period), _minInterval(minInterval),
+    _tLast(fusionNow()), _tEvent(0), _pending(false)
+{
+}
+
+void FusionTrigger::event(fusionEvent ev, uint64_t tNow)
+{
+    bool triggers = ((_policy == FUSION_ON_VISION) && (ev == FUSION_EVENT_VISION))
+        || ((_policy == FUSION_ON_LIDAR) && (ev == FUSION_EVENT_LIDAR));
+    if (triggers && !_pending) {
+        _pending = true;
+        _tEvent = tNow;
+    }
+}
+
+bool FusionTrigger::due(uint64_t tNow) const
+{
+    if (_policy == FUSION_ON_INTERVAL) {
+        return (tNow - _tLast) >= _period;
+    }
+    return _pending && ((tNow - _tLast) >= _minInterval);
+}
+
+void FusionTrigger::published(uint64_t tNow)
+{
+    _tLast = tNow;
+    _pending = false;
+}
+
+uint64_t FusionTrigger::waitTime(uint64_t tNow) const
+{
+    uint64_t tDue;
+    if (_policy == FUSION_ON_INTERVAL) {
+        tDue = _tLast + _period;
+    }
+    else if (_pending) {
+        tDue = _tLast + _minInterval;
+    }
+    else {
+        return _period;
+    }
+    return (tDue > tNow) ? (tDue - tNow) : 0;
+}
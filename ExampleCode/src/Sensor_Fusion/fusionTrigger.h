@@ -0,0 +1,91 @@
+/** ------------------------------------------------------------------------
+ * fusionTrigger.h
+ * When sensor fusion publishes its SensorObjectList.  The fusion loop
+ * waits on a WaitSet for the sensor data, and publishes according to
+ * config.fusionTrigger in sensor_fusion.properties:
+ *   vision    on each new vision sample
+ *   lidar     on each new LiDAR frame (a full cloud or a complete sweep),
+ *             once the sync releases its objects (see fusionSync.h)
+ *   interval  every config.pubInterval ms
+ * With vision and lidar, config.minInterval (ms) limits the rate: events
+ * that come sooner after the last publish are published together, once
+ * it has passed.  So the output follows the sensor data by the time it
+ * takes to process it, not by the period of a poll.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef fusionTrigger_h
+#define fusionTrigger_h
+
+#include <stdint.h>
+#include <string>
+
+typedef enum {
+    FUSION_ON_VISION = 0,
+    FUSION_ON_LIDAR,
+    FUSION_ON_INTERVAL
+} fusionTriggerPolicy;
+
+typedef enum {
+    FUSION_EVENT_VISION = 0,
+    FUSION_EVENT_LIDAR
+} fusionEvent;
+
+/** --------------------------------------------------------
+ * fusionTriggerFromName()
+ * "vision", "lidar" or "interval"; empty or unknown names select
+ * interval (the publish period of before).
+ **/
+fusionTriggerPolicy fusionTriggerFromName(const std::string &name);
+
+/** --------------------------------------------------------
+ * fusionTriggerName()
+ **/
+const char *fusionTriggerName(fusionTriggerPolicy policy);
+
+/** --------------------------------------------------------
+ * fusionNow()
+ * monotonic time in ns, for the trigger and the fusion latency
+ **/
+uint64_t fusionNow(void);
+
+/** --------------------------------------------------------
+ * FusionTrigger
+ * Decides when to publish.  The fusion loop reports the events with
+ * event(), publishes when due() and then calls published(); it waits at
+ * most waitTime() for the next event.  Times are fusionNow() ns.
+ **/
+class FusionTrigger {
+
+private:
+    fusionTriggerPolicy _policy;
+    uint64_t            _period;        // interval: publish period; others: longest wait
+    uint64_t            _minInterval;   // vision, lidar: shortest time between publishes
+    uint64_t            _tLast;         // last publish
+    uint64_t            _tEvent;        // first event not published yet
+    bool                _pending;
+
+public:
+    FusionTrigger(fusionTriggerPolicy policy, uint64_t period, uint64_t minInterval);
+
+    void event(fusionEvent ev, uint64_t tNow);
+    bool due(uint64_t tNow) const;
+    void published(uint64_t tNow);
+
+    // ns to wait for the next event before due() has to be checked again
+    uint64_t waitTime(uint64_t tNow) const;
+
+    // the first event that the next publish is for (0: none)
+    uint64_t eventTime(void) const { return _pending ? _tEvent : 0; }
+
+    fusionTriggerPolicy policy(void) const { return _policy; }
+};
+
+#endif  // ndef fusionTrigger_h
@@ -0,0 +1,669 @@
+/** ------------------------------------------------------------------------
+ * lidarObjects.cxx
+ * Objects from the LiDAR point cloud, for sensor fusion.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+#include <thread>
+#include "lidarObjects.h"
+#include "taskPool.h"
+#include "../Lidar/lidarFormat.h"
+
+#define GRID_EMPTY      (~0ull)
+#define GRID_BIAS       (1 << 20)       // grid coordinates are 21-bit, biased
+#define GRID_MASK       ((1ull << 21) - 1)
+
+void cloudLayoutReset(cloudLayout *layout, int stride, float scale)
+{
+    layout->stride = stride;
+    layout->offset[0] = layout->offset[1] = layout->offset[2] = -1;
+    layout->datatype = 0;
+    layout->scale = scale;
+}
+
+void cloudLayoutField(cloudLayout *layout, const char *name, uint32_t offset, uint8_t datatype)
+{
+    static const char *names[3] = { "x", "y", "z" };
+    for (int i = 0; i < 3; i++) {
+        if ((name != NULL) && (strcmp(name, names[i]) == 0)) {
+            layout->offset[i] = (int)offset;
+            if ((i > 0) && (datatype != layout->datatype)) {
+                layout->datatype = 0;   // mixed types: not supported
+                layout->offset[i] = -1;
+            }
+            else {
+                layout->datatype = datatype;
+            }
+        }
+    }
+}
+
+bool cloudLayoutValid(const cloudLayout *layout)
+{
+    int bytes;
+    switch (layout->datatype) {
+    case PCLOUD_DATATYPE_FLOAT32:
+        bytes = 4;
+        break;
+    case PCLOUD_DATATYPE_FLOAT16:
+    case PCLOUD_DATATYPE_INT16:
+        bytes = 2;
+        break;
+    default:
+        return false;
+    }
+    for (int i = 0; i < 3; i++) {
+        if ((layout->offset[i] < 0) || ((layout->offset[i] + bytes) > layout->stride)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/** --------------------------------------------------------
+ * grid keys: the 21-bit x, y, z grid coordinates in one word, and its
+ * hash, for open addressing (linear probing) in a power of 2 table
+ **/
+static inline uint64_t gridKey(int ix, int iy, int iz)
+{
+    return ((uint64_t)((ix + GRID_BIAS) & GRID_MASK) << 42)
+        | ((uint64_t)((iy + GRID_BIAS) & GRID_MASK) << 21)
+        | (uint64_t)((iz + GRID_BIAS) & GRID_MASK);
+}
+
+static inline size_t gridHash(uint64_t key, size_t mask)
+{
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdull;
+    key ^= key >> 33;
+    return (size_t)key & mask;
+}
+
+// the slot of 'key', added as 'next' if it is not there yet
+static inline int gridSlot(std::vector<uint64_t> &keys, std::vector<int> &slots,
+    uint64_t key, int next)
+{
+    size_t mask = keys.size() - 1;
+    for (size_t h = gridHash(key, mask); ; h = (h + 1) & mask) {
+        if (keys[h] == key) {
+            return slots[h];
+        }
+        if (keys[h] == GRID_EMPTY) {
+            keys[h] = key;
+            slots[h] = next;
+            return next;
+        }
+    }
+}
+
+// the slot of 'key', or -1
+static inline int gridFind(const std::vector<uint64_t> &keys, const std::vector<int> &slots,
+    uint64_t key)
+{
+    size_t mask = keys.size() - 1;
+    for (size_t h = gridHash(key, mask); ; h = (h + 1) & mask) {
+        if (keys[h] == key) {
+            return slots[h];
+        }
+        if (keys[h] == GRID_EMPTY) {
+            return -1;
+        }
+    }
+}
+
+// empty table of at least twice 'count' entries
+static void gridClear(std::vector<uint64_t> &keys, std::vector<int> &slots, int count)
+{
+    size_t size = 64;
+    while (size < (size_t)count * 2) size <<= 1;
+    if (keys.size() < size) {
+        keys.resize(size);
+        slots.resize(size);
+    }
+    std::fill(keys.begin(), keys.end(), GRID_EMPTY);
+}
+
+static inline int findRoot(std::vector<int> &parent, int v)
+{
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];      // path halving
+        v = parent[v];
+    }
+    return v;
+}
+
+static inline int floorDiv(int a, int b)
+{
+    return (a >= 0) ? (a / b) : -(((-a) + b - 1) / b);
+}
+
+static inline int floorMod(int a, int b)
+{
+    return a - (floorDiv(a, b) * b);
+}
+
+static bool edgeBefore(const lidarEdgeVoxel &a, const lidarEdgeVoxel &b)
+{
+    if (a.slab != b.slab) {
+        return a.slab < b.slab;
+    }
+    if (a.high != b.high) {
+        return a.high < b.high;
+    }
+    return a.y < b.y;
+}
+
+/** --------------------------------------------------------
+ * LidarObjectExtractor
+ * The grid is cut into slabs of x, SLAB_DISTANCES cluster distances
+ * wide (a whole number of voxels, so that a voxel is in one slab), dealt
+ * out to the partitions in turn: partition = slab mod partitions.  Two
+ * slabs of a partition are never next to each other, so a partition is
+ * clustered on its own, and only the voxels within a cluster distance of
+ * a slab edge can join clusters of two partitions.
+ **/
+#define SLAB_DISTANCES  (8)
+#define TASKS_PER_THREAD (4)            // partitions (and chunks) per thread
+
+LidarObjectExtractor::LidarObjectExtractor() :
+    _pool(NULL), _partitionCount(0), _chunkCount(0), _slabVoxels(1),
+    _data(NULL), _count(0), _layout(NULL), _points(0), _voxels(0), _clusters(0)
+{
+    lidarObjectConfig config;
+    config.groundHeight = 0.1f;
+    config.maxRange = 0;
+    config.voxelSize = 0.2f;
+    config.clusterDistance = 0.5f;
+    config.clusterMinPoints = 5;
+    config.threads = 1;
+    configure(&config);
+}
+
+LidarObjectExtractor::~LidarObjectExtractor()
+{
+    delete _pool;
+}
+
+void LidarObjectExtractor::configure(const lidarObjectConfig *config)
+{
+    _config = *config;
+    int threads = _config.threads;
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+        if (threads <= 0) {
+            threads = 1;
+        }
+    }
+    if ((_pool == NULL) || (_pool->threadCount() != threads)) {
+        delete _pool;
+        _pool = new TaskPool(threads);
+    }
+    // a few tasks per thread, so that stealing can even out the load
+    _partitionCount = (threads > 1) ? (threads * TASKS_PER_THREAD) : 1;
+    _chunkCount = _partitionCount;
+    _partitions.resize(_partitionCount);
+    _bins.resize((size_t)_chunkCount * _partitionCount);
+    _links.resize(threads);
+    _clusterBase.resize((size_t)_partitionCount + 1);
+    if ((_config.voxelSize > 0) && (_config.clusterDistance > 0)) {
+        _slabVoxels = std::max(1,
+            (int)ceilf((SLAB_DISTANCES * _config.clusterDistance) / _config.voxelSize));
+    }
+}
+
+int LidarObjectExtractor::threads(void) const
+{
+    return _pool->threadCount();
+}
+
+void LidarObjectExtractor::decodeTask(int chunk, int /*thread*/, void *arg)
+{
+    ((LidarObjectExtractor *)arg)->decode(chunk);
+}
+
+void LidarObjectExtractor::partitionTask(int partition, int /*thread*/, void *arg)
+{
+    LidarObjectExtractor *self = (LidarObjectExtractor *)arg;
+    lidarPartition *part = &self->_partitions[partition];
+    self->voxelize(partition);
+    self->cluster(part);
+    if (self->_partitionCount > 1) {
+        self->findEdges(part);
+    }
+}
+
+void LidarObjectExtractor::edgeTask(int partition, int thread, void *arg)
+{
+    LidarObjectExtractor *self = (LidarObjectExtractor *)arg;
+    self->joinEdges(partition, self->_links[thread]);
+}
+
+/** --------------------------------------------------------
+ * decode()
+ * the points of a chunk (a range of the frame) that are kept, into the
+ * bins of the chunk, by partition
+ **/
+void LidarObjectExtractor::decode(int chunk)
+{
+    const cloudLayout *layout = _layout;
+    int first = (int)(((long long)_count * chunk) / _chunkCount);
+    int last = (int)(((long long)_count * (chunk + 1)) / _chunkCount);
+    const uint8_t *data = &_data[(size_t)first * layout->stride];
+    std::vector<float> *bins = &_bins[(size_t)chunk * _partitionCount];
+    for (int part = 0; part < _partitionCount; part++) {
+        bins[part].clear();
+    }
+
+    float maxRange2 = _config.maxRange * _config.maxRange;
+    float inv = 1.0f / _config.voxelSize;
+    for (int i = first; i < last; i++, data += layout->stride) {
+        float p[3];
+        for (int c = 0; c < 3; c++) {
+            const uint8_t *field = &data[layout->offset[c]];
+            if (layout->datatype == PCLOUD_DATATYPE_FLOAT32) {
+                memcpy(&p[c], field, sizeof(float));
+            }
+            else if (layout->datatype == PCLOUD_DATATYPE_FLOAT16) {
+                uint16_t h;
+                memcpy(&h, field, sizeof(h));
+                p[c] = halfToFloat(h);
+            }
+            else {
+                int16_t v;
+                memcpy(&v, field, sizeof(v));
+                p[c] = v * layout->scale;
+            }
+        }
+        // ground (and no return), too far, or not a number
+        if (!(p[2] >= _config.groundHeight)) {
+            continue;
+        }
+        if ((maxRange2 > 0) && (((p[0] * p[0]) + (p[1] * p[1])) > maxRange2)) {
+            continue;
+        }
+        if (!std::isfinite(p[0]) || !std::isfinite(p[1]) || !std::isfinite(p[2])) {
+            continue;
+        }
+        int slab = floorDiv((int)floorf(p[0] * inv), _slabVoxels);
+        std::vector<float> &bin = bins[floorMod(slab, _partitionCount)];
+        bin.insert(bin.end(), p, p + 3);
+    }
+}
+
+/** --------------------------------------------------------
+ * voxelize()
+ * the points of a partition, from the bins of all the chunks (in the
+ * order of the frame), averaged per voxel
+ **/
+void LidarObjectExtractor::voxelize(int partition)
+{
+    lidarPartition *part = &_partitions[partition];
+    float inv = 1.0f / _config.voxelSize;
+    part->points = 0;
+    for (int chunk = 0; chunk < _chunkCount; chunk++) {
+        part->points += (int)(_bins[((size_t)chunk * _partitionCount) + partition].size() / 3);
+    }
+    gridClear(part->voxelKeys, part->voxelSlots, part->points);
+    part->voxelSum.resize((size_t)part->points * 3);
+    part->voxelPoints.resize(part->points);
+    part->voxelX.resize(part->points);
+    part->voxels = 0;
+    for (int chunk = 0; chunk < _chunkCount; chunk++) {
+        const std::vector<float> &bin = _bins[((size_t)chunk * _partitionCount) + partition];
+        for (size_t i = 0; i < bin.size(); i += 3) {
+            const float *p = &bin[i];
+            int ix = (int)floorf(p[0] * inv);
+            uint64_t key = gridKey(ix, (int)floorf(p[1] * inv), (int)floorf(p[2] * inv));
+            int v = gridSlot(part->voxelKeys, part->voxelSlots, key, part->voxels);
+            float *sum = &part->voxelSum[(size_t)v * 3];
+            if (v == part->voxels) {
+                sum[0] = sum[1] = sum[2] = 0;
+                part->voxelPoints[v] = 0;
+                part->voxelX[v] = ix;
+                part->voxels++;
+            }
+            sum[0] += p[0];
+            sum[1] += p[1];
+            sum[2] += p[2];
+            part->voxelPoints[v]++;
+        }
+    }
+    // sums --> centroids
+    for (int v = 0; v < part->voxels; v++) {
+        float n = (float)part->voxelPoints[v];
+        part->voxelSum[(size_t)v * 3] /= n;
+        part->voxelSum[((size_t)v * 3) + 1] /= n;
+        part->voxelSum[((size_t)v * 3) + 2] /= n;
+    }
+}
+
+/** --------------------------------------------------------
+ * cluster()
+ * the clusters of a partition, and their bounding boxes
+ **/
+void LidarObjectExtractor::cluster(lidarPartition *part)
+{
+    float d = _config.clusterDistance;
+    float d2 = d * d;
+    float inv = 1.0f / d;
+    int voxels = part->voxels;
+    const float *c = (voxels > 0) ? &part->voxelSum[0] : NULL;
+
+    // voxels by cell of the cluster distance: counts, then starts
+    gridClear(part->cellKeys, part->cellSlots, voxels);
+    part->cellOf.resize(voxels);
+    part->cellStart.assign((size_t)voxels + 1, 0);
+    int cells = 0;
+    for (int v = 0; v < voxels; v++) {
+        uint64_t key = gridKey((int)floorf(c[v * 3] * inv), (int)floorf(c[(v * 3) + 1] * inv),
+            (int)floorf(c[(v * 3) + 2] * inv));
+        int cell = gridSlot(part->cellKeys, part->cellSlots, key, cells);
+        if (cell == cells) {
+            cells++;
+        }
+        part->cellOf[v] = cell;
+        part->cellStart[cell + 1]++;
+    }
+    for (int cell = 0; cell < cells; cell++) {
+        part->cellStart[cell + 1] += part->cellStart[cell];
+    }
+    const int *start = &part->cellStart[0];
+    part->cellVoxels.resize(voxels);
+    part->fill.assign(start, start + cells);      // fill position per cell
+    for (int v = 0; v < voxels; v++) {
+        part->cellVoxels[part->fill[part->cellOf[v]]++] = v;
+    }
+
+    // the centroids in cell order, so that the voxels of a cell are
+    // next to each other: the clustering works on this order
+    part->cellXyz.resize((size_t)voxels * 3);
+    for (int k = 0; k < voxels; k++) {
+        int v = part->cellVoxels[k];
+        part->cellXyz[(size_t)k * 3] = c[v * 3];
+        part->cellXyz[((size_t)k * 3) + 1] = c[(v * 3) + 1];
+        part->cellXyz[((size_t)k * 3) + 2] = c[(v * 3) + 2];
+    }
+    const float *p = (voxels > 0) ? &part->cellXyz[0] : NULL;
+
+    // connect the voxels within the distance: only the cells around can
+    // have any.  Each pair of cells once: the cell itself, and the 13 of
+    // its 26 neighbors that come after it
+    std::vector<int> &parent = part->parent;
+    parent.resize(voxels);
+    for (int k = 0; k < voxels; k++) {
+        parent[k] = k;
+    }
+    for (int cell = 0; cell < cells; cell++) {
+        const float *p0 = &p[start[cell] * 3];
+        int ix = (int)floorf(p0[0] * inv);
+        int iy = (int)floorf(p0[1] * inv);
+        int iz = (int)floorf(p0[2] * inv);
+        for (int n = 0; n < 14; n++) {
+            int other = cell;
+            if (n > 0) {
+                // neighbor n: dx, dy, dz in -1..1, after (0, 0, 0) in that order
+                int d = n + 13;
+                other = gridFind(part->cellKeys, part->cellSlots,
+                    gridKey(ix + (d / 9) - 1, iy + ((d / 3) % 3) - 1, iz + (d % 3) - 1));
+                if (other < 0) {
+                    continue;
+                }
+            }
+            for (int i = start[cell]; i < start[cell + 1]; i++) {
+                int ri = findRoot(parent, i);       // stays the root: others join it
+                const float *pi = &p[i * 3];
+                int first = (other == cell) ? (i + 1) : start[other];
+                for (int k = first; k < start[other + 1]; k++) {
+                    float ex = p[k * 3] - pi[0];
+                    float ey = p[(k * 3) + 1] - pi[1];
+                    float ez = p[(k * 3) + 2] - pi[2];
+                    if (((ex * ex) + (ey * ey) + (ez * ez)) <= d2) {
+                        int rk = findRoot(parent, k);
+                        if (rk != ri) {
+                            parent[rk] = ri;
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    // bounding box and points of each cluster
+    part->clusterOf.assign(voxels, -1);
+    part->clusterBox.clear();
+    part->clusterPoints.clear();
+    part->clusters = 0;
+    for (int k = 0; k < voxels; k++) {
+        int r = findRoot(parent, k);
+        int cl = part->clusterOf[r];
+        const float *pk = &p[k * 3];
+        if (cl < 0) {
+            cl = part->clusterOf[r] = part->clusters++;
+            part->clusterBox.insert(part->clusterBox.end(), pk, pk + 3);
+            part->clusterBox.insert(part->clusterBox.end(), pk, pk + 3);
+            part->clusterPoints.push_back(0);
+        }
+        float *box = &part->clusterBox[(size_t)cl * 6];
+        for (int i = 0; i < 3; i++) {
+            box[i] = std::min(box[i], pk[i]);
+            box[i + 3] = std::max(box[i + 3], pk[i]);
+        }
+        part->clusterPoints[cl] += part->voxelPoints[part->cellVoxels[k]];
+    }
+}
+
+/** --------------------------------------------------------
+ * findEdges()
+ * the voxels of a partition within a cluster distance of the low or
+ * high edge of their slab (with a little slack for the rounding of the
+ * edge), sorted by slab, side and y
+ **/
+void LidarObjectExtractor::findEdges(lidarPartition *part)
+{
+    float reach = _config.clusterDistance + (0.01f * _config.voxelSize);
+    float width = _slabVoxels * _config.voxelSize;
+    part->edges.clear();
+    for (int k = 0; k < part->voxels; k++) {
+        const float *pk = &part->cellXyz[(size_t)k * 3];
+        lidarEdgeVoxel edge;
+        edge.x = pk[0];
+        edge.y = pk[1];
+        edge.z = pk[2];
+        edge.slab = floorDiv(part->voxelX[part->cellVoxels[k]], _slabVoxels);
+        float low = edge.slab * width;
+        bool nearLow = ((pk[0] - low) < reach);
+        bool nearHigh = (((low + width) - pk[0]) < reach);
+        if (!nearLow && !nearHigh) {
+            continue;
+        }
+        edge.cluster = part->clusterOf[findRoot(part->parent, k)];
+        if (nearLow) {
+            edge.high = 0;
+            part->edges.push_back(edge);
+        }
+        if (nearHigh) {
+            edge.high = 1;
+            part->edges.push_back(edge);
+        }
+    }
+    std::sort(part->edges.begin(), part->edges.end(), edgeBefore);
+}
+
+/** --------------------------------------------------------
+ * joinEdges()
+ * the pairs of clusters (by their number over all the partitions) that
+ * meet across the high edges of the slabs of a partition: the voxels of
+ * both sides of an edge are sorted by y, so each one is only compared
+ * with those of the other side within a cluster distance in y
+ **/
+void LidarObjectExtractor::joinEdges(int partition, std::vector<int> &links)
+{
+    float d = _config.clusterDistance;
+    float d2 = d * d;
+    const std::vector<lidarEdgeVoxel> &edges = _partitions[partition].edges;
+    size_t i = 0;
+    while (i < edges.size()) {
+        // the high side of one slab...
+        size_t end = i + 1;
+        while ((end < edges.size()) && (edges[end].slab == edges[i].slab)
+            && (edges[end].high == edges[i].high)) {
+            end++;
+        }
+        if (!edges[i].high) {
+            i = end;
+            continue;
+        }
+        // ...and the low side of the next one
+        int nextPartition = floorMod(edges[i].slab + 1, _partitionCount);
+        const std::vector<lidarEdgeVoxel> &next = _partitions[nextPartition].edges;
+        lidarEdgeVoxel key;
+        memset(&key, 0, sizeof(key));
+        key.slab = edges[i].slab + 1;
+        key.y = -INFINITY;
+        size_t lo = std::lower_bound(next.begin(), next.end(), key, edgeBefore) - next.begin();
+        int base = _clusterBase[partition];
+        int nextBase = _clusterBase[nextPartition];
+        int lastA = -1;
+        int lastB = -1;
+        for (; i < end; i++) {
+            const lidarEdgeVoxel &a = edges[i];
+            while ((lo < next.size()) && (next[lo].slab == key.slab) && (next[lo].high == 0)
+                && (next[lo].y < (a.y - d))) {
+                lo++;
+            }
+            for (size_t k = lo; (k < next.size()) && (next[k].slab == key.slab)
+                && (next[k].high == 0) && (next[k].y <= (a.y + d)); k++) {
+                float ex = next[k].x - a.x;
+                float ey = next[k].y - a.y;
+                float ez = next[k].z - a.z;
+                if ((((ex * ex) + (ey * ey) + (ez * ez)) <= d2)
+                    && ((a.cluster != lastA) || (next[k].cluster != lastB))) {
+                    lastA = a.cluster;
+                    lastB = next[k].cluster;
+                    links.push_back(base + lastA);
+                    links.push_back(nextBase + lastB);
+                }
+            }
+        }
+    }
+}
+
+/** --------------------------------------------------------
+ * merge()
+ * the clusters of all the partitions, those that were joined merged
+ * into their root: its box grows over theirs, and it gets their points
+ **/
+void LidarObjectExtractor::merge(void)
+{
+    int total = _clusterBase[_partitionCount];
+    _parent.resize(total);
+    _clusterBox.resize((size_t)total * 6);
+    _clusterPoints.resize(total);
+    for (int partition = 0; partition < _partitionCount; partition++) {
+        const lidarPartition *part = &_partitions[partition];
+        int base = _clusterBase[partition];
+        if (part->clusters > 0) {
+            std::copy(part->clusterBox.begin(), part->clusterBox.begin() + ((size_t)part->clusters * 6),
+                _clusterBox.begin() + ((size_t)base * 6));
+            std::copy(part->clusterPoints.begin(), part->clusterPoints.begin() + part->clusters,
+                _clusterPoints.begin() + base);
+        }
+    }
+    for (int k = 0; k < total; k++) {
+        _parent[k] = k;
+    }
+    for (size_t t = 0; t < _links.size(); t++) {
+        for (size_t i = 0; i < _links[t].size(); i += 2) {
+            int ra = findRoot(_parent, _links[t][i]);
+            int rb = findRoot(_parent, _links[t][i + 1]);
+            if (ra != rb) {
+                _parent[rb] = ra;
+            }
+        }
+    }
+    _clusters = 0;
+    for (int k = 0; k < total; k++) {
+        int r = findRoot(_parent, k);
+        if (r == k) {
+            _clusters++;
+            continue;
+        }
+        float *box = &_clusterBox[(size_t)r * 6];
+        const float *other = &_clusterBox[(size_t)k * 6];
+        for (int i = 0; i < 3; i++) {
+            box[i] = std::min(box[i], other[i]);
+            box[i + 3] = std::max(box[i + 3], other[i + 3]);
+        }
+        _clusterPoints[r] += _clusterPoints[k];
+    }
+}
+
+int LidarObjectExtractor::extract(const uint8_t *data, int count, const cloudLayout *layout,
+    std::vector<Sensor_SensorObject> &objects)
+{
+    objects.clear();
+    _points = _voxels = _clusters = 0;
+    if ((data == NULL) || (count <= 0) || !cloudLayoutValid(layout)
+        || (_config.voxelSize <= 0) || (_config.clusterDistance <= 0)) {
+        return 0;
+    }
+
+    _data = data;
+    _count = count;
+    _layout = layout;
+    _pool->run(_chunkCount, decodeTask, this);
+    _pool->run(_partitionCount, partitionTask, this);
+    _clusterBase[0] = 0;
+    for (int partition = 0; partition < _partitionCount; partition++) {
+        const lidarPartition *part = &_partitions[partition];
+        _clusterBase[partition + 1] = _clusterBase[partition] + part->clusters;
+        _points += part->points;
+        _voxels += part->voxels;
+    }
+    for (size_t t = 0; t < _links.size(); t++) {
+        _links[t].clear();
+    }
+    if (_partitionCount > 1) {
+        _pool->run(_partitionCount, edgeTask, this);
+    }
+    merge();
+
+    // the largest clusters that are big enough
+    _order.clear();
+    for (int k = 0; k < (int)_parent.size(); k++) {
+        if ((_parent[k] == k) && (_clusterPoints[k] >= _config.clusterMinPoints)) {
+            _order.push_back(k);
+        }
+    }
+    size_t keep = std::min(_order.size(), (size_t)Sensor_SENSOR_OBJECT_LIST_MAX_SIZE);
+    std::partial_sort(_order.begin(), _order.begin() + keep, _order.end(),
+        [this](int a, int b) { return _clusterPoints[a] > _clusterPoints[b]; });
+
+    for (size_t i = 0; i < keep; i++) {
+        const float *box = &_clusterBox[(size_t)_order[i] * 6];
+        Sensor_SensorObject object;
+        memset(&object, 0, sizeof(object));
+        for (int a = 0; a < 3; a++) {
+            object.position[a] = (box[a] + box[a + 3]) / 2;
+            object.size[a] = (box[a + 3] - box[a]) + _config.voxelSize;  // centroids are inside
+        }
+        float footprint = std::max(object.size[0], object.size[1]);
+        object.classification = (footprint < 2.0f) ? CLASSIFICATION_UNKNOWNSMALL : CLASSIFICATION_UNKNOWNBIG;
+        float range = sqrtf((object.position[0] * object.position[0])
+            + (object.position[1] * object.position[1]));
+        object.rangeMode = (range < 30.0f) ? RANGE_SHORT : ((range < 80.0f) ? RANGE_MEDIUM : RANGE_LONG);
+        object.amplitude = (float)_clusterPoints[_order[i]];
+        objects.push_back(object);
+    }
+    return (int)objects.size();
+}
@@ -0,0 +1,168 @@
+/** ------------------------------------------------------------------------
+ * lidarObjects.h
+ * Objects from the LiDAR point cloud, for sensor fusion:
+ *   - decode: the x, y, z fields of the points, as given by the PointCloud2
+ *     fields (float32, float16, or int16 times the scale the LiDAR
+ *     publisher sends with its scan geometry)
+ *   - ground removal: points below config.lidarGroundHeight (the publisher
+ *     clamps the rays that hit the ground to z = 0), and further than
+ *     config.lidarMaxRange, are dropped
+ *   - downsample: the points are averaged per voxel of
+ *     config.lidarVoxelSize m, in a hashed voxel grid
+ *   - clustering: voxels closer than config.lidarClusterDistance m are
+ *     connected (union-find, with a hashed grid of that cell size so only
+ *     the 27 neighbor cells are searched); clusters with fewer than
+ *     config.lidarClusterMinPoints points are dropped
+ * Each cluster is a Sensor::SensorObject with the center and size of its
+ * bounding box, and its point count as the amplitude.  The work buffers
+ * are kept, so the extraction does not allocate once it has seen a full
+ * frame.
+ * The stages run on config.lidarThreads threads, over partitions of the
+ * grid; the clusters that span partitions are merged at their edges, so
+ * the objects are the same for any thread count.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef lidarObjects_h
+#define lidarObjects_h
+
+#include <stdint.h>
+#include <vector>
+#include "automotive.h"
+
+/** --------------------------------------------------------
+ * cloudLayout
+ * where the x, y, z of a point are, from the PointCloud2 fields
+ **/
+typedef struct {
+    int         stride;         // point_step
+    int         offset[3];      // x, y, z; -1 if not found
+    uint8_t     datatype;       // of x, y, z (PCLOUD_DATATYPE_*)
+    float       scale;          // meters per count of int16
+} cloudLayout;
+
+/** --------------------------------------------------------
+ * cloudLayoutReset() / cloudLayoutField() / cloudLayoutValid()
+ * build the layout from the fields of a sample, one by one; valid if it
+ * has x, y and z of the same supported type, inside the point
+ **/
+void cloudLayoutReset(cloudLayout *layout, int stride, float scale);
+void cloudLayoutField(cloudLayout *layout, const char *name, uint32_t offset, uint8_t datatype);
+bool cloudLayoutValid(const cloudLayout *layout);
+
+typedef struct {
+    float       groundHeight;       // m
+    float       maxRange;           // m, 0: no limit
+    float       voxelSize;          // m
+    float       clusterDistance;    // m
+    int         clusterMinPoints;
+    int         threads;            // 0: one per core
+} lidarObjectConfig;
+
+/** --------------------------------------------------------
+ * lidarEdgeVoxel / lidarPartition
+ * The work buffers of one partition of the grid: its voxels, clusters,
+ * and the voxels near the edges of its slabs.
+ **/
+typedef struct {
+    float       x, y, z;
+    int         slab;
+    int         high;           // near the high x edge of the slab (else low)
+    int         cluster;        // in the partition
+} lidarEdgeVoxel;
+
+typedef struct {
+    std::vector<uint64_t>   voxelKeys;      // hashed voxel grid: key, or empty
+    std::vector<int>        voxelSlots;     // voxel of the key
+    std::vector<float>      voxelSum;       // per voxel: x, y, z sums, then centroid
+    std::vector<int>        voxelPoints;
+    std::vector<int>        voxelX;         // x grid coordinate (for the slab)
+    std::vector<uint64_t>   cellKeys;       // hashed cluster grid
+    std::vector<int>        cellSlots;
+    std::vector<int>        cellOf;         // per voxel: its cell
+    std::vector<int>        cellStart;      // per cell: first of its voxels in cellVoxels
+    std::vector<int>        cellVoxels;     // the voxels, cell by cell
+    std::vector<float>      cellXyz;        // their centroids, in that order
+    std::vector<int>        parent;         // union-find, in that order
+    std::vector<int>        clusterOf;      // per root: cluster
+    std::vector<int>        fill;
+    std::vector<float>      clusterBox;     // per cluster: min x, y, z, max x, y, z
+    std::vector<int>        clusterPoints;
+    std::vector<lidarEdgeVoxel> edges;      // by slab, side, y
+    int                     points;
+    int                     voxels;
+    int                     clusters;
+} lidarPartition;
+
+/** --------------------------------------------------------
+ * LidarObjectExtractor
+ * Not shared between threads: holds the work buffers, and the pool of
+ * threads that share the stages of a frame (see lidarObjects.cxx):
+ *   - decode and ground removal, by ranges of the points, into the
+ *     partitions of the grid: slabs of x, dealt out in turn
+ *   - voxel grid, clustering and bounding boxes, by partition
+ *   - join of the clusters that meet at the edges of the slabs, by
+ *     partition, then their merge
+ **/
+class TaskPool;
+
+class LidarObjectExtractor {
+
+private:
+    lidarObjectConfig       _config;
+    TaskPool                *_pool;
+    int                     _partitionCount;
+    int                     _chunkCount;
+    int                     _slabVoxels;    // voxels across a slab
+    std::vector<lidarPartition> _partitions;
+    std::vector<std::vector<float> > _bins; // per chunk and partition: points, x, y, z
+    std::vector<std::vector<int> > _links;  // per thread: pairs of joined clusters
+    std::vector<int>        _clusterBase;   // per partition: its first cluster
+    std::vector<int>        _parent;        // union-find of all the clusters
+    std::vector<float>      _clusterBox;    // per root cluster
+    std::vector<int>        _clusterPoints;
+    std::vector<int>        _order;
+    const uint8_t           *_data;         // of the frame being extracted
+    int                     _count;
+    const cloudLayout       *_layout;
+    int                     _points;        // kept after ground removal
+    int                     _voxels;
+    int                     _clusters;
+
+    static void decodeTask(int chunk, int thread, void *arg);
+    static void partitionTask(int partition, int thread, void *arg);
+    static void edgeTask(int partition, int thread, void *arg);
+    void decode(int chunk);
+    void voxelize(int partition);
+    void cluster(lidarPartition *part);
+    void findEdges(lidarPartition *part);
+    void joinEdges(int partition, std::vector<int> &links);
+    void merge(void);
+
+public:
+    LidarObjectExtractor();
+    ~LidarObjectExtractor();
+
+    // (re)starts the threads if their count changed
+    void configure(const lidarObjectConfig *config);
+
+    // the objects of the 'count' points at 'data' (in 'layout'), largest
+    // first, at most Sensor_SENSOR_OBJECT_LIST_MAX_SIZE; returns their count
+    int extract(const uint8_t *data, int count, const cloudLayout *layout,
+        std::vector<Sensor_SensorObject> &objects);
+
+    // of the last extract()
+    int points(void) const { return _points; }
+    int voxels(void) const { return _voxels; }
+    int clusters(void) const { return _clusters; }
+    int threads(void) const;
+};
+
+#endif  // ndef lidarObjects_h
@@ -0,0 +1,421 @@
+/** ------------------------------------------------------------------------
+ * objectTracker.cxx
+ * Multi-object tracker for sensor fusion.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <algorithm>
+#include <cmath>
+#include <string.h>
+#include "objectTracker.h"
+
+#define TRACK_SIZE_GAIN     (0.3f)      // of a new size, per detection
+#define TRACK_MAX_DT        (1.0f)      // s, longest prediction step
+#define COST_NONE           (1.0e9)     // not in the gate
+
+static inline int findRoot(std::vector<int> &parent, int v)
+{
+    while (parent[v] != v) {
+        parent[v] = parent[parent[v]];      // path halving
+        v = parent[v];
+    }
+    return v;
+}
+
+ObjectTracker::ObjectTracker() :
+    _stamp(0), _count(0)
+{
+    _config.gate = 11.3f;
+    _config.confirmHits = 3;
+    _config.maxAge = 500000000;
+    _config.accel = 3.0f;
+    _config.maxSpeed = 30.0f;
+}
+
+/** --------------------------------------------------------
+ * predict()
+ * the tracks at 'stamp'; a detection from the past (a LiDAR frame on its
+ * own can be older than the last vision frame) is taken as current
+ **/
+void ObjectTracker::predict(int64_t stamp)
+{
+    if ((_stamp == 0) || (stamp <= _stamp)) {
+        if (_stamp == 0) {
+            _stamp = stamp;
+        }
+        return;
+    }
+    float dt = std::min((float)(stamp - _stamp) / 1.0e9f, TRACK_MAX_DT);
+    _stamp = stamp;
+
+    // x' = x + v dt, P' = F P F' + Q, with Q of a white-noise acceleration
+    float q = _config.accel * _config.accel;
+    float qxx = q * dt * dt * dt * dt / 4;
+    float qxv = q * dt * dt * dt / 2;
+    float qvv = q * dt * dt;
+    for (int a = 0; a < 3; a++) {
+        float *x = _x[a];
+        const float *v = _v[a];
+        float *pxx = _pxx[a];
+        float *pxv = _pxv[a];
+        float *pvv = _pvv[a];
+        for (int t = 0; t < _count; t++) {
+            x[t] += v[t] * dt;
+            pxx[t] += (dt * ((2 * pxv[t]) + (dt * pvv[t]))) + qxx;
+            pxv[t] += (dt * pvv[t]) + qxv;
+            pvv[t] += qvv;
+        }
+    }
+}
+
+/** --------------------------------------------------------
+ * assign()
+ * Hungarian method (shortest augmenting paths, with potentials) on the
+ * 'rows' x 'cols' matrix in _cost, rows <= cols: the column of each row
+ * is in _colRow, as the row (1-based) of each column (1-based)
+ **/
+void ObjectTracker::assign(int rows, int cols)
+{
+    _u.assign((size_t)rows + 1, 0);
+    _w.assign((size_t)cols + 1, 0);
+    _colRow.assign((size_t)cols + 1, 0);
+    _way.assign((size_t)cols + 1, 0);
+    _minW.resize((size_t)cols + 1);
+    _used.resize((size_t)cols + 1);
+    for (int i = 1; i <= rows; i++) {
+        // add row i: grow a tree of tight edges from it until it reaches
+        // a free column, then flip the path
+        _colRow[0] = i;
+        int j0 = 0;
+        std::fill(_minW.begin(), _minW.end(), HUGE_VAL);
+        std::fill(_used.begin(), _used.end(), 0);
+        do {
+            _used[j0] = 1;
+            int i0 = _colRow[j0];
+            int j1 = 0;
+            double delta = HUGE_VAL;
+            const double *row = &_cost[(size_t)(i0 - 1) * cols];
+            for (int j = 1; j <= cols; j++) {
+                if (!_used[j]) {
+                    double reduced = row[j - 1] - _u[i0] - _w[j];
+                    if (reduced < _minW[j]) {
+                        _minW[j] = reduced;
+                        _way[j] = j0;
+                    }
+                    if (_minW[j] < delta) {
+                        delta = _minW[j];
+                        j1 = j;
+                    }
+                }
+            }
+            for (int j = 0; j <= cols; j++) {
+                if (_used[j]) {
+                    _u[_colRow[j]] += delta;
+                    _w[j] -= delta;
+                }
+                else {
+                    _minW[j] -= delta;
+                }
+            }
+            j0 = j1;
+        } while (_colRow[j0] != 0);
+        do {
+            int j1 = _way[j0];
+            _colRow[j0] = _colRow[j1];
+            j0 = j1;
+        } while (j0 != 0);
+    }
+}
+
+/** --------------------------------------------------------
+ * solveGroup()
+ * the best assignment of a group of gated pairs: each track of the group
+ * gets one of its detections, or its miss column (at the cost of the
+ * gate), so a detection is only taken from another track when that
+ * lowers the total
+ **/
+void ObjectTracker::solveGroup(const int *pairs, int pairCount)
+{
+    if (pairCount == 1) {
+        _match[_pairDetection[pairs[0]]] = _pairTrack[pairs[0]];
+        return;
+    }
+
+    _rows.clear();
+    _cols.clear();
+    for (int i = 0; i < pairCount; i++) {
+        int track = _pairTrack[pairs[i]];
+        int detection = _pairDetection[pairs[i]];
+        if (_local[track] < 0) {
+            _local[track] = (int)_rows.size();
+            _rows.push_back(track);
+        }
+        if (_local[TRACK_MAX + detection] < 0) {
+            _local[TRACK_MAX + detection] = (int)_cols.size();
+            _cols.push_back(detection);
+        }
+    }
+    int rows = (int)_rows.size();
+    int cols = (int)_cols.size() + rows;
+    _cost.assign((size_t)rows * cols, COST_NONE);
+    for (int r = 0; r < rows; r++) {
+        _cost[((size_t)r * cols) + _cols.size() + r] = _config.gate;
+    }
+    for (int i = 0; i < pairCount; i++) {
+        int r = _local[_pairTrack[pairs[i]]];
+        int c = _local[TRACK_MAX + _pairDetection[pairs[i]]];
+        _cost[((size_t)r * cols) + c] = _pairCost[pairs[i]];
+    }
+
+    assign(rows, cols);
+    for (int c = 0; c < (int)_cols.size(); c++) {
+        if (_colRow[c + 1] != 0) {
+            _match[_cols[c]] = _rows[_colRow[c + 1] - 1];
+        }
+    }
+    for (int r = 0; r < rows; r++) {
+        _local[_rows[r]] = -1;
+    }
+    for (int c = 0; c < (int)_cols.size(); c++) {
+        _local[TRACK_MAX + _cols[c]] = -1;
+    }
+}
+
+/** --------------------------------------------------------
+ * associate()
+ * the track of each detection (in _match), or -1 for a new one: gating,
+ * then the groups of tracks and detections linked by their gates, each
+ * solved on its own
+ **/
+void ObjectTracker::associate(const Sensor_SensorObject *detections, int count, float r)
+{
+    _match.assign(count, -1);
+    _pairCost.clear();
+    _pairTrack.clear();
+    _pairDetection.clear();
+    _group.resize((size_t)TRACK_MAX + count);
+    _local.assign((size_t)TRACK_MAX + count, -1);
+    for (int i = 0; i < TRACK_MAX + count; i++) {
+        _group[i] = i;
+    }
+
+    // 1 / innovation variance per axis.  The tracks are in x order, so
+    // a detection is only compared with those near enough in x to be in
+    // the gate even with the widest variance, in one pass over the arrays
+    float widest = 0;
+    for (int a = 0; a < 3; a++) {
+        for (int t = 0; t < _count; t++) {
+            _gain[a][t] = 1.0f / (_pxx[a][t] + r);
+        }
+    }
+    for (int t = 0; t < _count; t++) {
+        widest = std::max(widest, _pxx[0][t]);
+    }
+    float reach = sqrtf(_config.gate * (widest + r));
+    for (int d = 0; d < count; d++) {
+        const float *z = detections[d].position;
+        int first = (int)(std::lower_bound(_x[0], _x[0] + _count, z[0] - reach) - _x[0]);
+        int last = (int)(std::upper_bound(_x[0], _x[0] + _count, z[0] + reach) - _x[0]);
+        float *cost = _gateCost;
+        for (int t = first; t < last; t++) {
+            float ex = z[0] - _x[0][t];
+            float ey = z[1] - _x[1][t];
+            float ez = z[2] - _x[2][t];
+            cost[t] = (ex * ex * _gain[0][t]) + (ey * ey * _gain[1][t]) + (ez * ez * _gain[2][t]);
+        }
+        for (int t = first; t < last; t++) {
+            if (cost[t] <= _config.gate) {
+                _pairCost.push_back(cost[t]);
+                _pairTrack.push_back(t);
+                _pairDetection.push_back(d);
+                int a = findRoot(_group, t);
+                int b = findRoot(_group, TRACK_MAX + d);
+                if (a != b) {
+                    _group[b] = a;
+                }
+            }
+        }
+    }
+
+    // the pairs by group, then each group
+    int pairCount = (int)_pairCost.size();
+    _pairOrder.resize(pairCount);
+    for (int i = 0; i < pairCount; i++) {
+        _pairOrder[i] = i;
+    }
+    for (int i = 0; i < pairCount; i++) {
+        _group[_pairTrack[i]] = findRoot(_group, _pairTrack[i]);
+    }
+    std::sort(_pairOrder.begin(), _pairOrder.end(),
+        [this](int a, int b) { return _group[_pairTrack[a]] < _group[_pairTrack[b]]; });
+    for (int first = 0; first < pairCount; ) {
+        int group = _group[_pairTrack[_pairOrder[first]]];
+        int last = first + 1;
+        while ((last < pairCount) && (_group[_pairTrack[_pairOrder[last]]] == group)) {
+            last++;
+        }
+        solveGroup(&_pairOrder[first], last - first);
+        first = last;
+    }
+}
+
+/** --------------------------------------------------------
+ * correct()
+ * Kalman update of a track with the position of a detection (variance
+ * 'r' per axis); its size and classification follow the detection
+ **/
+void ObjectTracker::correct(int track, const Sensor_SensorObject &detection, float r, int64_t stamp)
+{
+    int t = track;
+    for (int a = 0; a < 3; a++) {
+        float s = _pxx[a][t] + r;
+        float kx = _pxx[a][t] / s;
+        float kv = _pxv[a][t] / s;
+        float e = detection.position[a] - _x[a][t];
+        _x[a][t] += kx * e;
+        _v[a][t] += kv * e;
+        _pvv[a][t] -= kv * _pxv[a][t];
+        _pxv[a][t] -= kx * _pxv[a][t];
+        _pxx[a][t] -= kx * _pxx[a][t];
+        _size[a][t] += TRACK_SIZE_GAIN * (detection.size[a] - _size[a][t]);
+    }
+    // a camera class is better than a LiDAR size class
+    if ((detection.classification > CLASSIFICATION_UNKNOWNBIG)
+        || (_class[t] <= CLASSIFICATION_UNKNOWNBIG)) {
+        _class[t] = detection.classification;
+    }
+    if (detection.amplitude > 0) {
+        _amplitude[t] = detection.amplitude;
+    }
+    _hits[t]++;
+    _lastHit[t] = stamp;
+}
+
+void ObjectTracker::start(const Sensor_SensorObject &detection, float r, int64_t stamp)
+{
+    int t = _count++;
+    for (int a = 0; a < 3; a++) {
+        _x[a][t] = detection.position[a];
+        _v[a][t] = 0;
+        _pxx[a][t] = r;
+        _pxv[a][t] = 0;
+        _pvv[a][t] = _config.maxSpeed * _config.maxSpeed;
+        _size[a][t] = detection.size[a];
+    }
+    _class[t] = detection.classification;
+    _amplitude[t] = detection.amplitude;
+    _hits[t] = 1;
+    _lastHit[t] = stamp;
+}
+
+void ObjectTracker::swap(int a, int b)
+{
+    for (int i = 0; i < 3; i++) {
+        std::swap(_x[i][a], _x[i][b]);
+        std::swap(_v[i][a], _v[i][b]);
+        std::swap(_pxx[i][a], _pxx[i][b]);
+        std::swap(_pxv[i][a], _pxv[i][b]);
+        std::swap(_pvv[i][a], _pvv[i][b]);
+        std::swap(_size[i][a], _size[i][b]);
+    }
+    std::swap(_class[a], _class[b]);
+    std::swap(_amplitude[a], _amplitude[b]);
+    std::swap(_hits[a], _hits[b]);
+    std::swap(_lastHit[a], _lastHit[b]);
+}
+
+/** --------------------------------------------------------
+ * sort()
+ * the tracks in x order: an insertion sort, as they hardly change
+ * places from one update to the next
+ **/
+void ObjectTracker::sort(void)
+{
+    for (int t = 1; t < _count; t++) {
+        for (int k = t; (k > 0) && (_x[0][k] < _x[0][k - 1]); k--) {
+            swap(k, k - 1);
+        }
+    }
+}
+
+// the last track takes the place of 'track'
+void ObjectTracker::drop(int track)
+{
+    int last = --_count;
+    if (track == last) {
+        return;
+    }
+    for (int a = 0; a < 3; a++) {
+        _x[a][track] = _x[a][last];
+        _v[a][track] = _v[a][last];
+        _pxx[a][track] = _pxx[a][last];
+        _pxv[a][track] = _pxv[a][last];
+        _pvv[a][track] = _pvv[a][last];
+        _size[a][track] = _size[a][last];
+    }
+    _class[track] = _class[last];
+    _amplitude[track] = _amplitude[last];
+    _hits[track] = _hits[last];
+    _lastHit[track] = _lastHit[last];
+}
+
+void ObjectTracker::update(int64_t stamp, const Sensor_SensorObject *detections, int count,
+    float sigma)
+{
+    float r = sigma * sigma;
+    predict(stamp);
+    sort();
+    associate(detections, count, r);
+    for (int d = 0; d < count; d++) {
+        if (_match[d] >= 0) {
+            correct(_match[d], detections[d], r, _stamp);
+        }
+    }
+
+    // the tracks that were not seen for too long go, then the new ones
+    // come in while there is room
+    for (int t = _count - 1; t >= 0; t--) {
+        if ((_stamp - _lastHit[t]) > _config.maxAge) {
+            drop(t);
+        }
+    }
+    for (int d = 0; (d < count) && (_count < TRACK_MAX); d++) {
+        if (_match[d] < 0) {
+            start(detections[d], r, _stamp);
+        }
+    }
+}
+
+int ObjectTracker::tracks(std::vector<Sensor_SensorObject> &objects) const
+{
+    objects.clear();
+    for (int t = 0; t < _count; t++) {
+        if (_hits[t] < _config.confirmHits) {
+            continue;
+        }
+        Sensor_SensorObject object;
+        memset(&object, 0, sizeof(object));
+        for (int a = 0; a < 3; a++) {
+            object.position[a] = _x[a][t];
+            object.velocity[a] = _v[a][t];
+            object.size[a] = _size[a][t];
+        }
+        object.classification = _class[t];
+        object.amplitude = _amplitude[t];
+        float range = sqrtf((object.position[0] * object.position[0])
+            + (object.position[1] * object.position[1]));
+        object.rangeMode = (range < 30.0f) ? RANGE_SHORT : ((range < 80.0f) ? RANGE_MEDIUM : RANGE_LONG);
+        object.rangeRate = (range > 0)
+            ? (((object.position[0] * object.velocity[0]) + (object.position[1] * object.velocity[1])) / range)
+            : 0;
+        objects.push_back(object);
+    }
+    return (int)objects.size();
+}
@@ -0,0 +1,126 @@
+/** ------------------------------------------------------------------------
+ * objectTracker.h
+ * Multi-object tracker for sensor fusion: the objects of the vision and
+ * LiDAR frames are associated over time with a table of tracks, so the
+ * output is one object per tracked object, with the velocity estimated
+ * from its motion.
+ *   - prediction: each track has a constant-velocity Kalman filter, one
+ *     per axis (position and velocity), with white-noise acceleration of
+ *     config.trackAccel m/s^2
+ *   - gating: a detection can only go to a track within config.trackGate
+ *     (squared Mahalanobis distance of the position, chi-square with 3
+ *     degrees of freedom: 11.3 is 99%)
+ *   - association: global nearest neighbor, the assignment of least total
+ *     distance (Hungarian method), in which a track can also miss.  The
+ *     tracks and detections are split into the groups that share gates,
+ *     and each group is solved on its own, so the work follows the
+ *     conflicts, not the size of the table.
+ *   - update: the detections update their tracks; the others start new
+ *     tracks, which are published once they have had config.trackConfirmHits
+ *     detections, and are dropped config.trackMaxAge ms after their last one
+ * The sensors are applied one after the other (sequential update), each
+ * with its own position noise (config.trackVisionSigma and
+ * config.trackLidarSigma m), so an object seen by both the camera and
+ * the LiDAR stays one track.
+ * The state of the tracks is kept as a structure of arrays (one array
+ * per component, in track order), so prediction and gating are plain
+ * loops over contiguous floats; the tracks are kept in x order, so each
+ * detection is only gated with the tracks near it in x.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef objectTracker_h
+#define objectTracker_h
+
+#include <stdint.h>
+#include <vector>
+#include "automotive.h"
+
+#define TRACK_MAX   (Sensor_SENSOR_OBJECT_LIST_MAX_SIZE)
+
+typedef struct {
+    float       gate;           // squared Mahalanobis distance
+    int         confirmHits;    // detections before a track is published
+    int64_t     maxAge;         // ns without a detection before a track is dropped
+    float       accel;          // m/s^2, process noise
+    float       maxSpeed;       // m/s, initial velocity uncertainty
+} trackerConfig;
+
+/** --------------------------------------------------------
+ * ObjectTracker
+ * Used by the fusion loop only.
+ **/
+class ObjectTracker {
+
+private:
+    trackerConfig   _config;
+    int64_t         _stamp;                 // ns, time of the track states
+    int             _count;                 // tracks
+
+    // track states, by component
+    float           _x[3][TRACK_MAX];       // position
+    float           _v[3][TRACK_MAX];       // velocity
+    float           _pxx[3][TRACK_MAX];     // covariance per axis: position,
+    float           _pxv[3][TRACK_MAX];     //   position-velocity,
+    float           _pvv[3][TRACK_MAX];     //   velocity
+    float           _size[3][TRACK_MAX];
+    float           _amplitude[TRACK_MAX];
+    ClassificationEnum _class[TRACK_MAX];
+    int             _hits[TRACK_MAX];
+    int64_t         _lastHit[TRACK_MAX];    // ns
+
+    // association work buffers
+    float               _gain[3][TRACK_MAX];    // per axis: 1 / innovation variance
+    float               _gateCost[TRACK_MAX];   // of a detection, per track
+    std::vector<float>  _pairCost;          // gated pairs: cost, track, detection
+    std::vector<int>    _pairTrack;
+    std::vector<int>    _pairDetection;
+    std::vector<int>    _pairOrder;         // by group
+    std::vector<int>    _group;             // union-find of tracks, then detections
+    std::vector<int>    _local;             // row or column in the group
+    std::vector<int>    _match;             // per detection: its track, or -1
+    std::vector<int>    _rows;              // the tracks and detections of a group
+    std::vector<int>    _cols;
+    std::vector<double> _cost;              // its cost matrix, with a miss column per track
+    std::vector<double> _u;                 // Hungarian method
+    std::vector<double> _w;
+    std::vector<double> _minW;
+    std::vector<int>    _colRow;
+    std::vector<int>    _way;
+    std::vector<char>   _used;
+
+    void predict(int64_t stamp);
+    void associate(const Sensor_SensorObject *detections, int count, float r);
+    void solveGroup(const int *pairs, int pairCount);
+    void assign(int rows, int cols);
+    void correct(int track, const Sensor_SensorObject &detection, float r, int64_t stamp);
+    void start(const Sensor_SensorObject &detection, float r, int64_t stamp);
+    void swap(int a, int b);
+    void sort(void);
+    void drop(int track);
+
+public:
+    ObjectTracker();
+
+    void configure(const trackerConfig *config) { _config = *config; }
+
+    // the detections of one sensor at source time 'stamp' (ns since the
+    // epoch), with position noise 'sigma' (m).  The velocity, range mode
+    // and range rate of the detections are not used.
+    void update(int64_t stamp, const Sensor_SensorObject *detections, int count, float sigma);
+
+    // the confirmed tracks at the time of the last update
+    int tracks(std::vector<Sensor_SensorObject> &objects) const;
+
+    int size(void) const { return _count; }
+    int64_t stamp(void) const { return _stamp; }
+};
+
+#endif  // ndef objectTracker_h
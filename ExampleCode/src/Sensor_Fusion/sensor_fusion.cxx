@@ -11,13 +11,22 @@ use or inability to use the software.
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+#include <atomic>
 #include "Utils.h"
+#include "pointDelta.h"
+#include "pointSlice.h"
+#include "fusionTrigger.h"
+#include "fusionSync.h"
+#include "lidarObjects.h"
+#include "objectTracker.h"
+#include "../Lidar/lidarFormat.h"
 #include "automotive.h"
 #include "automotiveSupport.h"
 #include "ndds/ndds_cpp.h"
 
 /* Vision sensor listener to print any status information received
-   on data available is handled in the main loop */
+   on data available is handled by the WaitSet of the fusion loop */
 class Vision_VisionSensorListener : public DDSDataReaderListener {
 public:
     virtual void on_requested_deadline_missed(
@@ -60,11 +69,96 @@ public:
 };
 
 /* Lidar listener. The on data available call back will print
-   the timestamp for each received data. The rest of the data
-   is ignored
+   the timestamp for each received data. The full point cloud is
+   rebuilt from (compressed) keyframes and deltas, or from slices;
+   the rest of the data is ignored. The objects of each new full cloud
+   (or complete sweep) are extracted (see lidarObjects.h) and added to
+   the LiDAR frames of the fusion sync, by its header stamp; the frame
+   is signaled to the fusion loop with the frame ready guard condition.
+   int16 points are skipped until their scale has come with the LiDAR
+   geometry (see LidarGeometryListener)
  */
 class sensor_msgs_msg_dds__PointCloud2_Listener : public DDSDataReaderListener {
+private:
+    PointCloudTracker _cloud;
+    PointSliceAssembler _sweep;
+    DDSGuardCondition *_frameReady;
+    FusionSync *_sync;
+    lidarFrame _frame;
+    LidarObjectExtractor _extractor;
+
+protected:
+    std::atomic<float> _pointScale;     /* m per count of int16 points, 0: not known yet */
+    cloudLayout _layout;
+
+    /* the layout of the points of a sample, from its fields */
+    void setLayout(const sensor_msgs_msg_dds__PointCloud2_ *sample) {
+        cloudLayoutReset(&_layout, (int)sample->point_step_, _pointScale);
+        for (int f = 0; f < sample->fields_.length(); f++) {
+            cloudLayoutField(&_layout, sample->fields_[f].name_,
+                sample->fields_[f].offset_, sample->fields_[f].datatype_);
+        }
+    }
+
+    /* false if the points of _layout can't be read yet */
+    bool layoutReady(void) {
+        if ((_layout.datatype == PCLOUD_DATATYPE_INT16) && (_layout.scale <= 0)) {
+            printf("PointCloud2 sample skipped, waiting for the LiDAR geometry (int16 point scale)\n");
+            return false;
+        }
+        return true;
+    }
+
+    /* the objects of a new full cloud of 'bytes' at 'points' (in
+       _layout) into _frame */
+    void extractFrame(const uint8_t *points, int bytes) {
+        if (_sync != NULL) {
+            uint64_t tStart = fusionNow();
+            int count = (_layout.stride > 0) ? (bytes / _layout.stride) : 0;
+            _extractor.extract(points, count, &_layout, _frame.objects);
+            _frame.bytes = bytes;
+            printf("  %d LiDAR objects from %d points above ground (%d voxels) in %.2f ms\n",
+                (int)_frame.objects.size(), _extractor.points(), _extractor.voxels(),
+                (double)(fusionNow() - tStart) / 1000000.0);
+        }
+    }
+
+    /* _frame (extracted from the cloud stamped 'sec', 'nanosec') to the
+       fusion sync, and signal it */
+    void addFrame(int32_t sec, uint32_t nanosec) {
+        if (_sync != NULL) {
+            _sync->addLidar(sourceStamp(sec, nanosec), fusionNow(), _frame);
+        }
+        if (_frameReady != NULL) {
+            _frameReady->set_trigger_value(DDS_BOOLEAN_TRUE);
+        }
+    }
+
+    /* a new full cloud of 'bytes' at 'points', in _layout */
+    void frameReady(int32_t sec, uint32_t nanosec, const uint8_t *points, int bytes) {
+        extractFrame(points, bytes);
+        addFrame(sec, nanosec);
+    }
+
 public:
+    sensor_msgs_msg_dds__PointCloud2_Listener() : _frameReady(NULL), _sync(NULL), _pointScale(0) {
+        cloudLayoutReset(&_layout, 0, 0);
+    }
+
+    void configureObjects(const lidarObjectConfig *config) {
+        _extractor.configure(config);
+    }
+
+    /* from the LiDAR geometry, on its own listener */
+    void setPointScale(float scale) {
+        _pointScale = scale;
+    }
+
+    void setFrameReady(DDSGuardCondition *condition, FusionSync *sync) {
+        _frameReady = condition;
+        _sync = sync;
+    }
+
     virtual void on_requested_deadline_missed(
         DDSDataReader* /*reader*/,
         const DDS_RequestedDeadlineMissedStatus& /*status*/) {
@@ -132,15 +226,50 @@ void sensor_msgs_msg_dds__PointCloud2_Listener::on_data_available(DDSDataReader*
 
     int dsLen = data_seq.length();
     for (i = 0; i < dsLen; ++i) {
-        if (info_seq[i].valid_data) {
-            printf("Received %d dds sample with %d points; t = %d.%d\n",
+        if (info_seq[i].valid_data && pointCloudIsSlice(&data_seq[i])) {
+            /* the rows of each slice can be used as soon as it arrives */
+            int rows = 0;
+            long lost = _sweep.lost();
+            if (_sweep.add(&data_seq[i], &rows) < 0) {
+                continue;
+            }
+            if (_sweep.lost() != lost) {
+                printf("LiDAR slices lost: %ld\n", _sweep.lost() - lost);
+            }
+            if (_sweep.complete()) {
+                printf("Received sweep %u with %d points; t = %d.%d\n",
+                    _sweep.sweep(),
+                    (int)(data_seq[i].row_step_ * data_seq[i].height_),
+                    data_seq[i].header_.stamp_.sec_,
+                    data_seq[i].header_.stamp_.nanosec_);
+                setLayout(&data_seq[i]);
+                if (!layoutReady()) {
+                    continue;
+                }
+                frameReady(data_seq[i].header_.stamp_.sec_, data_seq[i].header_.stamp_.nanosec_,
+                    _sweep.points(), (int)(data_seq[i].row_step_ * data_seq[i].height_));
+            }
+        }
+        else if (info_seq[i].valid_data) {
+            const uint8_t *points = _cloud.update(&data_seq[i]);
+            if (points == NULL) {
+                printf("PointCloud2 sample skipped, waiting for a keyframe\n");
+                continue;
+            }
+            printf("Received %d dds sample with %d points (%d rows %s); t = %d.%d\n",
                 dsLen, 
-                data_seq[i].data_.length(),
+                (int)(data_seq[i].row_step_ * data_seq[i].height_),
+                _cloud.lastRows(), (pointCloudIsDelta(&data_seq[i]) ? "changed" : "in keyframe"),
                 data_seq[i].header_.stamp_.sec_,
                 data_seq[i].header_.stamp_.nanosec_
             );
             // sensor_msgs_msg_dds__PointCloud2_TypeSupport::print_data(&data_seq[i]);
-            
+            setLayout(&data_seq[i]);
+            if (!layoutReady()) {
+                continue;
+            }
+            frameReady(data_seq[i].header_.stamp_.sec_, data_seq[i].header_.stamp_.nanosec_,
+                points, (int)(data_seq[i].row_step_ * data_seq[i].height_));
         }
     }
 
@@ -150,6 +279,213 @@ void sensor_msgs_msg_dds__PointCloud2_Listener::on_data_available(DDSDataReader*
     }
 }
 
+/* Zero copy LiDAR listener. The points are read in place, in the
+   shared memory of the writer. The writer may reuse a sample as soon
+   as it is written again, so each sample is checked for consistency
+   once it has been read, and dropped if it changed meanwhile
+ */
+class LidarZeroCopy_PointCloud2Listener : public sensor_msgs_msg_dds__PointCloud2_Listener {
+public:
+    virtual void on_data_available(DDSDataReader* reader);
+};
+
+void LidarZeroCopy_PointCloud2Listener::on_data_available(DDSDataReader* reader)
+{
+    LidarZeroCopy_PointCloud2DataReader *LidarZeroCopy_PointCloud2_reader = NULL;
+    LidarZeroCopy_PointCloud2Seq data_seq;
+    DDS_SampleInfoSeq info_seq;
+    DDS_ReturnCode_t retcode;
+    int i;
+
+    LidarZeroCopy_PointCloud2_reader = LidarZeroCopy_PointCloud2DataReader::narrow(reader);
+    if (LidarZeroCopy_PointCloud2_reader == NULL) {
+        fprintf(stderr, "DataReader narrow error\n");
+        return;
+    }
+
+    retcode = LidarZeroCopy_PointCloud2_reader->take(
+        data_seq, info_seq, DDS_LENGTH_UNLIMITED,
+        DDS_ANY_SAMPLE_STATE, DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE);
+
+    if (retcode == DDS_RETCODE_NO_DATA) {
+        return;
+    }
+    else if (retcode != DDS_RETCODE_OK) {
+        fprintf(stderr, "take error %d\n", retcode);
+        return;
+    }
+
+    int dsLen = data_seq.length();
+    for (i = 0; i < dsLen; ++i) {
+        if (!info_seq[i].valid_data) {
+            continue;
+        }
+        LidarZeroCopy_PointCloud2Offset sample_root = data_seq[i].root();
+        auto data = sample_root.data_();
+        const uint8_t *points = (const uint8_t *)rti::flat::plain_cast(data);
+        int points_bytes = (int)data.element_count();
+        int rows = (int)sample_root.height_();
+        int row_step = (int)sample_root.row_step_();
+        int32_t sec = sample_root.stamp_().sec_();
+        uint32_t nanosec = sample_root.stamp_().nanosec_();
+        bool valid = ((points != NULL) && (points_bytes == (rows * row_step)));
+        if (!valid) {
+            printf("PointCloud2 zero copy sample skipped, bad data\n");
+            continue;
+        }
+        printf("Received %d zero copy dds sample with %d points; t = %d.%u\n",
+            dsLen, points_bytes, sec, nanosec);
+        cloudLayoutReset(&_layout, (int)sample_root.point_step_(), _pointScale);
+        auto fields = sample_root.fields_();
+        for (unsigned int f = 0; f < fields.element_count(); f++) {
+            auto field = fields.get_element(f);
+            cloudLayoutField(&_layout, field.name_().get_string(),
+                field.offset_(), field.datatype_());
+        }
+        if (!layoutReady()) {
+            continue;
+        }
+
+        /* the objects are extracted right from shared memory: they only
+           count if the writer did not reuse the sample meanwhile, which
+           is known once they are done */
+        extractFrame(points, points_bytes);
+        DDS_Boolean consistent = DDS_BOOLEAN_FALSE;
+        retcode = LidarZeroCopy_PointCloud2_reader->is_data_consistent(
+            consistent, &data_seq[i], &info_seq[i]);
+        if ((retcode != DDS_RETCODE_OK) || !consistent) {
+            printf("PointCloud2 zero copy sample dropped, reused by the writer while read\n");
+            continue;
+        }
+        addFrame(sec, nanosec);
+    }
+
+    retcode = LidarZeroCopy_PointCloud2_reader->return_loan(data_seq, info_seq);
+    if (retcode != DDS_RETCODE_OK) {
+        fprintf(stderr, "return loan error %d\n", retcode);
+    }
+}
+
+/* LiDAR geometry listener. The publisher of int16 points (and range
+   images) sends the scan geometry once, on a topic that keeps it for
+   late joiners: a single 'point' with the azimuth and polar angles of
+   the scan, and the meters per count of the points.  The scale is
+   handed to the LiDAR listener, so it always decodes the points with
+   the value they were encoded with
+ */
+class LidarGeometryListener : public DDSDataReaderListener {
+private:
+    sensor_msgs_msg_dds__PointCloud2_Listener *_lidar;
+
+public:
+    LidarGeometryListener(sensor_msgs_msg_dds__PointCloud2_Listener *lidar) : _lidar(lidar) {}
+
+    virtual void on_data_available(DDSDataReader* reader);
+};
+
+void LidarGeometryListener::on_data_available(DDSDataReader* reader)
+{
+    sensor_msgs_msg_dds__PointCloud2_DataReader *geometry_reader = NULL;
+    sensor_msgs_msg_dds__PointCloud2_Seq data_seq;
+    DDS_SampleInfoSeq info_seq;
+    DDS_ReturnCode_t retcode;
+
+    geometry_reader = sensor_msgs_msg_dds__PointCloud2_DataReader::narrow(reader);
+    if (geometry_reader == NULL) {
+        fprintf(stderr, "DataReader narrow error\n");
+        return;
+    }
+
+    retcode = geometry_reader->take(
+        data_seq, info_seq, DDS_LENGTH_UNLIMITED,
+        DDS_ANY_SAMPLE_STATE, DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE);
+    if (retcode == DDS_RETCODE_NO_DATA) {
+        return;
+    }
+    else if (retcode != DDS_RETCODE_OK) {
+        fprintf(stderr, "take error %d\n", retcode);
+        return;
+    }
+
+    for (int i = 0; i < data_seq.length(); ++i) {
+        if (!info_seq[i].valid_data) {
+            continue;
+        }
+        const sensor_msgs_msg_dds__PointCloud2_ &geometry = data_seq[i];
+        for (int f = 0; f < geometry.fields_.length(); f++) {
+            const char *name = geometry.fields_[f].name_;
+            uint32_t offset = geometry.fields_[f].offset_;
+            float scale = 0;
+            if ((name == NULL) || (strcmp(name, "scale") != 0)
+                || (geometry.fields_[f].datatype_ != PCLOUD_DATATYPE_FLOAT32)
+                || ((offset + sizeof(float)) > (uint32_t)geometry.data_.length())) {
+                continue;
+            }
+            memcpy(&scale, &geometry.data_[offset], sizeof(scale));
+            if (scale > 0) {
+                printf("LiDAR geometry: %g m per count\n", scale);
+                _lidar->setPointScale(scale);
+            }
+        }
+    }
+
+    retcode = geometry_reader->return_loan(data_seq, info_seq);
+    if (retcode != DDS_RETCODE_OK) {
+        fprintf(stderr, "return loan error %d\n", retcode);
+    }
+}
+
+
+/* A vision object as a sensor object */
+static void visionToSensorObject(const Vision_VisionObject &in, Sensor_SensorObject &object)
+{
+    memset(&object, 0, sizeof(object));
+    for (int a = 0; a < 3; a++) {
+        object.position[a] = in.position[a];
+        object.velocity[a] = in.velocity[a];
+        object.size[a] = in.size[a];
+    }
+    object.classification = in.classification;
+}
+
+/* Add the objects of a vision frame to the sensor object list, as
+   long as there is space */
+static void addVisionObjects(
+    Sensor_SensorObjectList *instance, const std::vector<Vision_VisionObject> &objects,
+    int *numObjects)
+{
+    instance->objects.length(Sensor_SENSOR_OBJECT_LIST_MAX_SIZE);
+    for (size_t j = 0; j < objects.size(); j++) {
+        if (*numObjects < Sensor_SENSOR_OBJECT_LIST_MAX_SIZE) {
+            visionToSensorObject(objects[j], instance->objects[*numObjects]);
+            (*numObjects)++;
+        }
+    }
+    /* set the sequence length to as many as we actually have */
+    instance->objects.length(*numObjects);
+}
+
+/* Add sensor objects (found in a LiDAR frame, or tracks) to the sensor
+   object list, as long as there is space */
+static void addSensorObjects(
+    Sensor_SensorObjectList *instance, const std::vector<Sensor_SensorObject> &objects,
+    int *numObjects)
+{
+    instance->objects.length(Sensor_SENSOR_OBJECT_LIST_MAX_SIZE);
+    for (size_t j = 0; (j < objects.size()) && (*numObjects < Sensor_SENSOR_OBJECT_LIST_MAX_SIZE); j++) {
+        instance->objects[*numObjects] = objects[j];
+        (*numObjects)++;
+    }
+    instance->objects.length(*numObjects);
+}
+
+/* Update the tracks with the objects of one sensor */
+static void trackObjects(
+    ObjectTracker *tracker, int64_t stamp, const std::vector<Sensor_SensorObject> &objects,
+    float sigma)
+{
+    tracker->update(stamp, objects.empty() ? NULL : &objects[0], (int)objects.size(), sigma);
+}
 
 /* Delete all entities */
 static int shutdown(
@@ -188,22 +524,99 @@ extern "C" int publisher_main(int sample_count)
     const char *type_name = NULL;
     int count = 0;  
     int domainId = 0;
-    DDS_Duration_t send_period = {4,0};
     DDSSubscriber *subscriber = NULL;
     sensor_msgs_msg_dds__PointCloud2_Listener *lidar_listener = NULL;
+    LidarGeometryListener *geometry_listener = NULL;
+    bool lidarZeroCopy = false;
     Vision_VisionSensorListener *vision_listener = NULL;
     DDSDataReader *reader = NULL;
     Vision_VisionSensorDataReader *Vision_VisionSensor_reader = NULL;
     Vision_VisionSensorSeq vision_data_seq;
     DDS_SampleInfoSeq info_seq;
     int numObjects = 0;
+    int status = 0;
+    DDSWaitSet *waitset = NULL;
+    DDSGuardCondition *lidar_frame_condition = NULL;
+    DDSStatusCondition *vision_status_condition = NULL;
+    FusionSync *sync = NULL;
+    ObjectTracker *tracker = NULL;
+    std::vector<Sensor_SensorObject> detections;
+    std::vector<Sensor_SensorObject> tracked;
+    float visionSigma = 0.5f;
+    float lidarSigma = 0.2f;
 
     /* get the configuration parameters */
     PropertyUtil* prop = new PropertyUtil("sensor_fusion.properties");
 
     long time = prop->getLongProperty("config.pubInterval");
-    send_period.sec = time / 1000;
-    send_period.nanosec = (time % 1000) * 1000 * 1000;
+    if (time <= 0) {
+        time = 500;
+    }
+
+    /* When to publish: on vision data, on a LiDAR frame or every
+       config.pubInterval, at most once per config.minInterval
+       (see fusionTrigger.h) */
+    long minInterval = prop->getLongProperty("config.minInterval");
+    if (minInterval < 0) {
+        minInterval = 0;
+    }
+    FusionTrigger trigger(
+        fusionTriggerFromName(prop->getStringProperty("config.fusionTrigger")),
+        (uint64_t)time * 1000000, (uint64_t)minInterval * 1000000);
+
+    /* Vision frames are paired with the nearest LiDAR sweep by source
+       time, within config.syncTolerance ms; they wait at most
+       config.syncMaxWait ms for it (see fusionSync.h) */
+    int syncDepth = prop->getIntProperty("config.syncDepth");
+    if (syncDepth <= 0) {
+        syncDepth = 16;
+    }
+    long syncTolerance = prop->getLongProperty("config.syncTolerance");
+    if (syncTolerance < 0) {
+        syncTolerance = 0;
+    }
+    long syncMaxWait = prop->getLongProperty("config.syncMaxWait");
+    if (syncMaxWait < 0) {
+        syncMaxWait = 0;
+    }
+    sync = new FusionSync(syncDepth, (int64_t)syncTolerance * 1000000,
+        (uint64_t)syncMaxWait * 1000000);
+    /* publishing on the LiDAR: its objects don't wait for a vision frame
+       that has not come yet */
+    sync->setLidarEarly(trigger.policy() == FUSION_ON_LIDAR);
+
+    /* The objects are tracked over time (see objectTracker.h), and the
+       confirmed tracks published, unless config.tracking is 0: then the
+       objects of each frame are published as they are */
+    if ((prop->getStringProperty("config.tracking") == "")
+        || (prop->getLongProperty("config.tracking") != 0)) {
+        trackerConfig trackConfig;
+        trackConfig.gate = 11.3f;
+        trackConfig.confirmHits = 3;
+        trackConfig.maxAge = 500000000;
+        trackConfig.accel = 3.0f;
+        trackConfig.maxSpeed = 30.0f;
+        if (prop->getFloatProperty("config.trackGate") > 0) {
+            trackConfig.gate = prop->getFloatProperty("config.trackGate");
+        }
+        if (prop->getIntProperty("config.trackConfirmHits") > 0) {
+            trackConfig.confirmHits = prop->getIntProperty("config.trackConfirmHits");
+        }
+        if (prop->getLongProperty("config.trackMaxAge") > 0) {
+            trackConfig.maxAge = (int64_t)prop->getLongProperty("config.trackMaxAge") * 1000000;
+        }
+        if (prop->getFloatProperty("config.trackAccel") > 0) {
+            trackConfig.accel = prop->getFloatProperty("config.trackAccel");
+        }
+        if (prop->getFloatProperty("config.trackVisionSigma") > 0) {
+            visionSigma = prop->getFloatProperty("config.trackVisionSigma");
+        }
+        if (prop->getFloatProperty("config.trackLidarSigma") > 0) {
+            lidarSigma = prop->getFloatProperty("config.trackLidarSigma");
+        }
+        tracker = new ObjectTracker();
+        tracker->configure(&trackConfig);
+    }
 
     domainId = prop->getLongProperty("config.domainId");
 
@@ -217,6 +630,23 @@ extern "C" int publisher_main(int sample_count)
         printf("No lidar sensor topic name specified\n");
         return -1;
     }
+    /* Zero copy LiDAR (from a publisher on this host, see config.zeroCopy
+       in lidar.properties) comes on a topic of its own */
+    lidarZeroCopy = (prop->getLongProperty("config.lidarZeroCopy") != 0);
+    if (lidarZeroCopy) {
+        lidarTopicName = prop->getStringProperty("topic.LidarZeroCopy");
+        if (lidarTopicName == "") {
+            printf("No zero copy lidar topic name specified\n");
+            return -1;
+        }
+    }
+    /* The scale of int16 points comes with the scan geometry, on a topic
+       of its own (see topic.Geometry in lidar.properties) */
+    std::string geometryTopicName = prop->getStringProperty("topic.LidarGeometry");
+    if (geometryTopicName == "") {
+        printf("No lidar geometry topic name specified\n");
+        return -1;
+    }
     std::string sensorTopicName = prop->getStringProperty("topic.out");
     if (sensorTopicName == "") {
         printf("No sensor fusion output topic name specified\n");
@@ -233,11 +663,17 @@ extern "C" int publisher_main(int sample_count)
         printf("No QoS Profile for vision sensor subscriber specified\n");
         return -1;
     }
-    std::string lidarQosProfile = prop->getStringProperty("qos.lidar.Profile");
+    std::string lidarQosProfile = prop->getStringProperty(
+        lidarZeroCopy ? "qos.lidar.ZeroCopyProfile" : "qos.lidar.Profile");
     if (lidarQosProfile == "") {
         printf("No QoS Profile for lidar subscriber specified\n");
         return -1;
     }
+    std::string geometryQosProfile = prop->getStringProperty("qos.lidar.GeometryProfile");
+    if (geometryQosProfile == "") {
+        printf("No QoS Profile for lidar geometry subscriber specified\n");
+        return -1;
+    }
     std::string sensorQosProfile = prop->getStringProperty("qos.out.Profile");
     if (sensorQosProfile == "") {
         printf("No QoS Profile for sensor fusion publisher specified\n");
@@ -344,12 +780,12 @@ extern "C" int publisher_main(int sample_count)
 
     /* Create the reader. The listener will only subscribe to 
        status events other than on data available. The main loop 
-       will poll for data from the sensor and collect them into
+       waits for data from the sensor and collects them into
        the sensor object list
      */
     reader = subscriber->create_datareader_with_profile(
         topic, qosLibrary.c_str(), visionQosProfile.c_str(), vision_listener,
-        DDS_STATUS_MASK_ALL & ~~DDS_DATA_AVAILABLE_STATUS);
+        DDS_STATUS_MASK_ALL & ~DDS_DATA_AVAILABLE_STATUS);
     if (reader == NULL) {
         printf("create_datareader error\n");
         shutdown(participant);
@@ -363,9 +799,16 @@ extern "C" int publisher_main(int sample_count)
     }
 
     /* Register the Lidar data type */
-    type_name = sensor_msgs_msg_dds__PointCloud2_TypeSupport::get_type_name();
-    retcode = sensor_msgs_msg_dds__PointCloud2_TypeSupport::register_type(
-        participant, type_name);
+    if (lidarZeroCopy) {
+        type_name = LidarZeroCopy_PointCloud2TypeSupport::get_type_name();
+        retcode = LidarZeroCopy_PointCloud2TypeSupport::register_type(
+            participant, type_name);
+    }
+    else {
+        type_name = sensor_msgs_msg_dds__PointCloud2_TypeSupport::get_type_name();
+        retcode = sensor_msgs_msg_dds__PointCloud2_TypeSupport::register_type(
+            participant, type_name);
+    }
     if (retcode != DDS_RETCODE_OK) {
         printf("register_type error %d\n", retcode);
         shutdown(participant);
@@ -384,11 +827,48 @@ extern "C" int publisher_main(int sample_count)
     }
 
     /* Create LiDAR listener */
-    lidar_listener = new sensor_msgs_msg_dds__PointCloud2_Listener();
+    if (lidarZeroCopy) {
+        lidar_listener = new LidarZeroCopy_PointCloud2Listener();
+    }
+    else {
+        lidar_listener = new sensor_msgs_msg_dds__PointCloud2_Listener();
+    }
+
+    /* Objects are extracted from the LiDAR points by the listener: ground
+       removal, voxel grid and clustering (see lidarObjects.h), on
+       config.lidarThreads threads (0: one per core) */
+    lidarObjectConfig objectConfig;
+    objectConfig.groundHeight = 0.1f;
+    objectConfig.maxRange = 0;
+    objectConfig.voxelSize = 0.2f;
+    objectConfig.clusterDistance = 0.5f;
+    objectConfig.clusterMinPoints = 5;
+    objectConfig.threads = (int)prop->getLongProperty("config.lidarThreads");
+    if (prop->getStringProperty("config.lidarGroundHeight") != "") {
+        objectConfig.groundHeight = prop->getFloatProperty("config.lidarGroundHeight");
+    }
+    if (prop->getStringProperty("config.lidarMaxRange") != "") {
+        objectConfig.maxRange = prop->getFloatProperty("config.lidarMaxRange");
+    }
+    if (prop->getFloatProperty("config.lidarVoxelSize") > 0) {
+        objectConfig.voxelSize = prop->getFloatProperty("config.lidarVoxelSize");
+    }
+    if (prop->getFloatProperty("config.lidarClusterDistance") > 0) {
+        objectConfig.clusterDistance = prop->getFloatProperty("config.lidarClusterDistance");
+    }
+    if (prop->getStringProperty("config.lidarClusterMinPoints") != "") {
+        objectConfig.clusterMinPoints = prop->getIntProperty("config.lidarClusterMinPoints");
+    }
+    lidar_listener->configureObjects(&objectConfig);
+
+    /* The listener signals each new LiDAR frame to the main loop */
+    lidar_frame_condition = new DDSGuardCondition();
+    lidar_listener->setFrameReady(lidar_frame_condition, sync);
 
     /* Create the lidar reader. The listener will handle the 
        received samples so no processing of lidar samples
-       needed in the main loop. 
+       needed in the main loop, which only gets the frame ready
+       condition.
      */
     reader = subscriber->create_datareader_with_profile(
         topic, qosLibrary.c_str(), lidarQosProfile.c_str(), lidar_listener,
@@ -399,6 +879,34 @@ extern "C" int publisher_main(int sample_count)
         return -1;
     }
 
+    /* The LiDAR geometry is a plain PointCloud2, also with zero copy */
+    type_name = sensor_msgs_msg_dds__PointCloud2_TypeSupport::get_type_name();
+    retcode = sensor_msgs_msg_dds__PointCloud2_TypeSupport::register_type(
+        participant, type_name);
+    if (retcode != DDS_RETCODE_OK) {
+        printf("register_type error %d\n", retcode);
+        shutdown(participant);
+        return -1;
+    }
+    topic = participant->create_topic_with_profile(
+        geometryTopicName.c_str(),
+        type_name, qosLibrary.c_str(), geometryQosProfile.c_str(), NULL /* listener */,
+        DDS_STATUS_MASK_NONE);
+    if (topic == NULL) {
+        printf("create_topic error\n");
+        shutdown(participant);
+        return -1;
+    }
+    geometry_listener = new LidarGeometryListener(lidar_listener);
+    reader = subscriber->create_datareader_with_profile(
+        topic, qosLibrary.c_str(), geometryQosProfile.c_str(), geometry_listener,
+        DDS_DATA_AVAILABLE_STATUS);
+    if (reader == NULL) {
+        printf("create_datareader error\n");
+        shutdown(participant);
+        return -1;
+    }
+
     /* Create data sample for writing */
     instance = Sensor_SensorObjectListTypeSupport::create_data();
     if (instance == NULL) {
@@ -409,51 +917,164 @@ extern "C" int publisher_main(int sample_count)
 
     /* Set the sequence maximum to the maximum so we can fill the list */
     instance->objects.maximum(Sensor_SENSOR_OBJECT_LIST_MAX_SIZE);
+    instance->objects.length(0);
+
+    /* Wait for the vision data and the LiDAR frames with a WaitSet */
+    vision_status_condition = Vision_VisionSensor_reader->get_statuscondition();
+    if (vision_status_condition == NULL) {
+        printf("get_statuscondition error\n");
+        shutdown(participant);
+        return -1;
+    }
+    retcode = vision_status_condition->set_enabled_statuses(DDS_DATA_AVAILABLE_STATUS);
+    if (retcode != DDS_RETCODE_OK) {
+        printf("set_enabled_statuses error\n");
+        shutdown(participant);
+        return -1;
+    }
+
+    waitset = new DDSWaitSet();
+    retcode = waitset->attach_condition(vision_status_condition);
+    if (retcode != DDS_RETCODE_OK) {
+        printf("attach_condition error\n");
+        shutdown(participant);
+        delete waitset;
+        return -1;
+    }
+    retcode = waitset->attach_condition(lidar_frame_condition);
+    if (retcode != DDS_RETCODE_OK) {
+        printf("attach_condition error\n");
+        shutdown(participant);
+        delete waitset;
+        return -1;
+    }
 
+    printf("Sensor fusion publishing on %s\n", fusionTriggerName(trigger.policy()));
+
+    /* Main loop: count is the number of samples published */
+    uint64_t latencySum = 0;
+    uint64_t latencyMax = 0;
+    int64_t measurementTime = 0;    /* of the newest fused set in the list */
+    for (count=0; (sample_count == 0) || (count < sample_count); ) {
+        DDSConditionSeq active_conditions_seq;
+        DDS_Duration_t wait_time;
+        uint64_t tNow = fusionNow();
+        uint64_t tWait = trigger.waitTime(tNow);
+        if (sync->waitTime(tNow) < tWait) {
+            tWait = sync->waitTime(tNow);
+        }
+        wait_time.sec = (DDS_Long)(tWait / 1000000000);
+        wait_time.nanosec = (DDS_UnsignedLong)(tWait % 1000000000);
+
+        /* wait() returns on new data, or when the trigger or a waiting
+           vision frame is due */
+        retcode = waitset->wait(active_conditions_seq, wait_time);
+        if ((retcode != DDS_RETCODE_OK) && (retcode != DDS_RETCODE_TIMEOUT)) {
+            printf("wait returned error: %d\n", retcode);
+            break;
+        }
 
-    /* Main loop */
-    for (count=0; (sample_count == 0) || (count < sample_count); ++count) {
-        /* set the timestamp */
-		TimestampUtil::getTimestamp(&(instance->timestamp.s), &(instance->timestamp.ns));
+        for (int c = 0; c < active_conditions_seq.length(); c++) {
+            if (active_conditions_seq[c] == lidar_frame_condition) {
+                /* the frame is in the sync: its event is when the sync
+                   releases its objects, below */
+                lidar_frame_condition->set_trigger_value(DDS_BOOLEAN_FALSE);
+            }
+            else if (active_conditions_seq[c] == vision_status_condition) {
+                /* Get all the vision sensor data */
+                uint64_t tVision = fusionNow();
+                retcode = Vision_VisionSensor_reader->take(
+                    vision_data_seq, info_seq, DDS_LENGTH_UNLIMITED,
+                    DDS_ANY_SAMPLE_STATE, DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE);
+                if (retcode == DDS_RETCODE_NO_DATA) {
+                    continue;
+                }
+                else if (retcode != DDS_RETCODE_OK) {
+                    printf("take error %d\n", retcode);
+                    continue;
+                }
 
+                /* each sample is a vision frame, by its source time */
+                for (int i = 0; i < vision_data_seq.length(); i++) {
+                    if (info_seq[i].valid_data) {
+                        visionFrame &frame = sync->addVision(
+                            sourceStamp(vision_data_seq[i].timestamp.s, vision_data_seq[i].timestamp.ns),
+                            vision_data_seq[i].id, tVision);
+                        for (int j = 0; j < vision_data_seq[i].objects.length(); j++) {
+                            frame.objects.push_back(vision_data_seq[i].objects[j]);
+                        }
+                    }
+                }
 
-        /* Get all the vision sensor data */
-        retcode = Vision_VisionSensor_reader->take(
-            vision_data_seq, info_seq, DDS_LENGTH_UNLIMITED,
-            DDS_ANY_SAMPLE_STATE, DDS_ANY_VIEW_STATE, DDS_ANY_INSTANCE_STATE);
+                retcode = Vision_VisionSensor_reader->return_loan(vision_data_seq, info_seq);
+                if (retcode != DDS_RETCODE_OK) {
+                    printf("return loan error %d\n", retcode);
+                }
+            }
+        }
 
-        numObjects = 0;
-        instance->objects.length(Sensor_SENSOR_OBJECT_LIST_MAX_SIZE);
-        for (int i = 0; i < vision_data_seq.length(); i++) {
-            if (info_seq[i].valid_data) {
-                /* copy all the objects from all received vision sensor samples into the objects list
-                   as long as there is space.
-                 */  
-                for (int j = 0; j < vision_data_seq[i].objects.length(); j++) {
-                    if (numObjects < Sensor_SENSOR_OBJECT_LIST_MAX_SIZE) {
-                        instance->objects[numObjects].position[0] = vision_data_seq[i].objects[j].position[0];
-                        instance->objects[numObjects].position[1] = vision_data_seq[i].objects[j].position[1];
-                        instance->objects[numObjects].position[2] = vision_data_seq[i].objects[j].position[2];
-                        instance->objects[numObjects].velocity[0] = vision_data_seq[i].objects[j].velocity[0];
-                        instance->objects[numObjects].velocity[1] = vision_data_seq[i].objects[j].velocity[0];
-                        instance->objects[numObjects].velocity[2] = vision_data_seq[i].objects[j].velocity[0];
-                        instance->objects[numObjects].size[0] = vision_data_seq[i].objects[j].size[0];
-                        instance->objects[numObjects].size[1] = vision_data_seq[i].objects[j].size[1];
-                        instance->objects[numObjects].size[2] = vision_data_seq[i].objects[j].size[2];
-                        instance->objects[numObjects].classification = vision_data_seq[i].objects[j].classification;
-
-                        numObjects++;
+        /* fuse the vision frames that are synchronized */
+        fusedSet fused;
+        while (sync->next(fusionNow(), fused)) {
+            bool lidarNew = (fused.lidar != NULL) && fused.lidarObjects;
+            if (tracker != NULL) {
+                /* each sensor at its own time (the LiDAR sweep is skew
+                   after the vision frame), in time order */
+                int64_t lidarStamp = fused.stamp + fused.skew;
+                if (lidarNew && (fused.skew < 0)) {
+                    trackObjects(tracker, lidarStamp, fused.lidar->objects, lidarSigma);
+                }
+                if (fused.vision != NULL) {
+                    detections.resize(fused.vision->objects.size());
+                    for (size_t j = 0; j < detections.size(); j++) {
+                        visionToSensorObject(fused.vision->objects[j], detections[j]);
                     }
+                    trackObjects(tracker, fused.stamp, detections, visionSigma);
                 }
+                if (lidarNew && (fused.skew >= 0)) {
+                    trackObjects(tracker, lidarStamp, fused.lidar->objects, lidarSigma);
+                }
+            }
+            else {
+                if (fused.vision != NULL) {
+                    addVisionObjects(instance, fused.vision->objects, &numObjects);
+                }
+                if (lidarNew) {
+                    addSensorObjects(instance, fused.lidar->objects, &numObjects);
+                }
+            }
+            if (fused.vision != NULL) {
+                trigger.event(FUSION_EVENT_VISION, fused.vision->tArrival);
             }
-            retcode = Vision_VisionSensor_reader->return_loan(vision_data_seq, info_seq);
-            if (retcode != DDS_RETCODE_OK) {
-                printf("return loan error %d\n", retcode);
+            if (lidarNew) {
+                trigger.event(FUSION_EVENT_LIDAR, fused.lidar->tArrival);
             }
-            
+            if (fused.stamp > measurementTime) {
+                measurementTime = fused.stamp;
+            }
+        }
+
+        tNow = fusionNow();
+        if (!trigger.due(tNow)) {
+            continue;
+        }
+
+        /* the confirmed tracks, when tracking, as of the last update */
+        if (tracker != NULL) {
+            tracker->tracks(tracked);
+            addSensorObjects(instance, tracked, &numObjects);
+            measurementTime = tracker->stamp();
+        }
+
+        /* set the timestamp: the measurement time of the data, or now
+           if there is none */
+        if (measurementTime != 0) {
+            instance->timestamp.s = (DDS_Long)(measurementTime / 1000000000);
+            instance->timestamp.ns = (DDS_Long)(measurementTime % 1000000000);
+        }
+        else {
+            TimestampUtil::getTimestamp(&(instance->timestamp.s), &(instance->timestamp.ns));
         }
-        /* set the sequence length to as many as we actually have */
-        instance->objects.length(numObjects);
 
         /* And publish it*/
         retcode = Sensor_SensorObjectList_writer->write(*instance, instance_handle);
@@ -461,10 +1082,33 @@ extern "C" int publisher_main(int sample_count)
             printf("write error %d\n", retcode);
         }
 
-        /* Wait*/
-        NDDSUtility::sleep(send_period);
+        /* time from the data that triggered the publish to its write */
+        if (trigger.eventTime() != 0) {
+            uint64_t latency = fusionNow() - trigger.eventTime();
+            latencySum += latency;
+            if (latency > latencyMax) {
+                latencyMax = latency;
+            }
+        }
+        trigger.published(tNow);
+        numObjects = 0;
+        measurementTime = 0;
+        instance->objects.length(0);
+        ++count;
     }
 
+    if ((trigger.policy() != FUSION_ON_INTERVAL) && (count > 0)) {
+        printf("Published %d samples, event to write: mean %.1f us, max %.1f us\n",
+            count, ((double)latencySum / count) / 1000.0, (double)latencyMax / 1000.0);
+    }
+    printf("Vision frames: %llu paired with a LiDAR sweep, %llu unpaired, %llu dropped; "
+        "LiDAR frames on their own: %llu\n",
+        (unsigned long long)sync->paired(), (unsigned long long)sync->unpaired(),
+        (unsigned long long)sync->dropped(), (unsigned long long)sync->lidarAlone());
+
+    waitset->detach_condition(lidar_frame_condition);
+    waitset->detach_condition(vision_status_condition);
+    delete waitset;
 
     /* Delete data sample */
     retcode = Sensor_SensorObjectListTypeSupport::delete_data(instance);
@@ -472,8 +1116,16 @@ extern "C" int publisher_main(int sample_count)
         printf("Sensor_SensorObjectListTypeSupport::delete_data error %d\n", retcode);
     }
 
-    /* Delete all entities */
-    return shutdown(participant);
+    /* Delete all entities (the LiDAR listener is not called anymore
+       once they are gone, so its condition can go too) */
+    status = shutdown(participant);
+    delete lidar_frame_condition;
+    delete sync;
+    delete tracker;
+    delete geometry_listener;
+    delete lidar_listener;
+    delete vision_listener;
+    return status;
 }
 
 int main(int argc, char *argv[])
@@ -0,0 +1,205 @@
+/** ------------------------------------------------------------------------
+ * taskPool.cxx
+ * Work-stealing pool of threads for sensor fusion.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include "taskPool.h"
+
+/** --------------------------------------------------------
+ * TaskPool
+ **/
+TaskPool::TaskPool(int threads) :
+    _fn(NULL), _arg(NULL), _taskCount(0), _tasksDone(0), _active(0),
+    _run(0), _stop(false)
+{
+    if (threads <= 0) {
+        threads = (int)std::thread::hardware_concurrency();
+        if (threads <= 0) {
+            threads = 1;
+        }
+    }
+    _ranges = new taskRange[threads];
+    for (int i = 0; i < threads; i++) {
+        _ranges[i].begin = _ranges[i].end = 0;
+        _ranges[i].steals = 0;
+    }
+    // the thread calling run() is thread 0
+    for (int i = 1; i < threads; i++) {
+        _threads.push_back(std::thread(&TaskPool::worker, this, i));
+    }
+}
+
+TaskPool::~TaskPool()
+{
+    {
+        std::lock_guard<std::mutex> guard(_lock);
+        _stop = true;
+    }
+    _startCv.notify_all();
+    for (size_t i = 0; i < _threads.size(); i++) {
+        _threads[i].join();
+    }
+    delete[] _ranges;
+}
+
+/** --------------------------------------------------------
+ * steal()
+ * take the back half of the range of the thread with the most tasks
+ * left, run the first of them now and keep the rest as our own range;
+ * false if every range is empty
+ **/
+bool TaskPool::steal(int thread, int *task)
+{
+    int threads = threadCount();
+    while (1) {
+        // the victim: a look without the locks is good enough to choose
+        int victim = -1;
+        int most = 0;
+        for (int i = 1; i < threads; i++) {
+            int other = (thread + i) % threads;
+            int left = _ranges[other].end - _ranges[other].begin;
+            if (left > most) {
+                most = left;
+                victim = other;
+            }
+        }
+        if (victim < 0) {
+            return false;
+        }
+
+        int first, last;
+        {
+            std::lock_guard<std::mutex> guard(_ranges[victim].lock);
+            int left = _ranges[victim].end - _ranges[victim].begin;
+            if (left <= 0) {
+                continue;       // emptied meanwhile: look again
+            }
+            last = _ranges[victim].end;
+            first = last - ((left + 1) / 2);
+            _ranges[victim].end = first;
+        }
+        std::lock_guard<std::mutex> guard(_ranges[thread].lock);
+        _ranges[thread].begin = first + 1;
+        _ranges[thread].end = last;
+        _ranges[thread].steals++;
+        *task = first;
+        return true;
+    }
+}
+
+/** --------------------------------------------------------
+ * nextTask()
+ * the next task of our own range, or a stolen one
+ **/
+bool TaskPool::nextTask(int thread, int *task)
+{
+    {
+        std::lock_guard<std::mutex> guard(_ranges[thread].lock);
+        if (_ranges[thread].begin < _ranges[thread].end) {
+            *task = _ranges[thread].begin++;
+            return true;
+        }
+    }
+    return steal(thread, task);
+}
+
+/** --------------------------------------------------------
+ * runTasks()
+ * run tasks until there are none left; returns how many were run
+ **/
+int TaskPool::runTasks(int thread)
+{
+    int done = 0;
+    int task;
+    while (nextTask(thread, &task)) {
+        _fn(task, thread, _arg);
+        done++;
+    }
+    return done;
+}
+
+/** --------------------------------------------------------
+ * worker()
+ * wait for a run, help with it, repeat
+ **/
+void TaskPool::worker(int thread)
+{
+    unsigned int lastRun = 0;
+    std::unique_lock<std::mutex> lock(_lock);
+    while (1) {
+        while (!_stop && (_run == lastRun)) {
+            _startCv.wait(lock);
+        }
+        if (_stop) {
+            return;
+        }
+        lastRun = _run;
+        _active++;
+        lock.unlock();
+
+        int done = runTasks(thread);
+
+        lock.lock();
+        _tasksDone += done;
+        _active--;
+        _doneCv.notify_all();
+    }
+}
+
+/** --------------------------------------------------------
+ * run()
+ **/
+void TaskPool::run(int taskCount, taskFn fn, void *arg)
+{
+    int threads = threadCount();
+    if (threads == 1) {
+        for (int task = 0; task < taskCount; task++) {
+            fn(task, 0, arg);
+        }
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(_lock);
+    // a worker that woke up too late for the last run may still be on
+    // its way out; the run parameters can't change under it.
+    while (_active != 0) {
+        _doneCv.wait(lock);
+    }
+    _fn = fn;
+    _arg = arg;
+    _taskCount = taskCount;
+    _tasksDone = 0;
+    for (int i = 0; i < threads; i++) {
+        std::lock_guard<std::mutex> guard(_ranges[i].lock);
+        _ranges[i].begin = (int)(((long long)taskCount * i) / threads);
+        _ranges[i].end = (int)(((long long)taskCount * (i + 1)) / threads);
+    }
+    _run++;
+    lock.unlock();
+    _startCv.notify_all();
+
+    int done = runTasks(0);
+
+    lock.lock();
+    _tasksDone += done;
+    while ((_tasksDone < _taskCount) || (_active != 0)) {
+        _doneCv.wait(lock);
+    }
+}
+
+long TaskPool::steals(void) const
+{
+    long steals = 0;
+    for (int i = 0; i < threadCount(); i++) {
+        steals += _ranges[i].steals;
+    }
+    return steals;
+}
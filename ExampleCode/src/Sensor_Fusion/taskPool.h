@@ -0,0 +1,81 @@
+/** ------------------------------------------------------------------------
+ * taskPool.h
+ * Work-stealing pool of threads for the sensor fusion stages that split
+ * into many tasks of uneven size (e.g. the grid partitions of a LiDAR
+ * cloud: some are empty, some hold a whole car).
+ * run() deals the tasks out as one range per thread, the calling thread
+ * included.  A thread takes its tasks from the front of its own range;
+ * once that is empty, it steals the back half of the range of another
+ * thread, so the threads that drew the small tasks end up helping the
+ * others instead of waiting for them.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef taskPool_h
+#define taskPool_h
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// runs one task; 'thread' (0..threadCount()-1) is the thread running it,
+// for per-thread work buffers.  0 is the thread that called run().
+typedef void (*taskFn)(int task, int thread, void *arg);
+
+class TaskPool {
+
+private:
+    // the tasks a thread has left: [begin, end), changed under the lock
+    // (atomic so that thieves can look for the fullest range without it).
+    // Padded, so the ranges of two threads are not in the same cache line.
+    typedef struct {
+        std::mutex          lock;
+        std::atomic<int>    begin;
+        std::atomic<int>    end;
+        long                steals;     // ranges this thread stole
+        char                pad[64];
+    } taskRange;
+
+    std::vector<std::thread> _threads;
+    taskRange               *_ranges;   // per thread
+    std::mutex              _lock;
+    std::condition_variable _startCv;   // a new run was posted (or stop)
+    std::condition_variable _doneCv;    // a worker left the run
+    taskFn                  _fn;
+    void                    *_arg;
+    int                     _taskCount;
+    int                     _tasksDone;
+    int                     _active;    // workers inside runTasks()
+    unsigned int            _run;       // incremented for every run()
+    bool                    _stop;
+
+    void worker(int thread);
+    int  runTasks(int thread);
+    bool nextTask(int thread, int *task);
+    bool steal(int thread, int *task);
+
+public:
+    // 'threads' includes the thread calling run(); 0 uses one per core
+    TaskPool(int threads);
+    ~TaskPool();
+
+    int threadCount(void) const { return (int)_threads.size() + 1; }
+
+    // call fn(task, thread, arg) for task 0..taskCount-1, return when
+    // all are done
+    void run(int taskCount, taskFn fn, void *arg);
+
+    // ranges stolen so far, by all the threads (between runs)
+    long steals(void) const;
+};
+
+#endif  // ndef taskPool_h
@@ -0,0 +1,174 @@
+/** ------------------------------------------------------------------------
+ * latencyHistogram.cxx
+ * Log-linear (HDR-style) histogram of latencies in nanoseconds.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <string.h>
+#include "latencyHistogram.h"
+
+LatencyHistogram::LatencyHistogram()
+{
+    reset();
+}
+
+void LatencyHistogram::reset()
+{
+    memset(_counts, 0, sizeof(_counts));
+    _count = 0;
+    _min = (uint64_t)-1;
+    _max = 0;
+    _sum = 0.0;
+}
+
+/** --------------------------------------------------------
+ * bucketOf()
+ * Values under LHIST_SUB_COUNT are their own bucket.  Above that, a
+ * value whose top bit is bit 'msb' is shifted right by
+ * (msb - LHIST_SUB_BITS + 1) to keep its top LHIST_SUB_BITS bits, which
+ * fall in the upper half of the sub-buckets; each shift adds another
+ * LHIST_HALF_COUNT buckets.
+ **/
+int LatencyHistogram::bucketOf(uint64_t ns)
+{
+    if (ns < LHIST_SUB_COUNT) {
+        return (int)ns;
+    }
+    int msb = 0;
+    for (uint64_t v = ns; v > 1; v >>= 1) {
+        msb++;
+    }
+    int shift = msb - LHIST_SUB_BITS + 1;
+    return (shift * LHIST_HALF_COUNT) + (int)(ns >> shift);
+}
+
+uint64_t LatencyHistogram::bucketLow(int index)
+{
+    if (index < LHIST_SUB_COUNT) {
+        return (uint64_t)index;
+    }
+    int shift = (index / LHIST_HALF_COUNT) - 1;
+    uint64_t sub = (uint64_t)(index - (shift * LHIST_HALF_COUNT));
+    return (sub << shift);
+}
+
+uint64_t LatencyHistogram::bucketHigh(int index)
+{
+    if (index < LHIST_SUB_COUNT) {
+        return (uint64_t)index;
+    }
+    int shift = (index / LHIST_HALF_COUNT) - 1;
+    return bucketLow(index) + (((uint64_t)1 << shift) - 1);
+}
+
+void LatencyHistogram::record(uint64_t ns)
+{
+    _counts[bucketOf(ns)]++;
+    _count++;
+    if (ns < _min) _min = ns;
+    if (ns > _max) _max = ns;
+    _sum += (double)ns;
+}
+
+void LatencyHistogram::add(const LatencyHistogram &other)
+{
+    for (int i = 0; i < LHIST_BUCKETS; i++) {
+        _counts[i] += other._counts[i];
+    }
+    _count += other._count;
+    if (other._min < _min) _min = other._min;
+    if (other._max > _max) _max = other._max;
+    _sum += other._sum;
+}
+
+uint64_t LatencyHistogram::percentile(double p) const
+{
+    if (_count == 0) {
+        return 0;
+    }
+    // rank of the sample at p, counted from 1
+    uint64_t rank = (uint64_t)(((p / 100.0) * _count) + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > _count) rank = _count;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < LHIST_BUCKETS; i++) {
+        seen += _counts[i];
+        if (seen >= rank) {
+            uint64_t high = bucketHigh(i);
+            return ((high < _max) ? high : _max);
+        }
+    }
+    return _max;
+}
+
+void LatencyHistogram::print(FILE *out, const char *label) const
+{
+    fprintf(out, "%s N:%llu min: %2.7f avg: %2.7f p50: %2.7f p90: %2.7f p99: %2.7f p99.9: %2.7f max: %2.7f\n",
+        label, (unsigned long long)_count,
+        (double)min() / 1000000000,
+        mean() / 1000000000,
+        (double)percentile(50.0) / 1000000000,
+        (double)percentile(90.0) / 1000000000,
+        (double)percentile(99.0) / 1000000000,
+        (double)percentile(99.9) / 1000000000,
+        (double)max() / 1000000000);
+}
+
+bool LatencyHistogram::dumpCsv(const char *fileName) const
+{
+    FILE *out = fopen(fileName, "w");
+    if (out == NULL) {
+        fprintf(stderr, "can't write %s (%s:%d)\n", fileName, __FILE__, __LINE__);
+        return false;
+    }
+    fprintf(out, "low_ns,high_ns,count,cumulative\n");
+    uint64_t seen = 0;
+    for (int i = 0; i < LHIST_BUCKETS; i++) {
+        if (_counts[i] == 0) {
+            continue;
+        }
+        seen += _counts[i];
+        fprintf(out, "%llu,%llu,%llu,%.6f\n",
+            (unsigned long long)bucketLow(i), (unsigned long long)bucketHigh(i),
+            (unsigned long long)_counts[i], (double)seen / _count);
+    }
+    fclose(out);
+    return true;
+}
+
+bool LatencyHistogram::dumpJson(const char *fileName, const char *label) const
+{
+    FILE *out = fopen(fileName, "w");
+    if (out == NULL) {
+        fprintf(stderr, "can't write %s (%s:%d)\n", fileName, __FILE__, __LINE__);
+        return false;
+    }
+    fprintf(out, "{\n  \"label\": \"%s\",\n  \"count\": %llu,\n", label, (unsigned long long)_count);
+    fprintf(out, "  \"min_ns\": %llu,\n  \"mean_ns\": %.1f,\n",
+        (unsigned long long)min(), mean());
+    fprintf(out, "  \"p50_ns\": %llu,\n  \"p90_ns\": %llu,\n  \"p99_ns\": %llu,\n  \"p99_9_ns\": %llu,\n",
+        (unsigned long long)percentile(50.0), (unsigned long long)percentile(90.0),
+        (unsigned long long)percentile(99.0), (unsigned long long)percentile(99.9));
+    fprintf(out, "  \"max_ns\": %llu,\n  \"buckets\": [", (unsigned long long)max());
+    const char *sep = "\n";
+    for (int i = 0; i < LHIST_BUCKETS; i++) {
+        if (_counts[i] == 0) {
+            continue;
+        }
+        fprintf(out, "%s    { \"low_ns\": %llu, \"high_ns\": %llu, \"count\": %llu }", sep,
+            (unsigned long long)bucketLow(i), (unsigned long long)bucketHigh(i),
+            (unsigned long long)_counts[i]);
+        sep = ",\n";
+    }
+    fprintf(out, "\n  ]\n}\n");
+    fclose(out);
+    return true;
+}
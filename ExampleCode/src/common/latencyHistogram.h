@@ -0,0 +1,66 @@
+/** ------------------------------------------------------------------------
+ * latencyHistogram.h
+ * Log-linear (HDR-style) histogram of latencies in nanoseconds.
+ * Values below 2^LHIST_SUB_BITS are counted exactly; above that, every
+ * power of two is split into 2^(LHIST_SUB_BITS-1) equal buckets, so a
+ * value is known to better than 1 part in 64 (1.6%) from 1 ns up to
+ * 2^64 ns, in a fixed table of counters (no allocation when recording).
+ * Percentiles are reported as the top of their bucket.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef latencyHistogram_h
+#define latencyHistogram_h
+
+#include <stdio.h>
+#include <stdint.h>
+
+#define LHIST_SUB_BITS      (7)
+#define LHIST_SUB_COUNT     (1 << LHIST_SUB_BITS)
+#define LHIST_HALF_COUNT    (LHIST_SUB_COUNT / 2)
+#define LHIST_BUCKETS       ((64 - LHIST_SUB_BITS + 2) * LHIST_HALF_COUNT)
+
+class LatencyHistogram {
+public:
+    LatencyHistogram();
+
+    // add one latency (nanoseconds)
+    void record(uint64_t ns);
+    // add all the counts of another histogram
+    void add(const LatencyHistogram &other);
+    void reset();
+
+    uint64_t count() const { return _count; }
+    uint64_t min() const { return (_count ? _min : 0); }
+    uint64_t max() const { return _max; }
+    double mean() const { return (_count ? ((double)_sum / _count) : 0.0); }
+    // latency at percentile p (0.0 .. 100.0); 0 if empty
+    uint64_t percentile(double p) const;
+
+    // one line: N, min, mean, p50, p90, p99, p99.9 and max, in seconds
+    void print(FILE *out, const char *label) const;
+    // the non-empty buckets: low_ns,high_ns,count,cumulative
+    bool dumpCsv(const char *fileName) const;
+    // the summary and the non-empty buckets
+    bool dumpJson(const char *fileName, const char *label) const;
+
+private:
+    static int bucketOf(uint64_t ns);
+    static uint64_t bucketLow(int index);
+    static uint64_t bucketHigh(int index);
+
+    uint64_t    _counts[LHIST_BUCKETS];
+    uint64_t    _count;
+    uint64_t    _min;
+    uint64_t    _max;
+    double      _sum;           // double: no overflow on long runs
+};
+
+#endif  // ndef latencyHistogram_h
@@ -0,0 +1,443 @@
+/** ------------------------------------------------------------------------
+ * pointCodec.cxx
+ * Lossless compression of PointCloud2 point data.
+ *
+ * Coded data:
+ *   header     magic, raw bytes, column points (uint32's), stride (uint16),
+ *              wordBytes[stride]
+ *   planes     'stride' of them: mode (uint8), payload bytes (uint32),
+ *              payload
+ * A rANS payload is the symbol count (uint8, 0 = 256), the symbol and
+ * frequency (uint8, uint16) of each, the final coder state (uint32)
+ * and the renormalization bytes.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <string.h>
+#include "pointCodec.h"
+
+#define PCODEC_MAGIC        (0x315a4350)    // "PCZ1"
+#define PCODEC_PLANE_RAW    (0)
+#define PCODEC_PLANE_RANS   (1)
+
+#define RANS_PROB_BITS      (12)
+#define RANS_PROB_SCALE     (1 << RANS_PROB_BITS)
+#define RANS_LOW            (1u << 23)      // state is kept in [RANS_LOW, RANS_LOW << 8)
+#define RANS_TABLE_MAX      (1 + (256 * 3))
+
+static inline void put16(uint8_t *p, uint16_t v) { memcpy(p, &v, sizeof(v)); }
+static inline void put32(uint8_t *p, uint32_t v) { memcpy(p, &v, sizeof(v)); }
+static inline uint16_t get16(const uint8_t *p) { uint16_t v; memcpy(&v, p, sizeof(v)); return v; }
+static inline uint32_t get32(const uint8_t *p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+/** --------------------------------------------------------
+ * datatypeBytes()
+ * size of a PointField datatype (ROS codes, plus 9 for float16)
+ **/
+static int datatypeBytes(int datatype)
+{
+    switch (datatype) {
+        case 1: case 2:             return 1;   // int8, uint8
+        case 3: case 4: case 9:     return 2;   // int16, uint16, float16
+        case 5: case 6: case 7:     return 4;   // int32, uint32, float32
+        case 8:                     return 8;   // float64
+        default:                    return 1;
+    }
+}
+
+bool pointCodecLayoutFromSample(const sensor_msgs_msg_dds__PointCloud2_ *sample,
+    pointCodecLayout *layout)
+{
+    int stride = (int)sample->point_step_;
+    if ((stride <= 0) || (stride > PCODEC_STRIDE_MAX)) {
+        return false;
+    }
+    layout->stride = stride;
+    layout->columnPoints = (sample->width_ > 0) ? (int)sample->width_ : 1;
+    memset(layout->wordBytes, 1, stride);
+    for (int f = 0; f < sample->fields_.length(); f++) {
+        int size = datatypeBytes(sample->fields_[f].datatype_);
+        int offset = (int)sample->fields_[f].offset_;
+        for (int c = 0; c < (int)sample->fields_[f].count_; c++, offset += size) {
+            if ((offset + size) > stride) {
+                break;
+            }
+            layout->wordBytes[offset] = (uint8_t)size;
+            memset(&layout->wordBytes[offset + 1], 0, size - 1);
+        }
+    }
+    return true;
+}
+
+/** --------------------------------------------------------
+ * deltaShuffle() / unshuffleDelta()
+ * column delta and byte shuffle of one word (of type T) of every point,
+ * and the reverse
+ **/
+template<typename T>
+static void deltaShuffle(const uint8_t *raw, int points, int stride, int offset,
+    int columnPoints, uint8_t *planes)
+{
+    T prev = 0;
+    int col = 0;
+    uint8_t *plane = &planes[(size_t)offset * points];
+    for (int i = 0; i < points; i++, raw += stride) {
+        T v;
+        memcpy(&v, &raw[offset], sizeof(T));
+        T d = (col != 0) ? (T)(v - prev) : v;
+        prev = v;
+        if (++col == columnPoints) {
+            col = 0;
+        }
+        uint8_t b[sizeof(T)];
+        memcpy(b, &d, sizeof(T));
+        for (size_t k = 0; k < sizeof(T); k++) {
+            plane[(k * points) + i] = b[k];
+        }
+    }
+}
+
+template<typename T>
+static void unshuffleDelta(const uint8_t *planes, int points, int stride, int offset,
+    int columnPoints, uint8_t *raw)
+{
+    T prev = 0;
+    int col = 0;
+    const uint8_t *plane = &planes[(size_t)offset * points];
+    for (int i = 0; i < points; i++, raw += stride) {
+        uint8_t b[sizeof(T)];
+        for (size_t k = 0; k < sizeof(T); k++) {
+            b[k] = plane[(k * points) + i];
+        }
+        T d;
+        memcpy(&d, b, sizeof(T));
+        T v = (col != 0) ? (T)(prev + d) : d;
+        prev = v;
+        if (++col == columnPoints) {
+            col = 0;
+        }
+        memcpy(&raw[offset], &v, sizeof(T));
+    }
+}
+
+/** --------------------------------------------------------
+ * normalizeFreqs()
+ * scale byte counts of 'n' symbols to frequencies that add up to
+ * RANS_PROB_SCALE, keeping every symbol that occurs at 1 or more
+ **/
+static void normalizeFreqs(const uint32_t *counts, int n, uint32_t *freqs)
+{
+    int sum = 0;
+    for (int s = 0; s < 256; s++) {
+        freqs[s] = 0;
+        if (counts[s] != 0) {
+            freqs[s] = (uint32_t)(((uint64_t)counts[s] * RANS_PROB_SCALE) / n);
+            if (freqs[s] == 0) {
+                freqs[s] = 1;
+            }
+            sum += freqs[s];
+        }
+    }
+    // take from (or give to) the most frequent symbols
+    while (sum != RANS_PROB_SCALE) {
+        int best = -1;
+        for (int s = 0; s < 256; s++) {
+            if ((freqs[s] > ((sum > RANS_PROB_SCALE) ? 1u : 0u)) && ((best < 0) || (freqs[s] > freqs[best]))) {
+                best = s;
+            }
+        }
+        if (sum > RANS_PROB_SCALE) {
+            freqs[best]--;
+            sum--;
+        }
+        else {
+            freqs[best]++;
+            sum++;
+        }
+    }
+}
+
+/** --------------------------------------------------------
+ * ransEncode()
+ * code 'n' bytes into 'out' (table, state, stream); returns the size,
+ * or 0 if it would not be smaller than 'n'.  'out' needs n + RANS_TABLE_MAX
+ * bytes, and 'tmp' 2n + 8.
+ **/
+static int ransEncode(const uint8_t *in, int n, uint8_t *out, uint8_t *tmp)
+{
+    uint32_t counts[256] = { 0 };
+    uint32_t freqs[256];
+    uint32_t starts[256];
+    for (int i = 0; i < n; i++) {
+        counts[in[i]]++;
+    }
+    normalizeFreqs(counts, n, freqs);
+
+    // symbol table
+    uint8_t *p = out + 1;
+    int symbols = 0;
+    uint32_t start = 0;
+    for (int s = 0; s < 256; s++) {
+        starts[s] = start;
+        start += freqs[s];
+        if (freqs[s] != 0) {
+            p[0] = (uint8_t)s;
+            put16(&p[1], (uint16_t)freqs[s]);
+            p += 3;
+            symbols++;
+        }
+    }
+    out[0] = (uint8_t)symbols;          // 256 --> 0
+    int tableBytes = (int)(p - out);
+
+    // code backwards, so that the decoder reads forwards
+    uint8_t *end = tmp + (2 * n) + 8;
+    uint8_t *ptr = end;
+    uint32_t x = RANS_LOW;
+    for (int i = n - 1; i >= 0; i--) {
+        uint32_t f = freqs[in[i]];
+        uint32_t xMax = ((RANS_LOW >> RANS_PROB_BITS) << 8) * f;
+        while (x >= xMax) {
+            *--ptr = (uint8_t)(x & 0xff);
+            x >>= 8;
+        }
+        x = ((x / f) << RANS_PROB_BITS) + (x % f) + starts[in[i]];
+    }
+    ptr -= 4;
+    put32(ptr, x);
+
+    int codedBytes = (int)(end - ptr);
+    if ((tableBytes + codedBytes) >= n) {
+        return 0;
+    }
+    memcpy(p, ptr, codedBytes);
+    return tableBytes + codedBytes;
+}
+
+/** --------------------------------------------------------
+ * ransDecode()
+ * decode 'n' bytes from the 'inBytes' of 'in'; false if 'in' is bad
+ **/
+static bool ransDecode(const uint8_t *in, int inBytes, uint8_t *out, int n)
+{
+    uint32_t freqs[256] = { 0 };
+    uint32_t starts[256];
+    uint8_t slotSymbol[RANS_PROB_SCALE];
+
+    if (inBytes < 1) {
+        return false;
+    }
+    int symbols = (in[0] == 0) ? 256 : in[0];
+    const uint8_t *p = in + 1;
+    const uint8_t *end = in + inBytes;
+    if ((end - p) < ((symbols * 3) + 4)) {
+        return false;
+    }
+    for (int i = 0; i < symbols; i++, p += 3) {
+        freqs[p[0]] = get16(&p[1]);
+    }
+    uint32_t start = 0;
+    for (int s = 0; s < 256; s++) {
+        starts[s] = start;
+        if ((start + freqs[s]) > RANS_PROB_SCALE) {
+            return false;
+        }
+        memset(&slotSymbol[start], s, freqs[s]);
+        start += freqs[s];
+    }
+    if (start != RANS_PROB_SCALE) {
+        return false;
+    }
+
+    uint32_t x = get32(p);
+    p += 4;
+    for (int i = 0; i < n; i++) {
+        uint32_t slot = x & (RANS_PROB_SCALE - 1);
+        uint8_t s = slotSymbol[slot];
+        out[i] = s;
+        x = (freqs[s] * (x >> RANS_PROB_BITS)) + slot - starts[s];
+        while (x < RANS_LOW) {
+            if (p >= end) {
+                return false;
+            }
+            x = (x << 8) | *p++;
+        }
+    }
+    return true;
+}
+
+/** --------------------------------------------------------
+ * PointCodec
+ **/
+int PointCodec::encode(const uint8_t *raw, int rawBytes, const pointCodecLayout *layout,
+    uint8_t *out, int outMax)
+{
+    int stride = layout->stride;
+    int headerBytes = 14 + stride;
+    if ((rawBytes <= 0) || ((rawBytes % stride) != 0)) {
+        return 0;
+    }
+    int points = rawBytes / stride;
+    _planes.resize(rawBytes);
+    _coded.resize((3 * (size_t)points) + RANS_TABLE_MAX + 8);
+
+    // delta and shuffle
+    for (int off = 0; off < stride; off++) {
+        switch (layout->wordBytes[off]) {
+            case 1:
+                deltaShuffle<uint8_t>(raw, points, stride, off, layout->columnPoints, &_planes[0]);
+                break;
+            case 2:
+                deltaShuffle<uint16_t>(raw, points, stride, off, layout->columnPoints, &_planes[0]);
+                break;
+            case 4:
+                deltaShuffle<uint32_t>(raw, points, stride, off, layout->columnPoints, &_planes[0]);
+                break;
+            case 8:
+                deltaShuffle<uint64_t>(raw, points, stride, off, layout->columnPoints, &_planes[0]);
+                break;
+            default:
+                break;      // inside a word
+        }
+    }
+
+    // header
+    if (outMax < headerBytes) {
+        return 0;
+    }
+    put32(&out[0], PCODEC_MAGIC);
+    put32(&out[4], (uint32_t)rawBytes);
+    put32(&out[8], (uint32_t)layout->columnPoints);
+    put16(&out[12], (uint16_t)stride);
+    memcpy(&out[14], layout->wordBytes, stride);
+    int size = headerBytes;
+
+    // entropy code the planes
+    for (int b = 0; b < stride; b++) {
+        const uint8_t *plane = &_planes[(size_t)b * points];
+        const uint8_t *payload = &_coded[0];
+        int coded = ransEncode(plane, points, &_coded[0], &_coded[points + RANS_TABLE_MAX]);
+        uint8_t mode = PCODEC_PLANE_RANS;
+        if (coded == 0) {
+            mode = PCODEC_PLANE_RAW;
+            payload = plane;
+            coded = points;
+        }
+        if ((size + 5 + coded) > outMax) {
+            return 0;
+        }
+        out[size] = mode;
+        put32(&out[size + 1], (uint32_t)coded);
+        memcpy(&out[size + 5], payload, coded);
+        size += 5 + coded;
+    }
+    return (size < rawBytes) ? size : 0;
+}
+
+int PointCodec::decode(const uint8_t *in, int inBytes, uint8_t *raw, int rawMax)
+{
+    if ((inBytes < 14) || (get32(&in[0]) != PCODEC_MAGIC)) {
+        return -1;
+    }
+    int rawBytes = (int)get32(&in[4]);
+    int columnPoints = (int)get32(&in[8]);
+    int stride = get16(&in[12]);
+    if ((stride == 0) || (stride > PCODEC_STRIDE_MAX) || (columnPoints <= 0)
+        || (rawBytes <= 0) || (rawBytes > rawMax) || ((rawBytes % stride) != 0)
+        || (inBytes < (14 + stride))) {
+        return -1;
+    }
+    // the word sizes come from the sample: each word has to be inside
+    // the point, or unshuffleDelta() would write past it
+    const uint8_t *wordBytes = &in[14];
+    for (int off = 0; off < stride; off++) {
+        int bytes = wordBytes[off];
+        if (((bytes != 0) && (bytes != 1) && (bytes != 2) && (bytes != 4) && (bytes != 8))
+            || ((off + bytes) > stride)) {
+            return -1;
+        }
+    }
+    int points = rawBytes / stride;
+    _planes.resize(rawBytes);
+
+    // entropy decode the planes
+    int pos = 14 + stride;
+    for (int b = 0; b < stride; b++) {
+        if ((pos + 5) > inBytes) {
+            return -1;
+        }
+        int mode = in[pos];
+        int coded = (int)get32(&in[pos + 1]);
+        pos += 5;
+        if ((coded < 0) || (coded > (inBytes - pos))) {
+            return -1;
+        }
+        uint8_t *plane = &_planes[(size_t)b * points];
+        if (mode == PCODEC_PLANE_RAW) {
+            if (coded != points) {
+                return -1;
+            }
+            memcpy(plane, &in[pos], points);
+        }
+        else if ((mode != PCODEC_PLANE_RANS) || !ransDecode(&in[pos], coded, plane, points)) {
+            return -1;
+        }
+        pos += coded;
+    }
+
+    // unshuffle and undo the deltas
+    for (int off = 0; off < stride; off++) {
+        switch (wordBytes[off]) {
+            case 1:
+                unshuffleDelta<uint8_t>(&_planes[0], points, stride, off, columnPoints, raw);
+                break;
+            case 2:
+                unshuffleDelta<uint16_t>(&_planes[0], points, stride, off, columnPoints, raw);
+                break;
+            case 4:
+                unshuffleDelta<uint32_t>(&_planes[0], points, stride, off, columnPoints, raw);
+                break;
+            case 8:
+                unshuffleDelta<uint64_t>(&_planes[0], points, stride, off, columnPoints, raw);
+                break;
+            default:
+                break;
+        }
+    }
+    return rawBytes;
+}
+
+/** --------------------------------------------------------
+ * pointCloudIsCompressed() / pointCloudData()
+ **/
+bool pointCloudIsCompressed(const sensor_msgs_msg_dds__PointCloud2_ *sample)
+{
+    return ((sample->data_.length() >= 4)
+        && ((DDS_UnsignedLong)sample->data_.length() != (sample->row_step_ * sample->height_))
+        && (get32((const uint8_t *)&sample->data_[0]) == PCODEC_MAGIC));
+}
+
+const uint8_t *pointCloudData(const sensor_msgs_msg_dds__PointCloud2_ *sample,
+    PointCodec *codec, std::vector<uint8_t> &buf)
+{
+    if (sample->data_.length() == 0) {
+        return NULL;
+    }
+    const uint8_t *data = (const uint8_t *)&sample->data_[0];
+    int rawBytes = (int)(sample->row_step_ * sample->height_);
+    if (sample->data_.length() == rawBytes) {
+        return data;
+    }
+    buf.resize(rawBytes);
+    if ((rawBytes == 0) || (codec->decode(data, sample->data_.length(), &buf[0], rawBytes) != rawBytes)) {
+        return NULL;
+    }
+    return &buf[0];
+}
@@ -0,0 +1,93 @@
+/** ------------------------------------------------------------------------
+ * pointCodec.h
+ * Lossless compression of PointCloud2 point data.
+ * Points are coded in three steps:
+ *   - delta: each field (as an integer of its own size) is replaced by
+ *     its difference from the same field of the previous point of the
+ *     scan column (PointCloud2 row); the first point of a column is kept.
+ *   - shuffle: byte N of every point is gathered in plane N, so that
+ *     the (mostly zero) high bytes of the deltas end up together.
+ *   - entropy: each plane is rANS coded with its own byte frequencies,
+ *     or stored as is if that is not smaller.
+ * A compressed sample has a data_ length that is not row_step * height
+ * (which it always is when not compressed); its data_ starts with a
+ * header that holds everything needed to decode it.  Data is coded in
+ * the host byte order, like the points themselves.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef pointCodec_h
+#define pointCodec_h
+
+#include <stdint.h>
+#include <vector>
+#include "automotive.h"
+
+#define PCODEC_STRIDE_MAX   (256)   // largest point_step that can be coded
+
+/** --------------------------------------------------------
+ * pointCodecLayout
+ * the words of a point: wordBytes[i] is the size (1, 2, 4 or 8) of the
+ * field word that starts at byte i, or 0 inside a word.  Bytes that
+ * are not part of a field are 1-byte words.
+ **/
+typedef struct {
+    int         stride;         // bytes per point (point_step)
+    int         columnPoints;   // points per scan column (width)
+    uint8_t     wordBytes[PCODEC_STRIDE_MAX];
+} pointCodecLayout;
+
+/** --------------------------------------------------------
+ * pointCodecLayoutFromSample()
+ * the layout of the points of a PointCloud2 sample, from its fields.
+ * Returns false if the points can't be coded (point_step too big).
+ **/
+bool pointCodecLayoutFromSample(const sensor_msgs_msg_dds__PointCloud2_ *sample,
+    pointCodecLayout *layout);
+
+/** --------------------------------------------------------
+ * PointCodec
+ * Encoder / decoder; holds the work buffers, so keep one per thread
+ * and reuse it for every frame.
+ **/
+class PointCodec {
+
+private:
+    std::vector<uint8_t>    _planes;    // shuffled deltas, plane by plane
+    std::vector<uint8_t>    _coded;     // rANS output of one plane (written backwards)
+
+public:
+    // code 'rawBytes' of points into 'out'; returns the coded size, or 0
+    // if it would not fit in 'outMax' bytes or not be smaller than raw
+    int encode(const uint8_t *raw, int rawBytes, const pointCodecLayout *layout,
+        uint8_t *out, int outMax);
+
+    // decode 'in' into 'raw'; returns the raw size, or -1 if 'in' is not
+    // valid coded data or the raw data is larger than 'rawMax'
+    int decode(const uint8_t *in, int inBytes, uint8_t *raw, int rawMax);
+};
+
+/** --------------------------------------------------------
+ * pointCloudIsCompressed()
+ * true if the points of 'sample' are compressed
+ **/
+bool pointCloudIsCompressed(const sensor_msgs_msg_dds__PointCloud2_ *sample);
+
+/** --------------------------------------------------------
+ * pointCloudData()
+ * the (uncompressed) points of a received sample: the sample's own data_
+ * if it is not compressed, else the points decoded into 'buf'.
+ * Returns NULL if the data can't be decoded (or is a delta sample: see
+ * PointCloudTracker in pointDelta.h).
+ **/
+const uint8_t *pointCloudData(const sensor_msgs_msg_dds__PointCloud2_ *sample,
+    PointCodec *codec, std::vector<uint8_t> &buf);
+
+#endif  // ndef pointCodec_h
@@ -0,0 +1,170 @@
+/** ------------------------------------------------------------------------
+ * pointDelta.cxx
+ * Keyframe + delta PointCloud2 streams.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <string.h>
+#include "pointDelta.h"
+
+#define PDELTA_MAGIC        (0x31444350)    // "PCD1"
+#define PDELTA_CODED        (0x1)           // flag: rows are coded with PointCodec
+#define PDELTA_HEADER_BYTES (20)
+
+static inline void put32(uint8_t *p, uint32_t v) { memcpy(p, &v, sizeof(v)); }
+static inline uint32_t get32(const uint8_t *p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+int pointDeltaEncode(const uint8_t *raw, int rowBytes, int rows, const uint8_t *changed,
+    int32_t baseSec, uint32_t baseNanosec, PointCodec *codec, const pointCodecLayout *layout,
+    uint8_t *out, int outMax)
+{
+    // runs of changed rows
+    int runs = 0;
+    int changedRows = 0;
+    int pos = PDELTA_HEADER_BYTES;
+    for (int r = 0; r < rows; ) {
+        if (!changed[r]) {
+            r++;
+            continue;
+        }
+        int first = r;
+        while ((r < rows) && changed[r]) {
+            r++;
+        }
+        if ((pos + 8) > outMax) {
+            return 0;
+        }
+        put32(&out[pos], (uint32_t)first);
+        put32(&out[pos + 4], (uint32_t)(r - first));
+        pos += 8;
+        runs++;
+        changedRows += r - first;
+    }
+
+    put32(&out[0], PDELTA_MAGIC);
+    put32(&out[4], 0);
+    put32(&out[8], (uint32_t)baseSec);
+    put32(&out[12], baseNanosec);
+    put32(&out[16], (uint32_t)runs);
+
+    // the rows themselves, gathered after the run table
+    int rowsBytes = changedRows * rowBytes;
+    if ((pos + rowsBytes) > outMax) {
+        return 0;
+    }
+    uint8_t *dst = &out[pos];
+    for (int r = 0; r < rows; r++) {
+        if (changed[r]) {
+            memcpy(dst, &raw[(size_t)r * rowBytes], rowBytes);
+            dst += rowBytes;
+        }
+    }
+    if ((codec != NULL) && (rowsBytes > 0)) {
+        // code them in place of the copy when that is smaller
+        std::vector<uint8_t> coded(rowsBytes);
+        int size = codec->encode(&out[pos], rowsBytes, layout, &coded[0], rowsBytes);
+        if (size > 0) {
+            memcpy(&out[pos], &coded[0], size);
+            put32(&out[4], PDELTA_CODED);
+            return pos + size;
+        }
+    }
+    return pos + rowsBytes;
+}
+
+bool pointCloudIsDelta(const sensor_msgs_msg_dds__PointCloud2_ *sample)
+{
+    return ((sample->data_.length() >= PDELTA_HEADER_BYTES)
+        && ((DDS_UnsignedLong)sample->data_.length() != (sample->row_step_ * sample->height_))
+        && (get32((const uint8_t *)&sample->data_[0]) == PDELTA_MAGIC));
+}
+
+/** --------------------------------------------------------
+ * PointCloudTracker
+ **/
+PointCloudTracker::PointCloudTracker() :
+    _sec(0), _nanosec(0), _synced(false), _lastRows(0)
+{
+}
+
+const uint8_t *PointCloudTracker::update(const sensor_msgs_msg_dds__PointCloud2_ *sample)
+{
+    int rows = (int)sample->height_;
+    int rowBytes = (int)sample->row_step_;
+    _lastRows = 0;
+
+    if (!pointCloudIsDelta(sample)) {
+        // keyframe: take all of it
+        const uint8_t *points = pointCloudData(sample, &_codec, _keyframe);
+        if (points == NULL) {
+            _synced = false;
+            return NULL;
+        }
+        _points.assign(points, points + ((size_t)rows * rowBytes));
+        _sec = sample->header_.stamp_.sec_;
+        _nanosec = sample->header_.stamp_.nanosec_;
+        _synced = true;
+        _lastRows = rows;
+        return &_points[0];
+    }
+
+    const uint8_t *in = (const uint8_t *)&sample->data_[0];
+    int inBytes = sample->data_.length();
+    if (!_synced || (_points.size() != ((size_t)rows * rowBytes))
+        || ((int32_t)get32(&in[8]) != _sec) || (get32(&in[12]) != _nanosec)) {
+        _synced = false;        // not the frame we have: wait for a keyframe
+        return NULL;
+    }
+
+    // check the runs, then get the rows
+    int runs = (int)get32(&in[16]);
+    int pos = PDELTA_HEADER_BYTES;
+    if ((runs < 0) || (runs > rows) || ((inBytes - pos) < (runs * 8))) {
+        _synced = false;
+        return NULL;
+    }
+    int changedRows = 0;
+    for (int i = 0; i < runs; i++) {
+        uint32_t first = get32(&in[pos + (i * 8)]);
+        uint32_t count = get32(&in[pos + (i * 8) + 4]);
+        if ((first > (uint32_t)rows) || (count > ((uint32_t)rows - first))) {
+            _synced = false;
+            return NULL;
+        }
+        changedRows += (int)count;
+    }
+    const uint8_t *runTable = &in[pos];
+    pos += runs * 8;
+    int rowsBytes = changedRows * rowBytes;
+    const uint8_t *src = &in[pos];
+    if (get32(&in[4]) & PDELTA_CODED) {
+        _rows.resize(rowsBytes);
+        if ((rowsBytes == 0) || (_codec.decode(&in[pos], inBytes - pos, &_rows[0], rowsBytes) != rowsBytes)) {
+            _synced = false;
+            return NULL;
+        }
+        src = &_rows[0];
+    }
+    else if ((inBytes - pos) != rowsBytes) {
+        _synced = false;
+        return NULL;
+    }
+
+    for (int i = 0; i < runs; i++) {
+        uint32_t first = get32(&runTable[i * 8]);
+        uint32_t count = get32(&runTable[(i * 8) + 4]);
+        memcpy(&_points[(size_t)first * rowBytes], src, (size_t)count * rowBytes);
+        src += (size_t)count * rowBytes;
+    }
+    _sec = sample->header_.stamp_.sec_;
+    _nanosec = sample->header_.stamp_.nanosec_;
+    _lastRows = changedRows;
+    return &_points[0];
+}
@@ -0,0 +1,75 @@
+/** ------------------------------------------------------------------------
+ * pointDelta.h
+ * Keyframe + delta PointCloud2 streams.
+ * A keyframe is an ordinary sample with all points (which may be
+ * compressed, see pointCodec.h).  A delta sample describes the same
+ * cloud (height, width, fields, steps) but only carries the rows (scan
+ * columns) that changed since the previous frame.  Its data_ is:
+ *   magic (uint32), flags (uint32), base stamp (int32 sec, uint32 nanosec),
+ *   run count (uint32), runs (uint32 first row, uint32 rows),
+ *   then the points of those rows, as is or coded with PointCodec
+ * The base stamp is the header stamp of the frame the delta applies to,
+ * so a reader that missed a frame (or joined late) can tell, and waits
+ * for the next keyframe.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef pointDelta_h
+#define pointDelta_h
+
+#include <stdint.h>
+#include <vector>
+#include "pointCodec.h"
+
+/** --------------------------------------------------------
+ * pointDeltaEncode()
+ * build the data of a delta sample from the full cloud 'raw' ('rows'
+ * rows of 'rowBytes'), with the rows where changed[row] != 0.
+ * The rows are coded with 'codec' if it is not NULL.  Returns the size
+ * written to 'out', or 0 if it does not fit in 'outMax' bytes.
+ **/
+int pointDeltaEncode(const uint8_t *raw, int rowBytes, int rows, const uint8_t *changed,
+    int32_t baseSec, uint32_t baseNanosec, PointCodec *codec, const pointCodecLayout *layout,
+    uint8_t *out, int outMax);
+
+/** --------------------------------------------------------
+ * pointCloudIsDelta()
+ * true if 'sample' is a delta sample
+ **/
+bool pointCloudIsDelta(const sensor_msgs_msg_dds__PointCloud2_ *sample);
+
+/** --------------------------------------------------------
+ * PointCloudTracker
+ * Reader side: rebuilds the full cloud from keyframes and deltas.
+ **/
+class PointCloudTracker {
+
+private:
+    PointCodec              _codec;
+    std::vector<uint8_t>    _points;    // the current full cloud
+    std::vector<uint8_t>    _keyframe;  // decoded keyframe, when compressed
+    std::vector<uint8_t>    _rows;      // decoded rows of a delta
+    int32_t                 _sec;       // stamp of the current cloud
+    uint32_t                _nanosec;
+    bool                    _synced;    // false until the first keyframe
+    int                     _lastRows;  // rows updated by the last sample
+
+public:
+    PointCloudTracker();
+
+    // apply a received sample; returns the full cloud (row_step * height
+    // bytes), or NULL while waiting for a keyframe or if the data is bad
+    const uint8_t *update(const sensor_msgs_msg_dds__PointCloud2_ *sample);
+
+    // rows (scan columns) changed by the last update()
+    int lastRows(void) const { return _lastRows; }
+};
+
+#endif  // ndef pointDelta_h
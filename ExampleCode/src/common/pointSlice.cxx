@@ -0,0 +1,126 @@
+/** ------------------------------------------------------------------------
+ * pointSlice.cxx
+ * Sliced PointCloud2 streams.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#include <string.h>
+#include "pointSlice.h"
+
+#define PSLICE_MAGIC        (0x31534350)    // "PCS1"
+#define PSLICE_CODED        (0x1)           // flag: rows are coded with PointCodec
+#define PSLICE_HEADER_BYTES (24)
+
+static inline void put16(uint8_t *p, uint16_t v) { memcpy(p, &v, sizeof(v)); }
+static inline void put32(uint8_t *p, uint32_t v) { memcpy(p, &v, sizeof(v)); }
+static inline uint16_t get16(const uint8_t *p) { uint16_t v; memcpy(&v, p, sizeof(v)); return v; }
+static inline uint32_t get32(const uint8_t *p) { uint32_t v; memcpy(&v, p, sizeof(v)); return v; }
+
+int pointSliceEncode(const uint8_t *raw, int rowBytes, uint32_t sweep, int slice, int sliceCount,
+    int firstRow, int rowCount, PointCodec *codec, const pointCodecLayout *layout,
+    uint8_t *out, int outMax)
+{
+    int rowsBytes = rowCount * rowBytes;
+    const uint8_t *rows = &raw[(size_t)firstRow * rowBytes];
+    if ((PSLICE_HEADER_BYTES + rowsBytes) > outMax) {
+        return 0;
+    }
+    put32(&out[0], PSLICE_MAGIC);
+    put32(&out[4], 0);
+    put32(&out[8], sweep);
+    put16(&out[12], (uint16_t)slice);
+    put16(&out[14], (uint16_t)sliceCount);
+    put32(&out[16], (uint32_t)firstRow);
+    put32(&out[20], (uint32_t)rowCount);
+
+    if (codec != NULL) {
+        int size = codec->encode(rows, rowsBytes, layout, &out[PSLICE_HEADER_BYTES], rowsBytes);
+        if (size > 0) {
+            put32(&out[4], PSLICE_CODED);
+            return PSLICE_HEADER_BYTES + size;
+        }
+    }
+    memcpy(&out[PSLICE_HEADER_BYTES], rows, rowsBytes);
+    return PSLICE_HEADER_BYTES + rowsBytes;
+}
+
+bool pointCloudIsSlice(const sensor_msgs_msg_dds__PointCloud2_ *sample)
+{
+    return ((sample->data_.length() >= PSLICE_HEADER_BYTES)
+        && ((DDS_UnsignedLong)sample->data_.length() != (sample->row_step_ * sample->height_))
+        && (get32((const uint8_t *)&sample->data_[0]) == PSLICE_MAGIC));
+}
+
+/** --------------------------------------------------------
+ * PointSliceAssembler
+ **/
+PointSliceAssembler::PointSliceAssembler() :
+    _sweep(0), _received(0), _started(false), _lost(0)
+{
+}
+
+int PointSliceAssembler::add(const sensor_msgs_msg_dds__PointCloud2_ *sample, int *rowCount)
+{
+    if (!pointCloudIsSlice(sample)) {
+        return -1;
+    }
+    const uint8_t *in = (const uint8_t *)&sample->data_[0];
+    int inBytes = sample->data_.length();
+    int rows = (int)sample->height_;
+    int rowBytes = (int)sample->row_step_;
+    uint32_t sweep = get32(&in[8]);
+    int slice = get16(&in[12]);
+    int sliceCount = get16(&in[14]);
+    uint32_t firstRow = get32(&in[16]);
+    uint32_t count = get32(&in[20]);
+    if ((slice >= sliceCount) || (firstRow > (uint32_t)rows) || (count > ((uint32_t)rows - firstRow))) {
+        return -1;
+    }
+
+    if (_started && (sweep != _sweep)) {
+        if ((int32_t)(sweep - _sweep) < 0) {
+            return -1;          // from an older sweep: too late
+        }
+        _lost += (long)_got.size() - _received;
+    }
+    if (!_started || (sweep != _sweep) || ((int)_got.size() != sliceCount)
+        || (_points.size() != ((size_t)rows * rowBytes))) {
+        // first slice of a new sweep
+        _sweep = sweep;
+        _got.assign(sliceCount, 0);
+        _received = 0;
+        _points.resize((size_t)rows * rowBytes);
+        _started = true;
+    }
+    if (_got[slice]) {
+        return -1;              // already have it
+    }
+
+    // the rows go right into their place in the sweep
+    int rowsBytes = (int)count * rowBytes;
+    uint8_t *dst = &_points[(size_t)firstRow * rowBytes];
+    const uint8_t *src = &in[PSLICE_HEADER_BYTES];
+    int srcBytes = inBytes - PSLICE_HEADER_BYTES;
+    if (get32(&in[4]) & PSLICE_CODED) {
+        if ((rowsBytes == 0) || (_codec.decode(src, srcBytes, dst, rowsBytes) != rowsBytes)) {
+            return -1;
+        }
+    }
+    else {
+        if (srcBytes != rowsBytes) {
+            return -1;
+        }
+        memcpy(dst, src, rowsBytes);
+    }
+    _got[slice] = 1;
+    _received++;
+    *rowCount = (int)count;
+    return (int)firstRow;
+}
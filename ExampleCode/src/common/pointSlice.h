@@ -0,0 +1,78 @@
+/** ------------------------------------------------------------------------
+ * pointSlice.h
+ * Sliced PointCloud2 streams: a sweep is sent as a number of samples
+ * (slices), each with a range of rows (scan columns), as soon as they
+ * are rendered.  A slice sample describes the whole sweep (height,
+ * width, fields, steps); its data_ is:
+ *   magic (uint32), flags (uint32), sweep id (uint32),
+ *   slice index, slice count (uint16's), first row, rows (uint32's),
+ *   then the points of those rows, as is or coded with PointCodec
+ * Each slice has the stamp of the time it was rendered.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef pointSlice_h
+#define pointSlice_h
+
+#include <stdint.h>
+#include <vector>
+#include "pointCodec.h"
+
+/** --------------------------------------------------------
+ * pointSliceEncode()
+ * build the data of slice 'slice' (of 'sliceCount') of sweep 'sweep':
+ * the 'rowCount' rows from 'firstRow' of the full cloud 'raw'.  The
+ * rows are coded with 'codec' if it is not NULL.  Returns the size
+ * written to 'out', or 0 if it does not fit in 'outMax' bytes.
+ **/
+int pointSliceEncode(const uint8_t *raw, int rowBytes, uint32_t sweep, int slice, int sliceCount,
+    int firstRow, int rowCount, PointCodec *codec, const pointCodecLayout *layout,
+    uint8_t *out, int outMax);
+
+/** --------------------------------------------------------
+ * pointCloudIsSlice()
+ * true if 'sample' is a slice of a sweep
+ **/
+bool pointCloudIsSlice(const sensor_msgs_msg_dds__PointCloud2_ *sample);
+
+/** --------------------------------------------------------
+ * PointSliceAssembler
+ * Reader side: puts the slices of a sweep together.  Each slice can be
+ * used as soon as it arrives.  Slices may be lost: when a slice of a
+ * newer sweep arrives, the sweep being assembled is given up (its
+ * missing slices are counted as lost), and slices of older sweeps
+ * are ignored.
+ **/
+class PointSliceAssembler {
+
+private:
+    PointCodec              _codec;
+    std::vector<uint8_t>    _points;    // the sweep; rows not received yet hold older data
+    std::vector<uint8_t>    _got;       // per slice of the current sweep: received
+    uint32_t                _sweep;
+    int                     _received;  // slices of the current sweep received
+    bool                    _started;
+    long                    _lost;      // slices never received, in total
+
+public:
+    PointSliceAssembler();
+
+    // add a received slice; returns its first row in the sweep (the
+    // rows are in points()) and their count in 'rowCount', or -1 if
+    // the slice is stale or not valid
+    int add(const sensor_msgs_msg_dds__PointCloud2_ *sample, int *rowCount);
+
+    uint32_t sweep(void) const { return _sweep; }
+    bool complete(void) const { return _started && (_received == (int)_got.size()); }
+    const uint8_t *points(void) const { return _points.empty() ? NULL : &_points[0]; }
+    long lost(void) const { return _lost; }
+};
+
+#endif  // ndef pointSlice_h
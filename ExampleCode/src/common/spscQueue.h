@@ -0,0 +1,74 @@
+/** ------------------------------------------------------------------------
+ * spscQueue.h
+ * Bounded lock-free queue between one producer thread and one consumer
+ * thread (e.g. a DDS listener handing work to a worker thread): push()
+ * and pop() never block or allocate, push() fails when the queue is full.
+ *
+ * (c) 2005-2020 Copyright, Real-Time Innovations, Inc.  All rights reserved.
+ * RTI grants Licensee a license to use, modify, compile, and create derivative
+ * works of the Software.  Licensee has the right to distribute object form
+ * only for use with RTI products.  The Software is provided 'as is', with no
+ * arranty of any type, including any warranty for fitness for any purpose. RTI
+ * is under no obligation to maintain or support the Software.  RTI shall not
+ * be liable for any incidental or consequential damages arising out of the
+ * use or inability to use the software.
+ **/
+#ifndef spscQueue_h
+#define spscQueue_h
+
+#include <atomic>
+#include <stddef.h>
+#include <vector>
+
+template <typename T>
+class SpscQueue {
+
+private:
+    std::vector<T>      _slots;
+    size_t              _mask;
+    // each side only writes its own index: padded apart, so they don't
+    // share a cache line (no alignas, so the queue can be made with new)
+    char                _pad0[64];
+    std::atomic<size_t> _head;      // next to pop (consumer)
+    char                _pad1[64 - sizeof(std::atomic<size_t>)];
+    std::atomic<size_t> _tail;      // next to push (producer)
+    char                _pad2[64 - sizeof(std::atomic<size_t>)];
+
+public:
+    // 'capacity' is rounded up to a power of 2
+    SpscQueue(size_t capacity) : _head(0), _tail(0)
+    {
+        size_t size = 2;
+        while (size < capacity) size <<= 1;
+        _slots.resize(size);
+        _mask = size - 1;
+    }
+
+    size_t capacity(void) const { return _slots.size(); }
+
+    // producer: false if full
+    bool push(const T &item)
+    {
+        size_t tail = _tail.load(std::memory_order_relaxed);
+        if ((tail - _head.load(std::memory_order_acquire)) >= _slots.size()) {
+            return false;
+        }
+        _slots[tail & _mask] = item;
+        _tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // consumer: false if empty
+    bool pop(T &item)
+    {
+        size_t head = _head.load(std::memory_order_relaxed);
+        if (head == _tail.load(std::memory_order_acquire)) {
+            return false;
+        }
+        item = _slots[head & _mask];
+        _head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+#endif  // ndef spscQueue_h